@@ -0,0 +1,303 @@
+/**
+ * @file bench.cpp
+ * @brief Executor de benchmarks não interativo do TP1 (BFS, DFS e MS-BFS).
+ * @details Roda o estudo de tempo das buscas sem menus nem pausas e grava os
+ * resultados em JSON ou CSV, para uso em scripts e na detecção de regressões.
+ *
+ * Uso: bench --grafo <arquivo> | --gerar <especificacao> [...] [opções]
+ *   --gerar <espec>    grafo sintético (comum/Geradores.h), ex: rmat:m=1e6 ou grade2d:v=1e6;
+ *                      um intervalo "m=1e3..1e9" (ou v=...) varre as potências de 10 do intervalo
+ *   --representacao lista,simples,matriz,triangular  (padrão: lista)
+ *   --algoritmo bfs,dfs,msbfs                        (padrão: bfs,dfs)
+ *   --repeticoes N     execuções medidas por amostra (padrão: 100)
+ *   --aquecimento N    execuções descartadas antes da medição (padrão: 5)
+ *   --semente S        semente das origens sorteadas (padrão: 42)
+ *   --threads T        threads do MS-BFS e dos geradores (padrão: 0 = número de núcleos)
+ *   --base <arquivo>   resultado JSON anterior para comparação (opcional)
+ *   --operacoes sim|nao   conta as operações dos algoritmos (bfs e dfs) (padrão: nao)
+ *   --contadores sim|nao  lê os contadores do processador em cada execução (padrão: nao)
+ *   --limiar F         variação relativa da mediana tolerada na comparação (padrão: 0.05)
+ *   --formato json|csv (padrão: json)
+ *   --saida <arquivo>  (padrão: saída padrão)
+ *
+ * Um arquivo de grafo que não existir no caminho informado é procurado em
+ * estudos/grafos_em_txt. Grafos gerados vão direto para a representação, sem arquivo;
+ * a geração entra no tempo e na memória da carga (como a leitura) e o nome do grafo é
+ * a especificação canônica, com os tamanhos efetivos. As origens são sorteadas uma vez por grafo, então todas
+ * as representações e algoritmos medem as mesmas buscas.
+ *
+ * As estatísticas vêm de comum/Benchmark.h (mediana, p90/p99, IC de 95%,
+ * outliers). Com --contadores sim, cada execução medida também registra ciclos,
+ * instruções, faltas de LLC e dTLB e desvios mal previstos (comum/ContadoresHardware.h);
+ * se o sistema não permitir, as colunas ficam vazias. Com --operacoes sim, cada origem
+ * medida é executada mais uma vez, sem cronometrar, com a política ComContagem
+ * (comum/ContagemOperacoes.h), e a saída traz a média por execução de vértices
+ * finalizados, arestas examinadas, relaxamentos, operações de heap e rodadas. A memória de cada carga vem de utilitarios/Memoria.h: bytes da
+ * representação, pico de RSS da carga (leitura + finalização) e heap retido. Com --base, cada medição é comparada à de mesmo grafo, representação
+ * e algoritmo pelo teste de Mann-Whitney; o código de saída é 3 se houver
+ * regressão (e 1 se alguma medição falhar).
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../biblioteca/interface/Grafo.h"
+#include "../biblioteca/algoritmos/BFS.h"
+#include "../biblioteca/algoritmos/DFS.h"
+#include "../biblioteca/algoritmos/MSBFS.h"
+#include "../../comum/ExecutorBench.h"
+#include "../biblioteca/utilitarios/Memoria.h"
+#include "../../comum/Geradores.h"
+#include "../estudos/estudos.h"
+
+namespace {
+
+    struct OpcaoRepresentacao {
+        const char* chave;
+        const char* nome; // Mesmo nome usado nos CSV dos estudos
+        TipoRepresentacao tipo;
+    };
+
+    const OpcaoRepresentacao REPRESENTACOES[] = {
+        { "lista", "Lista Otimizada (CSR)", TipoRepresentacao::LISTA_ADJACENCIA },
+        { "simples", "Lista Simples", TipoRepresentacao::LISTA_ADJACENCIA_SIMPLES },
+        { "matriz", "Matriz Classica", TipoRepresentacao::MATRIZ_ADJACENCIA },
+        { "triangular", "Matriz Triangular", TipoRepresentacao::MATRIZ_ADJACENCIA_TRIANGULAR },
+    };
+
+    const char* ALGORITMOS[] = { "bfs", "dfs", "msbfs" };
+
+    struct ConfiguracaoBench : OpcoesBench {
+        std::vector<FonteGrafo> grafos;
+        std::vector<std::string> representacoes{ "lista" };
+        std::vector<std::string> algoritmos{ "bfs", "dfs" };
+
+        ConfiguracaoBench() {
+            repeticoes = 100;
+            aquecimento = 5;
+        }
+    };
+
+    struct ResultadoBench : ResultadoMedicao {
+        long long bytesRepresentacao = -1; // Grafo::bytesUtilizados() após a finalização
+        long long picoRssCargaBytes = -1;  // Crescimento do pico de RSS durante a carga
+        long long heapRetidoBytes = -1;    // Heap em uso com o grafo carregado, menos o de antes da carga
+    };
+
+    void imprimirUso(std::ostream& saida) {
+        saida << "Uso: bench --grafo <arquivo> | --gerar <modelo[:chave=valor]...> [...]\n"
+            << "             [--representacao lista,simples,matriz,triangular] [--algoritmo bfs,dfs,msbfs]\n"
+            << "             [--repeticoes N] [--aquecimento N] [--semente S] [--threads T]\n"
+            << "             [--operacoes sim|nao] [--contadores sim|nao] [--base <arquivo.json>] [--limiar F] [--formato json|csv] [--saida <arquivo>]\n";
+    }
+
+    ConfiguracaoBench lerArgumentos(int argc, char** argv) {
+        ConfiguracaoBench config;
+        percorrerArgumentos(argc, argv, imprimirUso, [&](const std::string& opcao, const std::string& valor) {
+            if (opcao == "--grafo") {
+                FonteGrafo fonte;
+                fonte.nome = valor;
+                config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--gerar") {
+                for (auto& fonte : lerFontesGeradas(valor, false)) config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--representacao") config.representacoes = separarLista(valor);
+            else if (opcao == "--algoritmo") config.algoritmos = separarLista(valor);
+            else return lerOpcaoBench(config, opcao, valor);
+            return true;
+        });
+
+        if (config.grafos.empty()) throw std::runtime_error("Informe ao menos um --grafo ou --gerar.");
+        for (const auto& chave : config.representacoes) {
+            if (std::none_of(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; })) {
+                throw std::runtime_error("Representacao desconhecida: " + chave);
+            }
+        }
+        for (const auto& chave : config.algoritmos) {
+            if (std::none_of(std::begin(ALGORITMOS), std::end(ALGORITMOS),
+                [&](const char* a) { return chave == a; })) {
+                throw std::runtime_error("Algoritmo desconhecido: " + chave);
+            }
+        }
+        return config;
+    }
+
+    /**
+     * @brief Executa aquecimento + repetições de um algoritmo e guarda o tempo de cada repetição.
+     * @param contadores Se não for nulo, também guarda os contadores do processador de cada repetição.
+     */
+    void medirAlgoritmo(const Grafo& grafo, const std::string& algoritmo, const std::vector<int>& origens,
+        const ConfiguracaoBench& config, ContadoresHardware* contadores, ResultadoBench& resultado) {
+        BFS bfs;
+        DFS dfs;
+        MSBFS msbfs;
+        const size_t lote = static_cast<size_t>(MSBFS::origensPorLote());
+        volatile long long sumidouro = 0; // Impede que o compilador descarte as buscas
+
+        auto rodar = [&](int execucao) {
+            if (algoritmo == "bfs") {
+                sumidouro = sumidouro + bfs.executar(grafo, origens[execucao]).nivel.size();
+            }
+            else if (algoritmo == "dfs") {
+                sumidouro = sumidouro + dfs.executar(grafo, origens[execucao]).nivel.size();
+            }
+            else {
+                // Um lote completo de origens por execução, com as threads pedidas
+                std::vector<int> loteOrigens(origens.begin() + execucao * lote, origens.begin() + (execucao + 1) * lote);
+                sumidouro = sumidouro + msbfs.calcularEstatisticas(grafo, loteOrigens, -1, config.numThreads).size();
+            }
+        };
+
+        medirTempos(config, contadores, rodar, resultado);
+
+        // Uma execução extra (não cronometrada) por origem medida, com a política de contagem
+        if (config.operacoes && (algoritmo == "bfs" || algoritmo == "dfs")) {
+            for (int k = 0; k < config.repeticoes; ++k) {
+                const int origem = origens[config.aquecimento + k];
+                somarOperacoes(resultado.somaOperacoes, algoritmo == "bfs"
+                    ? bfs.executar<ComContagem>(grafo, origem).operacoes
+                    : dfs.executar<ComContagem>(grafo, origem).operacoes);
+            }
+            resultado.execucoesContadas = config.repeticoes;
+        }
+    }
+
+    void escreverCSV(std::ostream& saida, const ConfiguracaoBench& config, const std::vector<ResultadoBench>& resultados) {
+        saida << "Grafo,Representacao,Algoritmo,Vertices,Arestas,NumExecucoes,Aquecimento,Semente,Threads,"
+            "TempoCarga_ms,BytesRepresentacao,PicoRSSCarga_bytes,HeapRetido_bytes,";
+        escreverColunasMedicaoCSV(saida);
+        saida << "\n";
+        saida.precision(6);
+        saida << std::fixed;
+        for (const auto& r : resultados) {
+            saida << r.grafo << "," << r.representacao << "," << r.algoritmo << "," << r.vertices << "," << r.arestas << ","
+                << config.repeticoes << "," << config.aquecimento << "," << config.semente << "," << config.numThreads << ","
+                << r.tempoCargaMs << "," << r.bytesRepresentacao << "," << r.picoRssCargaBytes << "," << r.heapRetidoBytes << ",";
+            escreverMedicaoCSV(saida, r);
+            saida << "\n";
+        }
+    }
+
+    // Memória da carga, logo depois de "tempo_carga_ms" no JSON
+    std::string camposMemoriaJSON(const ResultadoBench& r) {
+        return ", \"bytes_representacao\": " + std::to_string(r.bytesRepresentacao)
+            + ", \"pico_rss_carga_bytes\": " + std::to_string(r.picoRssCargaBytes)
+            + ", \"heap_retido_bytes\": " + std::to_string(r.heapRetidoBytes);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConfiguracaoBench config;
+    try {
+        config = lerArgumentos(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        imprimirUso(std::cerr);
+        return 2;
+    }
+
+    const bool usaMSBFS = std::find(config.algoritmos.begin(), config.algoritmos.end(), "msbfs") != config.algoritmos.end();
+    const size_t execucoes = static_cast<size_t>(config.aquecimento) + config.repeticoes;
+    const size_t numOrigens = usaMSBFS ? execucoes * MSBFS::origensPorLote() : execucoes;
+
+    std::map<std::string, std::vector<double>> temposBase;
+    if (!config.base.empty()) {
+        try {
+            temposBase = lerTemposBase(config.base);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Erro: " << e.what() << "\n";
+            return 2;
+        }
+    }
+
+    std::unique_ptr<ContadoresHardware> contadores = abrirContadores(config);
+
+    std::vector<ResultadoBench> resultados;
+    bool houveFalha = false, houveRegressao = false;
+
+    for (const auto& fonte : config.grafos) {
+        const std::string& nomeGrafo = fonte.nome;
+        std::vector<int> origens; // Sorteadas na primeira carga do grafo
+        for (const auto& chave : config.representacoes) {
+            const auto& repr = *std::find_if(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; });
+            std::cerr << "Processando " << nomeGrafo << " com " << repr.nome << "..." << std::endl;
+
+            try {
+                MedicaoCarga carga = fonte.gerado ? medirCargaGrafo(fonte.parametros, repr.tipo, config.numThreads)
+                    : medirCargaGrafo(resolverCaminhoGrafo(nomeGrafo, caminhoEstudos(nomeGrafo)), repr.tipo);
+                const Grafo& grafo = *carga.grafo;
+                const double tempoCargaMs = carga.tempoLeituraMs + carga.tempoFinalizacaoMs;
+
+                if (grafo.obterNumeroVertices() <= 0) throw std::runtime_error("Grafo sem vertices.");
+                if (origens.empty()) origens = sortearOrigens(grafo.obterNumeroVertices(), numOrigens, config.semente);
+
+                for (const auto& algoritmo : config.algoritmos) {
+                    ResultadoBench resultado;
+                    resultado.grafo = nomeGrafo;
+                    resultado.representacao = repr.nome;
+                    resultado.algoritmo = algoritmo;
+                    resultado.vertices = grafo.obterNumeroVertices();
+                    resultado.arestas = grafo.obterNumeroArestas();
+                    resultado.tempoCargaMs = tempoCargaMs;
+                    resultado.bytesRepresentacao = static_cast<long long>(carga.bytesFinal);
+                    resultado.picoRssCargaBytes = std::max(carga.picoLeituraBytes(), carga.picoFinalizacaoBytes());
+                    resultado.heapRetidoBytes = carga.heapRetidoBytes();
+                    try {
+                        medirAlgoritmo(grafo, algoritmo, origens, config, contadores.get(), resultado);
+                        std::cerr << "  - " << algoritmo << ": " << resultado.estatisticas.mediana << " ms/execucao (mediana)" << std::endl;
+                    }
+                    catch (const std::exception& e) {
+                        registrarFalha(resultado, e.what());
+                        houveFalha = true;
+                        std::cerr << "  > ERRO (" << algoritmo << "): " << e.what() << std::endl;
+                    }
+                    resultados.push_back(std::move(resultado));
+                }
+            }
+            catch (const std::exception& e) {
+                houveFalha = true;
+                std::cerr << "  > ERRO: " << e.what() << std::endl;
+                for (const auto& algoritmo : config.algoritmos) {
+                    ResultadoBench resultado;
+                    resultado.grafo = nomeGrafo;
+                    resultado.representacao = repr.nome;
+                    resultado.algoritmo = algoritmo;
+                    resultado.status = e.what();
+                    resultados.push_back(std::move(resultado));
+                }
+            }
+        }
+    }
+
+    std::ofstream arquivo;
+    if (!config.saida.empty()) {
+        arquivo.open(config.saida);
+        if (!arquivo.is_open()) {
+            std::cerr << "Erro: nao foi possivel criar " << config.saida << "\n";
+            return 2;
+        }
+    }
+    // Comparação com a base (mesmo grafo, representação e algoritmo)
+    for (auto& r : resultados) {
+        if (compararResultadoComBase(r, temposBase, config.limiar)) houveRegressao = true;
+    }
+
+    std::ostream& saida = config.saida.empty() ? std::cout : arquivo;
+    if (config.formatoCSV) escreverCSV(saida, config, resultados);
+    else escreverJSONBench(saida, "TP1", config, resultados, std::string(), camposMemoriaJSON);
+
+    if (houveFalha) return 1;
+    return houveRegressao ? 3 : 0;
+}
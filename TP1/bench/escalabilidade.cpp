@@ -0,0 +1,312 @@
+/**
+ * @file escalabilidade.cpp
+ * @brief Estudo de escalabilidade do TP1: algoritmos paralelos com 1, 2, 4, ... threads.
+ * @details Mede cada algoritmo paralelo com cada número de threads, no mesmo grafo
+ * (escala forte) ou em um grafo gerado que cresce junto com as threads (escala fraca),
+ * e grava speedup e eficiência paralela em CSV. As primeiras colunas são as do estudo de
+ * caso 2 (resultados_benchmark_final_detalhado.csv), na mesma ordem; as colunas próprias
+ * da escalabilidade vêm depois delas.
+ *
+ * Uso: escalabilidade --grafo <arquivo> | --gerar <especificacao> [...] [opções]
+ *   --gerar <espec>    grafo sintético (comum/Geradores.h), ex: rmat:m=1e6 ou grade2d:v=1e6;
+ *                      um intervalo "m=1e3..1e9" (ou v=...) varre as potências de 10 do intervalo
+ *   --representacao lista,simples,matriz,triangular  (padrão: lista)
+ *   --algoritmo msbfs,componentes,graus,hyperanf,construcao  (padrão: todos)
+ *   --threads 1,2,4,...  números de threads (padrão: potências de 2 até o número de
+ *                      processadores disponíveis, e o próprio número); 1 sempre é medido
+ *   --escala forte|fraca|forte,fraca   (padrão: forte)
+ *   --fixar sim|nao    restringe a medição com t threads a t processadores (padrão: sim)
+ *   --lotes N          lotes de origens por execução do msbfs (padrão: o maior número de threads)
+ *   --repeticoes N     execuções medidas por amostra (padrão: 5)
+ *   --aquecimento N    execuções descartadas antes da medição (padrão: 1)
+ *   --semente S        semente das origens sorteadas (padrão: 42)
+ *   --saida <arquivo>  (padrão: resultados_escalabilidade.csv)
+ *
+ * Algoritmos: msbfs (MSBFS::calcularEstatisticas; as threads dividem os lotes de
+ * MSBFS::origensPorLote() origens, então cada execução tem --lotes lotes), componentes
+ * (Grafo::encontrarComponentesConexas), graus (Grafo::calcularEstatisticasGrau), hyperanf
+ * (Grafo::estimarFuncaoVizinhanca com 2^6 registradores) e construcao (geração das arestas +
+ * representação; ignorada nos grafos de arquivo). As origens são sorteadas uma vez por
+ * grafo, então todos os números de threads medem as mesmas buscas.
+ *
+ * Escala forte: o grafo é carregado uma vez (com todas as threads) e o speedup é
+ * mediana(T1) / mediana(Tt), com eficiência speedup / t. Escala fraca (só grafos
+ * gerados): com t threads, o gerador recebe t vezes os vértices e as arestas do grafo
+ * informado, mas arredonda o tamanho (o R-MAT para potência de 2, as grades para L x L),
+ * então o crescimento real é medido: RazaoTamanho = (Vt + Mt) / (V1 + M1), com V e M os
+ * vértices e as arestas efetivos. O speedup (escalado) é RazaoTamanho x mediana(T1) /
+ * mediana(Tt) e a eficiência é speedup / t; na escala forte RazaoTamanho vale 1. O nome
+ * do grafo é sempre o do grafo com 1 thread; Vertices e Arestas trazem o tamanho efetivo.
+ *
+ * Com --fixar sim, a medição com t threads roda restrita aos t primeiros processadores
+ * da lista de processadores disponíveis ordenada por nó NUMA (restringirAosProcessadores,
+ * em comum/Paralelo.h): as threads criadas pelos algoritmos herdam a restrição da
+ * thread principal. O grafo é carregado restrito aos processadores do maior número de
+ * threads, então a sua memória fica nos nós que as medições usam. As colunas
+ * Processadores e NosNUMA listam os processadores e os nós usados (separados por ';');
+ * sem fixação, ficam vazias. Mais threads do que processadores dão sobreposição.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../biblioteca/interface/Grafo.h"
+#include "../biblioteca/algoritmos/MSBFS.h"
+#include "../../comum/ExecutorBench.h"
+#include "../../comum/Paralelo.h"
+#include "../estudos/estudos.h"
+
+namespace {
+
+    struct OpcaoRepresentacao {
+        const char* chave;
+        const char* nome; // Mesmo nome usado nos CSV dos estudos
+        TipoRepresentacao tipo;
+    };
+
+    const OpcaoRepresentacao REPRESENTACOES[] = {
+        { "lista", "Lista Otimizada (CSR)", TipoRepresentacao::LISTA_ADJACENCIA },
+        { "simples", "Lista Simples", TipoRepresentacao::LISTA_ADJACENCIA_SIMPLES },
+        { "matriz", "Matriz Classica", TipoRepresentacao::MATRIZ_ADJACENCIA },
+        { "triangular", "Matriz Triangular", TipoRepresentacao::MATRIZ_ADJACENCIA_TRIANGULAR },
+    };
+
+    const char* ALGORITMOS[] = { "msbfs", "componentes", "graus", "hyperanf", "construcao" };
+
+    struct ConfiguracaoEscalabilidade : OpcoesEscalabilidade {
+        std::vector<FonteGrafo> grafos;
+        std::vector<std::string> representacoes{ "lista" };
+        std::vector<std::string> algoritmos{ std::begin(ALGORITMOS), std::end(ALGORITMOS) };
+        int lotes = 0; // 0 => o maior número de threads
+
+        ConfiguracaoEscalabilidade() {
+            saida = "resultados_escalabilidade.csv";
+        }
+    };
+
+    void imprimirUso(std::ostream& saida) {
+        saida << "Uso: escalabilidade --grafo <arquivo> | --gerar <modelo[:chave=valor]...> [...]\n"
+            << "             [--representacao lista,simples,matriz,triangular] [--algoritmo msbfs,componentes,graus,hyperanf,construcao]\n"
+            << "             [--threads 1,2,4,...] [--escala forte|fraca|forte,fraca] [--fixar sim|nao]\n"
+            << "             [--lotes N] [--repeticoes N] [--aquecimento N] [--semente S] [--saida <arquivo.csv>]\n";
+    }
+
+    ConfiguracaoEscalabilidade lerArgumentos(int argc, char** argv) {
+        ConfiguracaoEscalabilidade config;
+        percorrerArgumentos(argc, argv, imprimirUso, [&](const std::string& opcao, const std::string& valor) {
+            if (opcao == "--grafo") {
+                FonteGrafo fonte;
+                fonte.nome = valor;
+                config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--gerar") {
+                for (auto& fonte : lerFontesGeradas(valor, false)) config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--representacao") config.representacoes = separarLista(valor);
+            else if (opcao == "--algoritmo") config.algoritmos = separarLista(valor);
+            else if (opcao == "--lotes") config.lotes = static_cast<int>(lerInteiro(opcao, valor, 1));
+            else return lerOpcaoEscalabilidade(config, opcao, valor);
+            return true;
+        });
+
+        if (config.grafos.empty()) throw std::runtime_error("Informe ao menos um --grafo ou --gerar.");
+        for (const auto& chave : config.representacoes) {
+            if (std::none_of(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; })) {
+                throw std::runtime_error("Representacao desconhecida: " + chave);
+            }
+        }
+        for (const auto& chave : config.algoritmos) {
+            if (std::none_of(std::begin(ALGORITMOS), std::end(ALGORITMOS),
+                [&](const char* a) { return chave == a; })) {
+                throw std::runtime_error("Algoritmo desconhecido: " + chave);
+            }
+        }
+        completarOpcoesEscalabilidade(config);
+        if (config.lotes == 0) config.lotes = config.threads.back(); // Ao menos um lote por thread
+        return config;
+    }
+
+    std::unique_ptr<Grafo> construirGrafo(const FonteGrafo& fonte, const ParametrosGerador& parametros,
+        TipoRepresentacao tipo, int numThreads) {
+        if (!fonte.gerado) return std::make_unique<Grafo>(resolverCaminhoGrafo(fonte.nome, caminhoEstudos(fonte.nome)), tipo);
+        GrafoGerado<std::pair<int, int>> gerado = gerarArestas<std::pair<int, int>>(parametros, numThreads);
+        return std::make_unique<Grafo>(gerado.numeroVertices, std::move(gerado.arestas), tipo);
+    }
+
+    /**
+     * @brief Executa aquecimento + repetições de um algoritmo com 'numThreads' threads.
+     * @details Em construcao, cada execução gera as arestas e monta o CSR de novo.
+     */
+    void medirAlgoritmo(const Grafo& grafo, const FonteGrafo& fonte, const ParametrosGerador& parametros,
+        TipoRepresentacao tipo, const std::string& algoritmo, const std::vector<int>& origens, int numThreads,
+        const ConfiguracaoEscalabilidade& config, ResultadoEscalabilidade& resultado) {
+        MSBFS msbfs;
+        const size_t origensPorExecucao = static_cast<size_t>(config.lotes) * MSBFS::origensPorLote();
+        volatile long long sumidouro = 0; // Impede que o compilador descarte as execuções
+
+        auto rodar = [&](int execucao) {
+            if (algoritmo == "msbfs") {
+                std::vector<int> loteOrigens(origens.begin() + execucao * origensPorExecucao,
+                    origens.begin() + (execucao + 1) * origensPorExecucao);
+                sumidouro = sumidouro + msbfs.calcularEstatisticas(grafo, loteOrigens, -1, numThreads).size();
+            }
+            else if (algoritmo == "componentes") {
+                sumidouro = sumidouro + grafo.encontrarComponentesConexas(numThreads).size();
+            }
+            else if (algoritmo == "graus") {
+                sumidouro = sumidouro + grafo.calcularEstatisticasGrau(numThreads).grauMax;
+            }
+            else if (algoritmo == "hyperanf") {
+                ControleExecucao controle;
+                controle.numThreads = numThreads;
+                sumidouro = sumidouro + grafo.estimarFuncaoVizinhanca(6, controle).iteracoes;
+            }
+            else {
+                sumidouro = sumidouro + construirGrafo(fonte, parametros, tipo, numThreads)->obterNumeroArestas();
+            }
+        };
+
+        resultado.temposMs = medirExecucoes(config.aquecimento, config.repeticoes, rodar);
+        resultado.estatisticas = calcularEstatisticasTempo(resultado.temposMs);
+    }
+
+    // Colunas do estudo de caso 2 primeiro (mesma ordem, falhas com -1), depois as da escalabilidade
+    void escreverCSV(std::ostream& saida, const ConfiguracaoEscalabilidade& config, const std::vector<ResultadoEscalabilidade>& resultados) {
+        saida << "Grafo,Representacao,Algoritmo,Vertices,Arestas,NumExecucoes,TempoTotal_ms,TempoMedio_ms,TempoMin_ms,"
+            "TempoMax_ms,DesvioPadrao_ms,Status,TempoMediana_ms,TempoP90_ms,TempoP99_ms,Outliers,"
+            "Aquecimento,Semente,Threads,TempoCarga_ms,IC95Inferior_ms,IC95Superior_ms,";
+        escreverColunasEscalabilidadeCSV(saida);
+        saida << "\n";
+        saida.precision(6);
+        saida << std::fixed;
+        for (const auto& r : resultados) {
+            const EstatisticasTempo& e = r.estatisticas;
+            saida << r.grafo << "," << r.representacao << "," << r.algoritmo << ","
+                << r.vertices << "," << r.arestas << "," << config.repeticoes << ",";
+            if (r.status == "OK") {
+                saida << e.total << "," << e.media << "," << e.minimo << "," << e.maximo << "," << e.desvioPadrao << ",OK,"
+                    << e.mediana << "," << e.p90 << "," << e.p99 << "," << e.outliers << ",";
+            }
+            else saida << "-1,-1,-1,-1,-1,FALHA,-1,-1,-1,-1,";
+            saida << config.aquecimento << "," << config.semente << "," << r.threads << "," << r.tempoCargaMs << ",";
+            if (r.status == "OK") saida << e.icInferior << "," << e.icSuperior;
+            else saida << "-1,-1";
+            saida << ",";
+            escreverEscalabilidadeCSV(saida, r, config.fixar);
+            saida << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConfiguracaoEscalabilidade config;
+    try {
+        config = lerArgumentos(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        imprimirUso(std::cerr);
+        return 2;
+    }
+
+    informarProcessadores(config.threads.back());
+
+    const size_t execucoes = static_cast<size_t>(config.aquecimento) + config.repeticoes;
+    std::vector<ResultadoEscalabilidade> resultados;
+    bool houveFalha = false;
+
+    for (const auto& fonte : config.grafos) {
+        for (const auto& chave : config.representacoes) {
+            const auto& repr = *std::find_if(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; });
+            for (const auto& escala : config.escalas) {
+                const bool fraca = (escala == "fraca");
+                if (fraca && !fonte.gerado) {
+                    std::cerr << "Aviso: escala fraca so se aplica a grafos gerados; " << fonte.nome << " ignorado." << std::endl;
+                    continue;
+                }
+                std::cerr << "Processando " << fonte.nome << " com " << repr.nome << " (escala " << escala << ")..." << std::endl;
+
+                std::unique_ptr<Grafo> grafo;
+                std::vector<int> origens;
+                double tempoCargaMs = -1.0;
+                std::string erroCarga;
+                for (int numThreads : config.threads) {
+                    const ParametrosGerador parametros = fraca ? escalarParametros(fonte.parametros, numThreads) : fonte.parametros;
+                    // Na escala forte o grafo (e as origens) são os mesmos para todos os números de threads
+                    if (fraca || (!grafo && erroCarga.empty())) {
+                        grafo.reset();
+                        if (config.fixar) restringirAosProcessadores(config.threads.back());
+                        try {
+                            auto inicio = std::chrono::steady_clock::now();
+                            grafo = construirGrafo(fonte, parametros, repr.tipo, 0);
+                            auto fim = std::chrono::steady_clock::now();
+                            tempoCargaMs = std::chrono::duration<double, std::milli>(fim - inicio).count();
+                            if (grafo->obterNumeroVertices() <= 0) throw std::runtime_error("Grafo sem vertices.");
+                            origens = sortearOrigens(grafo->obterNumeroVertices(),
+                                execucoes * config.lotes * MSBFS::origensPorLote(), config.semente);
+                        }
+                        catch (const std::exception& e) {
+                            grafo.reset();
+                            erroCarga = e.what();
+                            std::cerr << "  > ERRO: " << e.what() << std::endl;
+                        }
+                    }
+
+                    // As threads que os algoritmos criarem herdam a restrição da thread principal
+                    if (config.fixar) restringirAosProcessadores(numThreads);
+                    for (const auto& algoritmo : config.algoritmos) {
+                        if (algoritmo == "construcao" && !fonte.gerado) continue; // Só há o que construir em grafos gerados
+                        ResultadoEscalabilidade resultado;
+                        resultado.grafo = fonte.nome;
+                        resultado.representacao = repr.nome;
+                        resultado.algoritmo = algoritmo;
+                        resultado.escala = escala;
+                        resultado.threads = numThreads;
+                        if (!grafo) {
+                            resultado.status = erroCarga;
+                            houveFalha = true;
+                            resultados.push_back(std::move(resultado));
+                            continue;
+                        }
+                        resultado.vertices = grafo->obterNumeroVertices();
+                        resultado.arestas = grafo->obterNumeroArestas();
+                        resultado.tempoCargaMs = tempoCargaMs;
+                        try {
+                            medirAlgoritmo(*grafo, fonte, parametros, repr.tipo, algoritmo, origens, numThreads, config, resultado);
+                            std::cerr << "  - " << algoritmo << " com " << numThreads << " thread(s): "
+                                << resultado.estatisticas.mediana << " ms/execucao (mediana)" << std::endl;
+                        }
+                        catch (const std::exception& e) {
+                            resultado.temposMs.clear();
+                            resultado.status = e.what();
+                            houveFalha = true;
+                            std::cerr << "  > ERRO (" << algoritmo << ", " << numThreads << " thread(s)): " << e.what() << std::endl;
+                        }
+                        resultados.push_back(std::move(resultado));
+                    }
+                }
+            }
+        }
+    }
+
+    calcularSpeedup(resultados);
+
+    std::ofstream arquivo(config.saida);
+    if (!arquivo.is_open()) {
+        std::cerr << "Erro: nao foi possivel criar " << config.saida << "\n";
+        return 2;
+    }
+    escreverCSV(arquivo, config, resultados);
+    std::cerr << "Resultados gravados em " << config.saida << std::endl;
+
+    return houveFalha ? 1 : 0;
+}
@@ -6,6 +6,7 @@
 #include "../../biblioteca/interface/Grafo.h" // Inclui a definio completa do Grafo
 #include <queue>
 
+template <class Contagem>
 ResultadoBFS BFS::executar(const Grafo& grafo, int verticeOrigem) const {
     // Bloco: Preparao
     const int numVertices = grafo.obterNumeroVertices();
@@ -20,6 +21,7 @@ ResultadoBFS BFS::executar(const Grafo& grafo, int verticeOrigem) const {
         visitadoTick.assign(numVertices + 1, 0);
     }
     const int tickAtual = tickGlobal++;
+    Contagem contagem;
 
     // Bloco: Inicializao da busca
     std::queue<int> fila;
@@ -32,10 +34,13 @@ ResultadoBFS BFS::executar(const Grafo& grafo, int verticeOrigem) const {
     while (!fila.empty()) {
         int u = fila.front();
         fila.pop();
+        contagem.verticeFinalizado();
 
         // Acessa o grafo atravs de sua interface pblica
         for (int v : grafo.obterVizinhos(u)) {
+            contagem.arestaExaminada();
             if (visitadoTick[v] != tickAtual) {
+                contagem.relaxamento();
                 visitadoTick[v] = tickAtual;
                 resultado.pai[v] = u;
                 resultado.nivel[v] = resultado.nivel[u] + 1;
@@ -43,5 +48,10 @@ ResultadoBFS BFS::executar(const Grafo& grafo, int verticeOrigem) const {
             }
         }
     }
+    resultado.operacoes = contagem.obter();
     return resultado;
-}
\ No newline at end of file
+}
+
+// Instncias usadas pela biblioteca e pelos estudos (a implementao fica neste arquivo)
+template ResultadoBFS BFS::executar<SemContagem>(const Grafo&, int) const;
+template ResultadoBFS BFS::executar<ComContagem>(const Grafo&, int) const;
\ No newline at end of file
@@ -10,6 +10,8 @@ class Grafo;
 
 #include <vector>
 
+#include "../../../comum/ContagemOperacoes.h"
+
 /**
  * @struct ResultadoBFS
  * @brief Armazena o resultado de uma execução da Busca em Largura (BFS).
@@ -18,6 +20,7 @@ class Grafo;
 struct ResultadoBFS {
     std::vector<int> pai;   // pai[v] = antecessor de v na árvore de busca (0 para a raiz)
     std::vector<int> nivel; // nivel[v] = distância em arestas a partir da origem (-1 se inalcançável)
+    ContadoresOperacoes operacoes; // Preenchido só com a política ComContagem
 };
 
 /**
@@ -30,7 +33,10 @@ public:
      * @brief Executa a busca em largura.
      * @param grafo O grafo (constante) sobre o qual a busca será executada.
      * @param verticeOrigem O vértice inicial da busca.
+     * @tparam Contagem SemContagem (padrão) ou ComContagem. Contagens: vértices retirados da
+     * fila (verticesFinalizados), arestas examinadas, vértices descobertos (relaxamentos).
      * @return Um struct ResultadoBFS com a árvore de busca.
      */
+    template <class Contagem = SemContagem>
     ResultadoBFS executar(const Grafo& grafo, int verticeOrigem) const;
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <utility> // Para std::pair
 #include <algorithm> // Para std::reverse
 
+template <class Contagem>
 ResultadoDFS DFS::executar(const Grafo& grafo, int verticeOrigem) const {
     // Bloco 1: Preparao (similar ao seu "Desmarcar todos os vrtices")
     const int numVertices = grafo.obterNumeroVertices();
@@ -15,11 +16,13 @@ ResultadoDFS DFS::executar(const Grafo& grafo, int verticeOrigem) const {
     resultado.pai.assign(numVertices + 1, -1);
     resultado.nivel.assign(numVertices + 1, -1);
     std::vector<bool> visitado(numVertices + 1, false);
+    Contagem contagem;
 
     // Bloco 2: Definir pilha P com um elemento s
     // Usamos uma pilha de pares para rastrear o vrtice e seu pai na busca.
     std::stack<std::pair<int, int>> pilha;
     pilha.push({ verticeOrigem, 0 }); // O par  {vrtice, pai_do_vrtice}. Pai 0 para a origem.
+    contagem.insercaoHeap();
 
     // Bloco 3: Enquanto P no estiver vazia
     while (!pilha.empty()) {
@@ -33,6 +36,7 @@ ResultadoDFS DFS::executar(const Grafo& grafo, int verticeOrigem) const {
         if (!visitado[u]) {
             // Bloco 6: Marcar u
             visitado[u] = true;
+            contagem.verticeFinalizado();
             resultado.pai[u] = pai_de_u;
             // O nvel do filho  o nvel do pai + 1
             resultado.nivel[u] = (pai_de_u == 0) ? 0 : resultado.nivel[pai_de_u] + 1;
@@ -44,12 +48,22 @@ ResultadoDFS DFS::executar(const Grafo& grafo, int verticeOrigem) const {
             std::reverse(vizinhos.begin(), vizinhos.end());
 
             for (int v : vizinhos) {
+                contagem.arestaExaminada();
                 if (!visitado[v]) {
                     // Bloco 8: Adicionar v em P
                     pilha.push({ v, u }); // Adicionamos o vizinho e quem o descobriu (seu pai, u)
+                    contagem.insercaoHeap();
                 }
             }
         }
+        else {
+            contagem.remocaoObsoleta(); // u j tinha sido marcado por outro caminho
+        }
     }
+    resultado.operacoes = contagem.obter();
     return resultado;
-}
\ No newline at end of file
+}
+
+// Instncias usadas pela biblioteca e pelos estudos (a implementao fica neste arquivo)
+template ResultadoDFS DFS::executar<SemContagem>(const Grafo&, int) const;
+template ResultadoDFS DFS::executar<ComContagem>(const Grafo&, int) const;
\ No newline at end of file
@@ -10,6 +10,8 @@ class Grafo;
 
 #include <vector>
 
+#include "../../../comum/ContagemOperacoes.h"
+
 /**
  * @struct ResultadoDFS
  * @brief Armazena o resultado de uma execuo da Busca em Profundidade (DFS).
@@ -17,6 +19,7 @@ class Grafo;
 struct ResultadoDFS {
     std::vector<int> pai;   // pai[v] = antecessor de v na rvore de busca
     std::vector<int> nivel; // nivel[v] = profundidade de v na rvore de busca
+    ContadoresOperacoes operacoes; // Preenchido s com a poltica ComContagem
 };
 
 /**
@@ -29,7 +32,11 @@ public:
      * @brief Executa a busca em profundidade iterativa usando uma pilha explcita.
      * @param grafo O grafo (constante) sobre o qual a busca ser executada.
      * @param verticeOrigem O vrtice inicial da busca.
+     * @tparam Contagem SemContagem (padro) ou ComContagem. Contagens: vrtices marcados
+     * (verticesFinalizados), arestas examinadas, empilhamentos (insercoesHeap) e retiradas
+     * de vrtices j marcados (remocoesObsoletas).
      * @return Um struct ResultadoDFS com a rvore de busca.
      */
+    template <class Contagem = SemContagem>
     ResultadoDFS executar(const Grafo& grafo, int verticeOrigem) const;
 };
\ No newline at end of file
@@ -0,0 +1,204 @@
+/**
+ * @file HyperANF.cpp
+ * @brief Implementação da classe HyperANF.
+ */
+#include "HyperANF.h"
+#include "../../biblioteca/interface/Grafo.h"
+#include "../utilitarios/VisaoCSR.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+    // Menor quantidade de vértices por bloco que compensa dividir o trabalho entre threads
+    const int VERTICES_POR_BLOCO = 1 << 12;
+
+    /**
+     * @brief Mistura de 64 bits (splitmix64): espalha ids consecutivos por todos os bits.
+     */
+    inline uint64_t misturar(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief destino[j] = max(destino[j], origem[j]) para os m registradores (união HLL).
+     */
+    inline void unirRegistradores(uint8_t* destino, const uint8_t* origem, int m) {
+        int j = 0;
+#if defined(__AVX512BW__)
+        for (; j + 64 <= m; j += 64) {
+            __m512i a = _mm512_loadu_si512(destino + j);
+            __m512i b = _mm512_loadu_si512(origem + j);
+            _mm512_storeu_si512(destino + j, _mm512_max_epu8(a, b));
+        }
+#endif
+#if defined(__AVX2__)
+        for (; j + 32 <= m; j += 32) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destino + j));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origem + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino + j), _mm256_max_epu8(a, b));
+        }
+#endif
+        for (; j < m; ++j) destino[j] = std::max(destino[j], origem[j]);
+    }
+
+    /**
+     * @brief Estimativa HyperLogLog da cardinalidade (com a correção para contagens pequenas).
+     */
+    double estimarCardinalidade(const uint8_t* registradores, int m, double alfaMM, const double* potenciaInversa) {
+        double soma = 0.0;
+        int zeros = 0;
+        for (int j = 0; j < m; ++j) {
+            soma += potenciaInversa[registradores[j]];
+            zeros += (registradores[j] == 0);
+        }
+        double estimativa = alfaMM / soma;
+        if (estimativa <= 2.5 * m && zeros > 0) {
+            estimativa = m * std::log(static_cast<double>(m) / zeros); // Contagem linear
+        }
+        return estimativa;
+    }
+
+} // namespace
+
+double ResultadoHyperANF::diametroEfetivo(double fracao) const {
+    double total = 0.0;
+    for (size_t t = 1; t < distribuicao.size(); ++t) total += distribuicao[t];
+    if (total <= 0.0) return 0.0;
+
+    // Interpola entre t - 1 e t dentro do nível em que a fração acumulada é atingida
+    const double alvo = fracao * total;
+    double acumulado = 0.0;
+    for (size_t t = 1; t < distribuicao.size(); ++t) {
+        if (acumulado + distribuicao[t] >= alvo) {
+            return (t - 1) + (alvo - acumulado) / distribuicao[t];
+        }
+        acumulado += distribuicao[t];
+    }
+    return static_cast<double>(distribuicao.size() - 1);
+}
+
+ResultadoHyperANF HyperANF::executar(const Grafo& grafo, int log2Registradores,
+    const ControleExecucao& controle, unsigned long long semente) const {
+    if (log2Registradores < 4 || log2Registradores > 16) {
+        throw std::runtime_error("HyperANF: log2Registradores deve estar entre 4 e 16.");
+    }
+    const int n = grafo.obterNumeroVertices();
+    const int b = log2Registradores;
+    const int m = 1 << b;
+    const double alfa = (m == 16) ? 0.673 : (m == 32) ? 0.697 : (m == 64) ? 0.709 : 0.7213 / (1.0 + 1.079 / m);
+    const double alfaMM = alfa * m * m;
+    double potenciaInversa[66];
+    for (int k = 0; k < 66; ++k) potenciaInversa[k] = std::ldexp(1.0, -k);
+
+    ResultadoHyperANF resultado;
+    resultado.alcance.assign(static_cast<size_t>(n) + 1, 0.0);
+    resultado.somaDistancias.assign(static_cast<size_t>(n) + 1, 0.0);
+    resultado.proximidade.assign(static_cast<size_t>(n) + 1, 0.0);
+    resultado.distribuicao.assign(1, 0.0);
+    if (n == 0) {
+        resultado.funcaoVizinhanca.assign(1, 0.0);
+        return resultado;
+    }
+
+    const VisaoCSR csr(grafo);
+    const size_t tamanho = static_cast<size_t>(n + 1) * m;
+    std::vector<uint8_t> atual(tamanho, 0), proximo(tamanho, 0);
+
+    // 1. Cada contador começa com o próprio vértice
+    for (int v = 1; v <= n; ++v) {
+        const uint64_t h = misturar(static_cast<uint64_t>(v) ^ misturar(semente));
+        const int indice = static_cast<int>(h >> (64 - b));
+        const uint64_t resto = (h << b) | (uint64_t(1) << (b - 1)); // Sentinela: limita o rho
+        atual[static_cast<size_t>(v) * m + indice] = static_cast<uint8_t>(std::countl_zero(resto) + 1);
+    }
+    std::memcpy(proximo.data(), atual.data(), tamanho);
+
+    std::vector<uint8_t> mudouAnterior(static_cast<size_t>(n) + 1, 1), mudouAtual(static_cast<size_t>(n) + 1, 0);
+    double somaEstimativas = 0.0;
+    for (int v = 1; v <= n; ++v) {
+        resultado.alcance[v] = estimarCardinalidade(&atual[static_cast<size_t>(v) * m], m, alfaMM, potenciaInversa);
+        somaEstimativas += resultado.alcance[v];
+    }
+    resultado.funcaoVizinhanca.push_back(somaEstimativas);
+
+    const int numThreads = (controle.numThreads <= 0) ? obterNumeroThreadsPadrao() : controle.numThreads;
+    const int numBlocos = std::max(1, (n + VERTICES_POR_BLOCO - 1) / VERTICES_POR_BLOCO);
+    auto inicioBloco = [&](int bloco) { return 1 + static_cast<int>(static_cast<long long>(n) * bloco / numBlocos); };
+    std::vector<double> variacaoPorBloco(numBlocos);
+    std::vector<int> mudaramPorBloco(numBlocos);
+
+    // 2. Iterações: B(v, t) = B(v, t-1) U B(u, t-1), só com os vizinhos que mudaram em t-1
+    for (int t = 1;; ++t) {
+        if (controle.cancelar && controle.cancelar->load(std::memory_order_relaxed)) {
+            throw std::runtime_error("HyperANF: execucao cancelada.");
+        }
+
+        // 2a. União em 'proximo' (lendo só 'atual', então os blocos são independentes)
+        executarEmParalelo(numBlocos, numThreads, [&](int bloco, int) {
+            int mudaram = 0;
+            for (int v = inicioBloco(bloco); v < inicioBloco(bloco + 1); ++v) {
+                uint8_t* destino = &proximo[static_cast<size_t>(v) * m];
+                bool tocado = false;
+                for (int i = csr.ponteiros[v]; i < csr.ponteiros[v + 1]; ++i) {
+                    const int u = csr.vizinhos[i];
+                    if (!mudouAnterior[u]) continue;
+                    unirRegistradores(destino, &atual[static_cast<size_t>(u) * m], m);
+                    tocado = true;
+                }
+                const bool mudou = tocado && std::memcmp(destino, &atual[static_cast<size_t>(v) * m], m) != 0;
+                mudouAtual[v] = mudou;
+                mudaram += mudou;
+            }
+            mudaramPorBloco[bloco] = mudaram;
+        });
+
+        int totalMudaram = 0;
+        for (int c : mudaramPorBloco) totalMudaram += c;
+        if (totalMudaram == 0) break;
+
+        // 2b. Copia os contadores que mudaram para 'atual' e atualiza as estimativas:
+        // os vértices que entraram em B(v, t) estão a distância t de v
+        executarEmParalelo(numBlocos, numThreads, [&](int bloco, int) {
+            double variacao = 0.0;
+            for (int v = inicioBloco(bloco); v < inicioBloco(bloco + 1); ++v) {
+                if (!mudouAtual[v]) continue;
+                uint8_t* registradores = &atual[static_cast<size_t>(v) * m];
+                std::memcpy(registradores, &proximo[static_cast<size_t>(v) * m], m);
+                const double estimativa = estimarCardinalidade(registradores, m, alfaMM, potenciaInversa);
+                const double novos = std::max(0.0, estimativa - resultado.alcance[v]);
+                resultado.somaDistancias[v] += t * novos;
+                resultado.alcance[v] = std::max(resultado.alcance[v], estimativa);
+                variacao += novos;
+            }
+            variacaoPorBloco[bloco] = variacao;
+        });
+
+        double variacaoTotal = 0.0;
+        for (double d : variacaoPorBloco) variacaoTotal += d;
+        somaEstimativas += variacaoTotal;
+        resultado.funcaoVizinhanca.push_back(somaEstimativas);
+        resultado.distribuicao.push_back(variacaoTotal / 2.0);
+        resultado.iteracoes = t;
+        mudouAnterior.swap(mudouAtual);
+
+        if (controle.progresso) controle.progresso(t, 0);
+    }
+
+    for (int v = 1; v <= n; ++v) {
+        const double outros = resultado.alcance[v] - 1.0;
+        resultado.proximidade[v] = (resultado.somaDistancias[v] > 0.0) ? std::max(0.0, outros) / resultado.somaDistancias[v] : 0.0;
+    }
+    return resultado;
+}
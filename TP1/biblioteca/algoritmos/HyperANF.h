@@ -0,0 +1,61 @@
+#pragma once
+/**
+ * @file HyperANF.h
+ * @brief Definição da classe HyperANF (função de vizinhança aproximada com contadores HyperLogLog).
+ * * O algoritmo HyperANF / HyperBall:
+ * - Cada vértice v tem um contador HyperLogLog (m = 2^b registradores de 1 byte) que
+ *   estima |B(v, t)|, o número de vértices a distância <= t de v.
+ * - B(v, t) = B(v, t-1) U B(u, t-1) para todo vizinho u: a união de contadores HLL é o
+ *   máximo registrador a registrador (feito com instruções SIMD de 32/64 bytes).
+ * - Só os vizinhos que mudaram na iteração anterior podem trazer informação nova, então
+ *   as últimas iterações (poucos contadores ainda mudando) custam pouco.
+ * - Somando as estimativas obtém-se N(t) = número de pares a distância <= t, de onde saem
+ *   a distribuição de distâncias, o diâmetro efetivo e a proximidade de cada vértice.
+ * - Memória: 2 x V x m bytes (fixa, independente de t); erro relativo de cada contador
+ *   em torno de 1.04 / sqrt(m). Todos os contadores usam a mesma função de hash, então
+ *   os erros são correlacionados e N(t) tem aproximadamente o erro de um contador: para
+ *   reduzi-lo, aumente b ou tire a média de execuções com sementes diferentes.
+ */
+
+#include <vector>
+#include "../../../comum/Paralelo.h"
+
+class Grafo;
+
+/**
+ * @struct ResultadoHyperANF
+ * @brief Estimativas produzidas pelo HyperANF.
+ */
+struct ResultadoHyperANF {
+    int iteracoes = 0;                  // Número de iterações até nenhum contador mudar (~ maior excentricidade)
+    std::vector<double> funcaoVizinhanca; // funcaoVizinhanca[t] ~ pares ordenados (u, v) com d(u, v) <= t (inclui u = v)
+    std::vector<double> distribuicao;   // distribuicao[t] ~ pares não ordenados {u, v} à distância t (distribuicao[0] = 0)
+    std::vector<double> alcance;        // alcance[v] ~ vértices alcançáveis a partir de v, incluindo v
+    std::vector<double> somaDistancias; // somaDistancias[v] ~ soma das distâncias de v aos vértices alcançáveis
+    std::vector<double> proximidade;    // proximidade[v] = (alcance - 1) / somaDistancias (0 se v for isolado)
+
+    /**
+     * @brief Diâmetro efetivo: menor distância (interpolada) que cobre a fração pedida dos pares alcançáveis.
+     * @param fracao Fração dos pares (0.9 é o valor usual).
+     */
+    double diametroEfetivo(double fracao = 0.9) const;
+};
+
+/**
+ * @class HyperANF
+ * @brief Estima a função de vizinhança do grafo com contadores HyperLogLog.
+ */
+class HyperANF {
+public:
+    /**
+     * @brief Executa as iterações até que nenhum contador mude.
+     * @param grafo O grafo (não direcionado).
+     * @param log2Registradores b, com m = 2^b registradores por vértice (entre 4 e 16).
+     * @param controle Threads, progresso (iterações concluídas; total 0 = desconhecido) e cancelamento.
+     * @param semente Semente da função de hash (execuções com sementes diferentes são independentes).
+     * @return As estimativas (vetores por vértice com V+1 posições, índice 0 sem uso).
+     * @throws std::runtime_error se log2Registradores estiver fora do intervalo ou a execução for cancelada.
+     */
+    ResultadoHyperANF executar(const Grafo& grafo, int log2Registradores = 6,
+        const ControleExecucao& controle = {}, unsigned long long semente = 0) const;
+};
@@ -0,0 +1,262 @@
+/**
+ * @file MSBFS.cpp
+ * @brief Implementação da classe MSBFS.
+ */
+#include "MSBFS.h"
+#include "../../biblioteca/interface/Grafo.h"
+#include "../../../comum/Paralelo.h"
+#include "../utilitarios/VisaoCSR.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    // Palavras de 64 bits por máscara: uma máscara ocupa um registrador SIMD inteiro
+#if defined(__AVX512F__)
+    constexpr int PALAVRAS_MASCARA = 8;
+#elif defined(__AVX2__)
+    constexpr int PALAVRAS_MASCARA = 4;
+#else
+    constexpr int PALAVRAS_MASCARA = 1;
+#endif
+    constexpr int BITS_MASCARA = 64 * PALAVRAS_MASCARA;
+
+    /**
+     * @brief Um bit por origem do lote. As operações são laços fixos sobre as palavras,
+     * que o compilador transforma em uma instrução vetorial.
+     */
+    struct alignas(8 * PALAVRAS_MASCARA) Mascara {
+        uint64_t palavra[PALAVRAS_MASCARA];
+    };
+
+    inline bool vazia(const Mascara& m) {
+        uint64_t ou = 0;
+        for (int w = 0; w < PALAVRAS_MASCARA; ++w) ou |= m.palavra[w];
+        return ou == 0;
+    }
+
+    /**
+     * @brief Buffers de uma thread, reaproveitados entre os lotes.
+     */
+    struct BuffersLote {
+        std::vector<Mascara> visto, visita, proxima;
+    };
+
+    /**
+     * @brief Chama fn(i) para cada bit i ligado na máscara.
+     */
+    template <class Funcao>
+    inline void paraCadaBit(const Mascara& m, Funcao&& fn) {
+        for (int w = 0; w < PALAVRAS_MASCARA; ++w) {
+            for (uint64_t x = m.palavra[w]; x != 0; x &= x - 1) fn(w * 64 + std::countr_zero(x));
+        }
+    }
+
+    /**
+     * @brief Executa as buscas de um lote de até BITS_MASCARA origens.
+     * @details Por nível: (1) cada vértice da fronteira lê seus vizinhos uma vez e
+     * propaga sua máscara para 'proxima'; (2) uma passada por todos os vértices separa
+     * os bits novos (proxima & ~visto), que formam a fronteira seguinte.
+     * O visitante recebe visitante.vertice(v, nivel, novos) para cada vértice alcançado
+     * por alguma origem do lote naquele nível (novos = bits dessas origens) e
+     * visitante.fimNivel(nivel) ao final de cada nível.
+     */
+    template <class Visitante>
+    void executarLote(const int* ponteiros, const int* vizinhos, int numVertices,
+        const int* origens, int quantidade, int nivelMaximo, const std::atomic<bool>* cancelar,
+        BuffersLote& b, Visitante&& visitante) {
+        const Mascara zero{};
+        b.visto.assign(static_cast<size_t>(numVertices) + 1, zero);
+        b.visita.assign(static_cast<size_t>(numVertices) + 1, zero);
+        b.proxima.assign(static_cast<size_t>(numVertices) + 1, zero);
+
+        for (int i = 0; i < quantidade; ++i) {
+            Mascara unitaria{};
+            unitaria.palavra[i / 64] = uint64_t(1) << (i % 64);
+            for (int w = 0; w < PALAVRAS_MASCARA; ++w) {
+                b.visto[origens[i]].palavra[w] |= unitaria.palavra[w];
+                b.visita[origens[i]].palavra[w] |= unitaria.palavra[w];
+            }
+            visitante.vertice(origens[i], 0, unitaria);
+        }
+        visitante.fimNivel(0);
+
+        bool ativo = true;
+        for (int nivel = 1; ativo && (nivelMaximo < 0 || nivel <= nivelMaximo); ++nivel) {
+            if (cancelar && cancelar->load(std::memory_order_relaxed)) {
+                throw std::runtime_error("MSBFS: execucao cancelada.");
+            }
+
+            // 1. Expansão: uma leitura da lista de u serve a todas as origens de visita[u]
+            for (int u = 1; u <= numVertices; ++u) {
+                const Mascara& mu = b.visita[u];
+                if (vazia(mu)) continue;
+                for (int i = ponteiros[u]; i < ponteiros[u + 1]; ++i) {
+                    Mascara& mv = b.proxima[vizinhos[i]];
+                    for (int w = 0; w < PALAVRAS_MASCARA; ++w) mv.palavra[w] |= mu.palavra[w];
+                }
+            }
+
+            // 2. Bits novos: viram a fronteira do próximo nível
+            ativo = false;
+            for (int v = 1; v <= numVertices; ++v) {
+                Mascara& p = b.proxima[v];
+                Mascara& vis = b.visita[v];
+                Mascara& vi = b.visto[v];
+                uint64_t algum = 0;
+                for (int w = 0; w < PALAVRAS_MASCARA; ++w) {
+                    const uint64_t novo = p.palavra[w] & ~vi.palavra[w];
+                    vi.palavra[w] |= novo;
+                    vis.palavra[w] = novo;
+                    p.palavra[w] = 0;
+                    algum |= novo;
+                }
+                if (algum == 0) continue;
+                ativo = true;
+                visitante.vertice(v, nivel, vis);
+            }
+            if (ativo) visitante.fimNivel(nivel);
+        }
+    }
+
+    /**
+     * @brief Valida as origens e distribui os lotes entre as threads.
+     * @param csr Visão CSR de 'grafo'.
+     */
+    template <class ProcessarLote>
+    void distribuirLotes(const Grafo& grafo, const VisaoCSR& csr, const std::vector<int>& origens,
+        const ControleExecucao& controle, ProcessarLote&& processar) {
+        const int n = grafo.obterNumeroVertices();
+        for (int origem : origens) {
+            if (origem <= 0 || origem > n) {
+                throw std::runtime_error("Vertice de origem invalido em MSBFS: " + std::to_string(origem));
+            }
+        }
+        if (origens.empty()) return;
+
+        const int numLotes = static_cast<int>((origens.size() + BITS_MASCARA - 1) / BITS_MASCARA);
+        int numThreads = (controle.numThreads <= 0) ? obterNumeroThreadsPadrao() : controle.numThreads;
+        numThreads = std::max(1, std::min(numThreads, numLotes));
+        std::vector<BuffersLote> buffers(numThreads);
+
+        // Progresso: origens concluídas, informado ao fim de cada lote
+        long long concluidas = 0;
+        std::mutex mutexProgresso;
+
+        executarEmParalelo(numLotes, numThreads, [&](int lote, int idThread) {
+            const int inicio = lote * BITS_MASCARA;
+            const int quantidade = std::min(BITS_MASCARA, static_cast<int>(origens.size()) - inicio);
+            processar(csr.ponteiros, csr.vizinhos, n, inicio, quantidade, idThread, buffers[idThread]);
+            if (controle.progresso) {
+                std::lock_guard<std::mutex> trava(mutexProgresso);
+                concluidas += quantidade;
+                controle.progresso(concluidas, static_cast<long long>(origens.size()));
+            }
+        });
+    }
+
+} // namespace
+
+int MSBFS::origensPorLote() {
+    return BITS_MASCARA;
+}
+
+std::vector<std::vector<int>> MSBFS::calcularNiveis(const Grafo& grafo, const std::vector<int>& origens, int numThreads) const {
+    const int n = grafo.obterNumeroVertices();
+    std::vector<std::vector<int>> niveis(origens.size());
+    ControleExecucao controle;
+    controle.numThreads = numThreads;
+
+    distribuirLotes(grafo, VisaoCSR(grafo), origens, controle,
+        [&](const int* ponteiros, const int* vizinhos, int numVertices, int inicio, int quantidade, int, BuffersLote& b) {
+            struct Visitante {
+                std::vector<int>* niveis;
+                void vertice(int v, int nivel, const Mascara& novos) {
+                    paraCadaBit(novos, [&](int i) { niveis[i][v] = nivel; });
+                }
+                void fimNivel(int) {}
+            };
+            for (int i = 0; i < quantidade; ++i) niveis[inicio + i].assign(static_cast<size_t>(n) + 1, -1);
+            executarLote(ponteiros, vizinhos, numVertices, origens.data() + inicio, quantidade, -1, nullptr, b,
+                Visitante{ niveis.data() + inicio });
+        });
+    return niveis;
+}
+
+std::vector<EstatisticasBFSOrigem> MSBFS::calcularEstatisticas(const Grafo& grafo, const std::vector<int>& origens,
+    int nivelMaximo, int numThreads) const {
+    return calcularEstatisticas(grafo, VisaoCSR(grafo), origens, nivelMaximo, numThreads);
+}
+
+std::vector<EstatisticasBFSOrigem> MSBFS::calcularEstatisticas(const Grafo& grafo, const VisaoCSR& csr,
+    const std::vector<int>& origens, int nivelMaximo, int numThreads) const {
+    std::vector<EstatisticasBFSOrigem> estatisticas(origens.size());
+    for (size_t i = 0; i < origens.size(); ++i) estatisticas[i].origem = origens[i];
+
+    ControleExecucao controle;
+    controle.numThreads = numThreads;
+
+    distribuirLotes(grafo, csr, origens, controle,
+        [&](const int* ponteiros, const int* vizinhos, int numVertices, int inicio, int quantidade, int, BuffersLote& b) {
+            struct Visitante {
+                EstatisticasBFSOrigem* lote;
+                void vertice(int, int nivel, const Mascara& novos) {
+                    paraCadaBit(novos, [&](int i) {
+                        lote[i].alcancados++;
+                        lote[i].somaDistancias += nivel;
+                        lote[i].excentricidade = nivel; // Os níveis chegam em ordem crescente
+                    });
+                }
+                void fimNivel(int) {}
+            };
+            executarLote(ponteiros, vizinhos, numVertices, origens.data() + inicio, quantidade, nivelMaximo, nullptr, b,
+                Visitante{ estatisticas.data() + inicio });
+        });
+    return estatisticas;
+}
+
+void MSBFS::calcularExcentricidadesEDistribuicao(const Grafo& grafo, const std::vector<int>& origens,
+    std::vector<int>& excentricidades, std::vector<long long>& distribuicao, const ControleExecucao& controle) const {
+    excentricidades.assign(origens.size(), 0);
+    distribuicao.clear();
+
+    // Histogramas por thread, somados no final (sem travas nem atômicos no laço)
+    const int numThreads = (controle.numThreads <= 0) ? obterNumeroThreadsPadrao() : controle.numThreads;
+    std::vector<std::vector<long long>> histogramas(std::max(1, numThreads));
+
+    distribuirLotes(grafo, VisaoCSR(grafo), origens, controle,
+        [&](const int* ponteiros, const int* vizinhos, int numVertices, int inicio, int quantidade, int idThread, BuffersLote& b) {
+            // Por nível: popcount dos bits novos vai para o histograma; a união dos bits novos
+            // diz quais origens ainda alcançaram alguém (a excentricidade é o último nível delas)
+            struct Visitante {
+                int* excentricidades;
+                std::vector<long long>& histograma;
+                Mascara alcancaramNoNivel{};
+                long long paresNoNivel = 0;
+                void vertice(int, int, const Mascara& novos) {
+                    for (int w = 0; w < PALAVRAS_MASCARA; ++w) {
+                        alcancaramNoNivel.palavra[w] |= novos.palavra[w];
+                        paresNoNivel += std::popcount(novos.palavra[w]);
+                    }
+                }
+                void fimNivel(int nivel) {
+                    if (static_cast<int>(histograma.size()) <= nivel) histograma.resize(static_cast<size_t>(nivel) + 1, 0);
+                    histograma[nivel] += paresNoNivel;
+                    paraCadaBit(alcancaramNoNivel, [&](int i) { excentricidades[i] = nivel; });
+                    alcancaramNoNivel = Mascara{};
+                    paresNoNivel = 0;
+                }
+            };
+            executarLote(ponteiros, vizinhos, numVertices, origens.data() + inicio, quantidade, -1, controle.cancelar, b,
+                Visitante{ excentricidades.data() + inicio, histogramas[idThread] });
+        });
+
+    for (const std::vector<long long>& h : histogramas) {
+        if (h.size() > distribuicao.size()) distribuicao.resize(h.size(), 0);
+        for (size_t d = 0; d < h.size(); ++d) distribuicao[d] += h[d];
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+/**
+ * @file MSBFS.h
+ * @brief Definição da classe MSBFS (várias buscas em largura simultâneas, com máscaras de bits).
+ * * A BFS de múltiplas origens (MS-BFS):
+ * - Cada vértice guarda três máscaras com um bit por origem do lote: 'visto' (a origem
+ *   já alcançou o vértice), 'visita' (fronteira atual) e 'proxima' (próxima fronteira).
+ * - A cada nível, a lista de vizinhos de um vértice da fronteira é lida uma única vez e
+ *   propagada para todas as origens daquele vértice com um OU de máscaras.
+ * - Um lote tem 64 origens por palavra de 64 bits: 64 (escalar), 256 (AVX2) ou 512 (AVX-512).
+ * - Complexidade por lote: O(D * (V + E)) no pior caso (D = número de níveis), contra
+ *   O(lote * (V + E)) de uma BFS por origem.
+ */
+
+#include <vector>
+#include "../../../comum/Paralelo.h"
+
+class Grafo;
+struct VisaoCSR;
+
+/**
+ * @struct EstatisticasBFSOrigem
+ * @brief Resumo das distâncias a partir de uma origem (sem guardar o vetor de níveis).
+ * @details A proximidade (closeness) da origem é (alcancados - 1) / somaDistancias.
+ */
+struct EstatisticasBFSOrigem {
+    int origem = 0;
+    int alcancados = 0;          // Vértices alcançados, incluindo a própria origem
+    long long somaDistancias = 0; // Soma das distâncias até os vértices alcançados
+    int excentricidade = 0;      // Maior distância até um vértice alcançado
+};
+
+/**
+ * @class MSBFS
+ * @brief Executa várias buscas em largura ao mesmo tempo sobre um objeto Grafo.
+ * @details Na representação CSR os vetores do grafo são lidos diretamente; nas demais,
+ * uma cópia CSR é montada uma vez por chamada. Os lotes são distribuídos entre as
+ * threads; cada thread usa três máscaras por vértice (memória O(threads * V * lote / 8)).
+ */
+class MSBFS {
+public:
+    /**
+     * @brief Número de origens processadas juntas em um lote (64, 256 ou 512).
+     */
+    static int origensPorLote();
+
+    /**
+     * @brief Calcula o vetor de níveis de cada origem.
+     * @param grafo O grafo sobre o qual as buscas serão executadas.
+     * @param origens Vértices de origem (1-based; podem se repetir).
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * @return niveis[i][v] = distância de origens[i] até v (-1 se inalcançável), com V+1 posições.
+     * @throws std::runtime_error se alguma origem for inválida.
+     */
+    std::vector<std::vector<int>> calcularNiveis(const Grafo& grafo, const std::vector<int>& origens, int numThreads = 0) const;
+
+    /**
+     * @brief Calcula, para cada origem, quantos vértices alcança e a soma/máximo das distâncias.
+     * @param grafo O grafo sobre o qual as buscas serão executadas.
+     * @param origens Vértices de origem (1-based; podem se repetir).
+     * @param nivelMaximo Se >= 0, as buscas param nesse nível (vizinhança de k saltos).
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * @return Um EstatisticasBFSOrigem por origem, na mesma ordem de 'origens'.
+     * @throws std::runtime_error se alguma origem for inválida.
+     */
+    std::vector<EstatisticasBFSOrigem> calcularEstatisticas(const Grafo& grafo, const std::vector<int>& origens,
+        int nivelMaximo = -1, int numThreads = 0) const;
+
+    /**
+     * @brief Igual à anterior, mas sobre uma visão CSR já montada de 'grafo' (evita
+     * montar uma cópia por chamada quando os lotes são pedidos aos poucos).
+     */
+    std::vector<EstatisticasBFSOrigem> calcularEstatisticas(const Grafo& grafo, const VisaoCSR& csr,
+        const std::vector<int>& origens, int nivelMaximo = -1, int numThreads = 0) const;
+
+    /**
+     * @brief Calcula a excentricidade de cada origem e o histograma das distâncias.
+     * @details Não percorre os bits individualmente: por vértice e nível, o histograma
+     * soma o popcount dos bits novos; a excentricidade sai da união desses bits por nível.
+     * Cada thread acumula seu próprio histograma, e eles são somados ao final.
+     * @param grafo O grafo sobre o qual as buscas serão executadas.
+     * @param origens Vértices de origem (1-based).
+     * @param excentricidades Saída: excentricidades[i] = maior distância de origens[i] até
+     * um vértice alcançável.
+     * @param distribuicao Saída: distribuicao[d] = número de pares (origem, v) à distância d.
+     * @param controle Threads, progresso (em origens concluídas) e cancelamento.
+     * @throws std::runtime_error se alguma origem for inválida ou a execução for cancelada.
+     */
+    void calcularExcentricidadesEDistribuicao(const Grafo& grafo, const std::vector<int>& origens,
+        std::vector<int>& excentricidades, std::vector<long long>& distribuicao, const ControleExecucao& controle = {}) const;
+};
@@ -8,6 +8,8 @@
 #include "../representacao/MatrizAdjacenciaTriangular.h"
 #include "../representacao/ListaAdjacencia.h"
 #include "../representacao/ListaAdjacenciaSimples.h"
+#include "../../../comum/Paralelo.h"
+#include "../utilitarios/VisaoCSR.h"
  // #include "../representacao/ListaAdjacencia.h" // Ser includo no futuro
 #include <fstream>   // Para leitura de arquivos (ifstream)
 #include <stdexcept> // Para lanar excees (runtime_error)
@@ -15,11 +17,38 @@
 #include <vector>
 #include <random>
 #include <ostream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+ /**
+ * @brief Cria a representao interna escolhida (padro de design "Strategy").
+ */
+static std::unique_ptr<Representacao> criarRepresentacao(TipoRepresentacao tipo, int numeroVertices) {
+    switch (tipo) {
+    case TipoRepresentacao::MATRIZ_ADJACENCIA:
+        return std::make_unique<MatrizAdjacencia>(numeroVertices);
+    case TipoRepresentacao::LISTA_ADJACENCIA:
+        return std::make_unique<ListaAdjacencia>(numeroVertices);
+    case TipoRepresentacao::MATRIZ_ADJACENCIA_TRIANGULAR:
+        return std::make_unique<MatrizAdjacenciaTriangular>(numeroVertices);
+    case TipoRepresentacao::LISTA_ADJACENCIA_SIMPLES:
+        return std::make_unique<ListaAdjacenciaSimples>(numeroVertices);
+    default:
+        throw std::invalid_argument("Tipo de representacao desconhecido.");
+    }
+}
 
  /**
  * @brief Construtor da classe Grafo.
  */
-Grafo::Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo) {
+Grafo::Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo,
+    const std::function<void(FaseCarga, const Grafo&)>& aoConcluirFase) {
     // Bloco: Abertura e validao do arquivo de entrada
     std::ifstream arquivo(caminhoArquivo);
     if (!arquivo.is_open()) {
@@ -34,24 +63,7 @@ Grafo::Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo) {
 
     // Bloco: Criao da representao interna com base na escolha do usurio
     // Este  o ponto central que usa o padro de design "Strategy".
-    switch (tipo) {
-    case TipoRepresentacao::MATRIZ_ADJACENCIA:
-        // Cria um objeto MatrizAdjacencia e o move para o ponteiro inteligente.
-        representacaoInterna = std::make_unique<MatrizAdjacencia>(this->numeroDeVertices);
-        break;
-    case TipoRepresentacao::LISTA_ADJACENCIA:
-        // Lana um erro claro se a funcionalidade ainda no foi implementada.
-        representacaoInterna = std::make_unique<ListaAdjacencia>(this->numeroDeVertices);
-        break;
-    case TipoRepresentacao::MATRIZ_ADJACENCIA_TRIANGULAR:
-        representacaoInterna = std::make_unique<MatrizAdjacenciaTriangular>(this->numeroDeVertices);
-        break;
-    case TipoRepresentacao::LISTA_ADJACENCIA_SIMPLES: // <-- Adicionar este novo caso
-        representacaoInterna = std::make_unique<ListaAdjacenciaSimples>(this->numeroDeVertices);
-        break;
-    default:
-        throw std::invalid_argument("Tipo de representacao desconhecido.");
-    }
+    representacaoInterna = criarRepresentacao(tipo, this->numeroDeVertices);
 
     // Bloco: Leitura das arestas do arquivo
     int u, v;
@@ -62,6 +74,7 @@ Grafo::Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo) {
         representacaoInterna->adicionarAresta(u, v);
         this->numeroDeArestas++; // Incrementa o contador de arestas
     }
+    if (aoConcluirFase) aoConcluirFase(FaseCarga::LEITURA, *this);
 
     // Aps ler todas as arestas, chamamos o mtodo para construir a estrutura final.
     // Para a MatrizAdjacencia, isso no far nada. Para a ListaAdjacencia, far tudo.
@@ -77,9 +90,33 @@ Grafo::Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo) {
     this->numeroDeArestas = 0;
     while (std::getline(arquivo, linha)) this->numeroDeArestas++;
 
+    if (aoConcluirFase) aoConcluirFase(FaseCarga::FINALIZACAO, *this);
+
     // O arquivo  fechado automaticamente quando 'arquivo' sai de escopo.
 }
 
+/**
+ * @brief Construtor a partir de arestas em memria.
+ */
+Grafo::Grafo(int numeroVertices, std::vector<std::pair<int, int>> arestas, TipoRepresentacao tipo,
+    const std::function<void(FaseCarga, const Grafo&)>& aoConcluirFase)
+    : numeroDeVertices(numeroVertices), numeroDeArestas(0) {
+    if (numeroVertices <= 0) {
+        throw std::runtime_error("Numero de vertices invalido: " + std::to_string(numeroVertices));
+    }
+    if (arestas.size() > static_cast<size_t>(INT_MAX)) {
+        throw std::runtime_error("Arestas demais para o contador do grafo: " + std::to_string(arestas.size()));
+    }
+    this->numeroDeArestas = static_cast<int>(arestas.size());
+
+    representacaoInterna = criarRepresentacao(tipo, this->numeroDeVertices);
+    representacaoInterna->adicionarArestas(std::move(arestas));
+    if (aoConcluirFase) aoConcluirFase(FaseCarga::LEITURA, *this);
+
+    representacaoInterna->finalizarConstrucao();
+    if (aoConcluirFase) aoConcluirFase(FaseCarga::FINALIZACAO, *this);
+}
+
 /**
  * @brief Destrutor da classe Grafo.
  * @details O compilador gerar um destrutor padro que chama o destrutor de
@@ -89,6 +126,9 @@ Grafo::Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo) {
  */
 Grafo::~Grafo() = default;
 
+// Menor quantidade de vrtices por bloco que compensa dividir o trabalho entre threads
+static const int VERTICES_MINIMOS_POR_BLOCO = 1 << 14;
+
 // Implementaes dos outros mtodos (obterNumeroVertices, etc.)
 int Grafo::obterNumeroVertices() const {
     return this->numeroDeVertices;
@@ -98,6 +138,10 @@ int Grafo::obterNumeroArestas() const {
     return this->numeroDeArestas;
 }
 
+size_t Grafo::bytesUtilizados() const {
+    return sizeof(*this) + representacaoInterna->bytesUtilizados();
+}
+
 int Grafo::obterGrau(int vertice) const {
     // Delega a chamada para o objeto de representao
     return representacaoInterna->obterGrau(vertice);
@@ -108,6 +152,10 @@ std::vector<int> Grafo::obterVizinhos(int vertice) const {
     return representacaoInterna->obterVizinhos(vertice);
 }
 
+const ListaAdjacencia* Grafo::obterListaAdjacencia() const {
+    return dynamic_cast<const ListaAdjacencia*>(representacaoInterna.get());
+}
+
 /**
  * @brief Executa a Busca em Largura (BFS) a partir de um vrtice de origem.
  * @details Este mtodo atua como uma fachada (Facade). Ele instancia a classe
@@ -132,97 +180,118 @@ ResultadoDFS Grafo::executarDFS(int verticeOrigem) const {
     return algoritmoDFS.executar(*this, verticeOrigem);
 }
 
-/**
- * @brief Salva a rvore de busca (pai e nvel de cada vrtice) em um arquivo,
- * ORDENADA POR NVEL.
- * @details Coleta os dados de pai e nvel para todos os vrtices, ordena esses
- * dados com base no nvel (e depois por ID, como critrio de desempate), e
- * ento escreve o resultado ordenado no arquivo.
- */
-void Grafo::salvarArvoreBusca(const ResultadoBFS& resultado, const std::string& caminhoArquivo) const {
-    // Bloco 1: Abertura e verificao do arquivo
-    std::ofstream arquivo(caminhoArquivo);
-    if (!arquivo.is_open()) {
-        throw std::runtime_error("Nao foi possivel abrir o arquivo de saida: " + caminhoArquivo);
-    }
+namespace {
+
+    // Identificao do arquivo binrio de rvore de busca
+    const char ASSINATURA_ARVORE[4] = { 'G', 'A', 'R', 'V' };
+    const int32_t VERSAO_ARVORE = 1;
+
+    // Tamanho do buffer de texto: o arquivo  gravado em blocos deste tamanho
+    const size_t TAMANHO_BUFFER_ARVORE = 1 << 22;
+
+    /**
+     * @brief Grava a rvore (pai e nvel de cada vrtice alcanado) em texto ou binrio.
+     * @details Texto: ordenao por contagem estvel sobre o nvel (os ids j so
+     * percorridos em ordem crescente, ento o desempate por id sai de graa), e as
+     * linhas so formatadas com std::to_chars em um buffer grande.
+     * Binrio: os vetores pai e nivel de 1..V, sem ordenao.
+     */
+    void escreverArvoreBusca(const std::vector<int>& pai, const std::vector<int>& nivel, int numeroDeVertices,
+        const std::string& caminhoArquivo, FormatoArvore formato) {
+        std::ofstream arquivo(caminhoArquivo, std::ios::binary | std::ios::trunc);
+        if (!arquivo.is_open()) {
+            throw std::runtime_error("Nao foi possivel abrir o arquivo de saida: " + caminhoArquivo);
+        }
 
-    // Bloco 2: Coleta dos dados em uma estrutura temporria
-    // Isso  necessrio para que possamos ordenar antes de escrever.
-    struct InfoVertice {
-        int id;
-        int pai;
-        int nivel;
-    };
-    std::vector<InfoVertice> verticesParaOrdenar;
-    // Percorre todos os vrtices do grafo
-    for (int v = 1; v <= this->numeroDeVertices; ++v) {
-        // Adiciona  lista apenas os vrtices que foram alcanados pela busca
-        if (resultado.nivel[v] != -1) {
-            verticesParaOrdenar.push_back({ v, resultado.pai[v], resultado.nivel[v] });
+        if (formato == FormatoArvore::BINARIO) {
+            const int32_t n = numeroDeVertices;
+            arquivo.write(ASSINATURA_ARVORE, sizeof(ASSINATURA_ARVORE));
+            arquivo.write(reinterpret_cast<const char*>(&VERSAO_ARVORE), sizeof(VERSAO_ARVORE));
+            arquivo.write(reinterpret_cast<const char*>(&n), sizeof(n));
+            arquivo.write(reinterpret_cast<const char*>(pai.data() + 1), static_cast<std::streamsize>(n) * sizeof(int32_t));
+            arquivo.write(reinterpret_cast<const char*>(nivel.data() + 1), static_cast<std::streamsize>(n) * sizeof(int32_t));
         }
-    }
+        else {
+            // Bloco 1: Ordenao por contagem sobre o nvel (estvel, O(V + maior nvel))
+            int maiorNivel = -1;
+            for (int v = 1; v <= numeroDeVertices; ++v) maiorNivel = std::max(maiorNivel, nivel[v]);
+            std::vector<int> inicioNivel(static_cast<size_t>(maiorNivel) + 2, 0);
+            for (int v = 1; v <= numeroDeVertices; ++v) {
+                if (nivel[v] != -1) inicioNivel[nivel[v] + 1]++;
+            }
+            for (int k = 1; k <= maiorNivel + 1; ++k) inicioNivel[k] += inicioNivel[k - 1];
+            std::vector<int> ordem(static_cast<size_t>(inicioNivel[maiorNivel + 1]));
+            for (int v = 1; v <= numeroDeVertices; ++v) {
+                if (nivel[v] != -1) ordem[inicioNivel[nivel[v]]++] = v;
+            }
 
-    // Bloco 3: Ordenao do vetor temporrio
-    // Usamos std::sort com uma expresso lambda para definir nossa regra de ordenao.
-    std::sort(verticesParaOrdenar.begin(), verticesParaOrdenar.end(),
-        [](const InfoVertice& a, const InfoVertice& b) {
-            // Regra 1: O critrio principal  o nvel.
-            if (a.nivel != b.nivel) {
-                return a.nivel < b.nivel; // Ordena por nvel ascendente.
+            // Bloco 2: Formatao no buffer, gravado sempre que fica quase cheio
+            std::vector<char> buffer(TAMANHO_BUFFER_ARVORE);
+            char* cursor = buffer.data();
+            char* const limite = buffer.data() + buffer.size() - 40; // Espao para uma linha inteira
+            const char cabecalho[] = "Vertice,Pai,Nivel\n";
+            cursor = std::copy(cabecalho, cabecalho + sizeof(cabecalho) - 1, cursor);
+            for (int v : ordem) {
+                cursor = std::to_chars(cursor, limite + 40, v).ptr;
+                *cursor++ = ',';
+                cursor = std::to_chars(cursor, limite + 40, pai[v]).ptr;
+                *cursor++ = ',';
+                cursor = std::to_chars(cursor, limite + 40, nivel[v]).ptr;
+                *cursor++ = '\n';
+                if (cursor >= limite) {
+                    arquivo.write(buffer.data(), cursor - buffer.data());
+                    cursor = buffer.data();
+                }
             }
-            // Regra 2: Se os nveis forem iguais, usamos o ID do vrtice como desempate.
-            return a.id < b.id;
+            arquivo.write(buffer.data(), cursor - buffer.data());
         }
-    );
 
-    // Bloco 4: Escrita dos dados j ordenados no arquivo
-    arquivo << "Vertice,Pai,Nivel\n"; // Escreve o cabealho
-    for (const auto& info : verticesParaOrdenar) {
-        arquivo << info.id << "," << info.pai << "," << info.nivel << "\n";
+        if (!arquivo) {
+            throw std::runtime_error("Erro ao gravar o arquivo de saida: " + caminhoArquivo);
+        }
     }
+
+} // namespace
+
+/**
+ * @brief Salva a rvore de busca (pai e nvel de cada vrtice) em um arquivo,
+ * ORDENADA POR NVEL (no formato texto).
+ * @details Os vrtices alcanados so ordenados pelo nvel (e depois por ID, como
+ * critrio de desempate) com uma ordenao por contagem, em O(V).
+ */
+void Grafo::salvarArvoreBusca(const ResultadoBFS& resultado, const std::string& caminhoArquivo, FormatoArvore formato) const {
+    escreverArvoreBusca(resultado.pai, resultado.nivel, this->numeroDeVertices, caminhoArquivo, formato);
+}
+
+void Grafo::salvarArvoreBusca(const ResultadoDFS& resultado, const std::string& caminhoArquivo, FormatoArvore formato) const {
+    escreverArvoreBusca(resultado.pai, resultado.nivel, this->numeroDeVertices, caminhoArquivo, formato);
 }
 
-void Grafo::salvarArvoreBusca(const ResultadoDFS& resultado, const std::string& caminhoArquivo) const {
-    // Bloco 1: Abertura e verificao do arquivo
-    std::ofstream arquivo(caminhoArquivo);
+ResultadoBFS Grafo::lerArvoreBusca(const std::string& caminhoArquivo) {
+    std::ifstream arquivo(caminhoArquivo, std::ios::binary);
     if (!arquivo.is_open()) {
-        throw std::runtime_error("Nao foi possivel abrir o arquivo de saida: " + caminhoArquivo);
+        throw std::runtime_error("Nao foi possivel abrir o arquivo de arvore: " + caminhoArquivo);
     }
 
-    // Bloco 2: Coleta dos dados em uma estrutura temporria
-    // Isso  necessrio para que possamos ordenar antes de escrever.
-    struct InfoVertice {
-        int id;
-        int pai;
-        int nivel;
-    };
-    std::vector<InfoVertice> verticesParaOrdenar;
-    // Percorre todos os vrtices do grafo
-    for (int v = 1; v <= this->numeroDeVertices; ++v) {
-        // Adiciona  lista apenas os vrtices que foram alcanados pela busca
-        if (resultado.nivel[v] != -1) {
-            verticesParaOrdenar.push_back({ v, resultado.pai[v], resultado.nivel[v] });
-        }
+    char assinatura[4];
+    int32_t versao = 0, n = 0;
+    arquivo.read(assinatura, sizeof(assinatura));
+    arquivo.read(reinterpret_cast<char*>(&versao), sizeof(versao));
+    arquivo.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!arquivo || std::memcmp(assinatura, ASSINATURA_ARVORE, sizeof(assinatura)) != 0
+        || versao != VERSAO_ARVORE || n < 0) {
+        throw std::runtime_error("Arquivo de arvore invalido: " + caminhoArquivo);
     }
 
-    // Bloco 3: Ordenao do vetor temporrio
-    // Usamos std::sort com uma expresso lambda para definir nossa regra de ordenao.
-    std::sort(verticesParaOrdenar.begin(), verticesParaOrdenar.end(),
-        [](const InfoVertice& a, const InfoVertice& b) {
-            // Regra 1: O critrio principal  o nvel.
-            if (a.nivel != b.nivel) {
-                return a.nivel < b.nivel; // Ordena por nvel ascendente.
-            }
-            // Regra 2: Se os nveis forem iguais, usamos o ID do vrtice como desempate.
-            return a.id < b.id;
-        }
-    );
-
-    // Bloco 4: Escrita dos dados j ordenados no arquivo
-    arquivo << "Vertice,Pai,Nivel\n"; // Escreve o cabealho
-    for (const auto& info : verticesParaOrdenar) {
-        arquivo << info.id << "," << info.pai << "," << info.nivel << "\n";
+    ResultadoBFS resultado;
+    resultado.pai.assign(static_cast<size_t>(n) + 1, -1);
+    resultado.nivel.assign(static_cast<size_t>(n) + 1, -1);
+    arquivo.read(reinterpret_cast<char*>(resultado.pai.data() + 1), static_cast<std::streamsize>(n) * sizeof(int32_t));
+    arquivo.read(reinterpret_cast<char*>(resultado.nivel.data() + 1), static_cast<std::streamsize>(n) * sizeof(int32_t));
+    if (!arquivo) {
+        throw std::runtime_error("Arquivo de arvore truncado: " + caminhoArquivo);
     }
+    return resultado;
 }
 
 /**
@@ -279,96 +348,403 @@ int Grafo::calcularDiametro() const {
 }
 
 /**
- * @brief Implementao do clculo de dimetro APROXIMADO.
+ * @brief BFS de todas as origens com MSBFS.
+ * @details Cada par no ordenado aparece duas vezes (uma a partir de cada ponta),
+ * ento a distribuio  dividida por 2.
  */
-int Grafo::calcularDiametroAproximado(int iteracoes) const {
-    int diametroAproximado = 0;
-    if (this->numeroDeVertices == 0) return 0;
-
-    // Configura o gerador de nmeros aleatrios.
-    std::random_device rd;
-    // Substitua std::mt19337 por std::mt19937 (correto para o gerador Mersenne Twister)
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distrib(1, this->numeroDeVertices);
-
-    // Repete a heurstica 'iteracoes' vezes para aumentar a qualidade da aproximao.
-    for (int i = 0; i < iteracoes; ++i) {
-        // Passo 1: Escolha um vrtice de partida aleatrio 's'.
-        int s = distrib(gen);
-
-        // Passo 2: Rode um BFS de 's' e encontre o vrtice 'u' mais distante.
-        ResultadoBFS res1 = this->executarBFS(s);
-        int maxNivel1 = -1;
-        int u = s;
-        for (int v = 1; v <= this->numeroDeVertices; ++v) {
-            if (res1.nivel[v] > maxNivel1) {
-                maxNivel1 = res1.nivel[v];
-                u = v;
+ResumoDistancias Grafo::analisarDistancias(const ControleExecucao& controle) const {
+    const int n = this->numeroDeVertices;
+    std::vector<int> origens(n);
+    for (int v = 1; v <= n; ++v) origens[v - 1] = v;
+
+    ResumoDistancias resumo;
+    std::vector<int> excentricidades;
+    MSBFS msbfs;
+    msbfs.calcularExcentricidadesEDistribuicao(*this, origens, excentricidades, resumo.distribuicao, controle);
+
+    resumo.excentricidade.assign(static_cast<size_t>(n) + 1, 0);
+    for (int v = 1; v <= n; ++v) resumo.excentricidade[v] = excentricidades[v - 1];
+
+    long long paresAlcancaveis = 0;
+    if (!resumo.distribuicao.empty()) resumo.distribuicao[0] = 0;
+    for (long long& pares : resumo.distribuicao) {
+        pares /= 2;
+        paresAlcancaveis += pares;
+    }
+    resumo.paresInalcancaveis = static_cast<long long>(n) * (n - 1) / 2 - paresAlcancaveis;
+    return resumo;
+}
+
+std::vector<int> Grafo::calcularExcentricidades(const ControleExecucao& controle) const {
+    return this->analisarDistancias(controle).excentricidade;
+}
+
+std::vector<long long> Grafo::distribuicaoDistancias(const ControleExecucao& controle) const {
+    return this->analisarDistancias(controle).distribuicao;
+}
+
+ResultadoHyperANF Grafo::estimarFuncaoVizinhanca(int log2Registradores, const ControleExecucao& controle) const {
+    HyperANF hyperANF;
+    return hyperANF.executar(*this, log2Registradores, controle);
+}
+
+namespace {
+
+    /**
+     * @brief rea de trabalho de uma BFS sobre a VisaoCSR, reaproveitada entre buscas.
+     * @details S os vrtices visitados na busca anterior (guardados na fila) so
+     * reinicializados, ento buscas em componentes pequenas no custam O(V).
+     */
+    struct EspacoBFS {
+        std::vector<int> nivel, pai, fila;
+
+        explicit EspacoBFS(int numVertices) : nivel(static_cast<size_t>(numVertices) + 1, -1), pai(static_cast<size_t>(numVertices) + 1, 0) {}
+
+        /**
+         * @brief BFS a partir de 'origem'.
+         * @return A excentricidade da origem; 'maisDistante' recebe o ltimo vrtice do ltimo nvel.
+         */
+        int executar(const VisaoCSR& csr, int origem, int& maisDistante) {
+            for (int v : fila) nivel[v] = -1;
+            fila.clear();
+            nivel[origem] = 0;
+            pai[origem] = 0;
+            fila.push_back(origem);
+            for (size_t frente = 0; frente < fila.size(); ++frente) {
+                const int u = fila[frente];
+                for (int i = csr.ponteiros[u]; i < csr.ponteiros[u + 1]; ++i) {
+                    const int v = csr.vizinhos[i];
+                    if (nivel[v] != -1) continue;
+                    nivel[v] = nivel[u] + 1;
+                    pai[v] = u;
+                    fila.push_back(v);
+                }
             }
+            maisDistante = fila.back();
+            return nivel[maisDistante];
         }
 
-        // Passo 3: Rode um BFS de 'u' e encontre a maior distncia a partir dele.
-        ResultadoBFS res2 = this->executarBFS(u);
-        int maxNivel2 = -1;
-        for (int v = 1; v <= this->numeroDeVertices; ++v) {
-            if (res2.nivel[v] > maxNivel2) {
-                maxNivel2 = res2.nivel[v];
-            }
+        /**
+         * @brief Vrtice do meio do caminho da rvore entre a origem e v (sobe nivel[v] / 2 pais).
+         */
+        int meioDoCaminho(int v) const {
+            for (int passos = nivel[v] / 2; passos > 0; --passos) v = pai[v];
+            return v;
         }
+    };
 
-        // Passo 4: A maior distncia encontrada (maxNivel2)  uma aproximao.
-        // Atualizamos nosso mximo com o resultado desta iterao.
-        diametroAproximado = std::max(diametroAproximado, maxNivel2);
+    /**
+     * @brief Resultado de uma 4-varredura: limites e o vrtice "central" encontrado.
+     */
+    struct ResultadoVarredura {
+        int limiteInferior = 0;
+        int limiteSuperior = 0;
+        int centro = 0;
+        int excentricidadeCentro = 0;
+    };
+
+    /**
+     * @brief 4-varredura a partir de r1: r1 -> a1 -> (meio r2) -> a2 -> (meio u).
+     * @details Toda excentricidade calculada  um limite inferior do dimetro da componente;
+     * toda excentricidade e(x) d o limite superior 2 * e(x). O vrtice u do meio do caminho
+     * a2-b2 costuma ter excentricidade baixa, o que aperta o limite superior e serve de raiz
+     * para o iFUB.
+     */
+    ResultadoVarredura executarQuatroVarreduras(const VisaoCSR& csr, int r1, EspacoBFS& espaco) {
+        ResultadoVarredura r;
+        int a1, b1, a2, b2, longe;
+        const int eR1 = espaco.executar(csr, r1, a1);
+        const int eA1 = espaco.executar(csr, a1, b1);
+        const int r2 = espaco.meioDoCaminho(b1);
+        const int eR2 = espaco.executar(csr, r2, a2);
+        const int eA2 = espaco.executar(csr, a2, b2);
+        const int u = espaco.meioDoCaminho(b2);
+        const int eU = espaco.executar(csr, u, longe);
+
+        r.limiteInferior = std::max({ eR1, eA1, eR2, eA2, eU });
+        r.limiteSuperior = 2 * std::min({ eR1, eA1, eR2, eA2, eU });
+        r.centro = (eU <= eR2) ? u : r2;
+        r.excentricidadeCentro = std::min(eU, eR2);
+        return r;
+    }
+
+} // namespace
+
+/**
+ * @brief Limites do dimetro: 4-varreduras em paralelo e, com oramento, iFUB.
+ * @details
+ * 1. A maior componente  encontrada com a rotulao paralela (rotularComponentes).
+ * 2. Sementes: metade so os vrtices de maior grau da componente, metade sorteadas com
+ *    um gerador de semente fixa (resultado reprodutvel). Cada semente roda uma
+ *    4-varredura em uma thread, com a sua rea de BFS.
+ * 3. iFUB: a partir do melhor centro u, os vrtices so agrupados por nvel (distncia a u)
+ *    e as excentricidades das franjas mais distantes so calculadas em lotes de MSBFS.
+ *    Depois de processar os nveis >= i, D <= max(maior excentricidade, 2(i - 1)).
+ */
+LimitesDiametro Grafo::estimarLimitesDiametro(int numSementes, int orcamentoBFS, unsigned long long semente, int numThreads) const {
+    LimitesDiametro limites;
+    const int n = this->numeroDeVertices;
+    if (n <= 0) return limites;
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    numSementes = std::max(1, numSementes);
+
+    // 1. Maior componente
+    std::vector<int> rotulo = this->rotularComponentes(numThreads, nullptr);
+    std::vector<int> tamanho(static_cast<size_t>(n) + 1, 0);
+    for (int v = 1; v <= n; ++v) tamanho[rotulo[v]]++;
+    const int raizMaior = static_cast<int>(std::max_element(tamanho.begin() + 1, tamanho.end()) - tamanho.begin());
+    limites.conexo = (tamanho[raizMaior] == n);
+
+    std::vector<int> membros;
+    membros.reserve(tamanho[raizMaior]);
+    for (int v = 1; v <= n; ++v) {
+        if (rotulo[v] == raizMaior) membros.push_back(v);
     }
 
-    return diametroAproximado;
+    // 2. Sementes: maiores graus + sorteio reprodutvel
+    const VisaoCSR csr(*this);
+    auto grau = [&](int v) { return csr.ponteiros[v + 1] - csr.ponteiros[v]; };
+    std::vector<int> sementes;
+    const int porGrau = std::min<int>((numSementes + 1) / 2, static_cast<int>(membros.size()));
+    std::vector<int> porGrauDecrescente(membros);
+    std::partial_sort(porGrauDecrescente.begin(), porGrauDecrescente.begin() + porGrau, porGrauDecrescente.end(),
+        [&](int a, int b) { return grau(a) != grau(b) ? grau(a) > grau(b) : a < b; });
+    sementes.assign(porGrauDecrescente.begin(), porGrauDecrescente.begin() + porGrau);
+    std::mt19937_64 gerador(semente);
+    std::uniform_int_distribution<size_t> sorteio(0, membros.size() - 1);
+    while (static_cast<int>(sementes.size()) < numSementes) sementes.push_back(membros[sorteio(gerador)]);
+
+    const int threadsVarredura = std::min(numThreads, static_cast<int>(sementes.size()));
+    std::vector<EspacoBFS> espacos;
+    espacos.reserve(threadsVarredura);
+    for (int t = 0; t < threadsVarredura; ++t) espacos.emplace_back(n);
+    std::vector<ResultadoVarredura> varreduras(sementes.size());
+    executarEmParalelo(static_cast<int>(sementes.size()), threadsVarredura, [&](int i, int idThread) {
+        varreduras[i] = executarQuatroVarreduras(csr, sementes[i], espacos[idThread]);
+    });
+
+    limites.limiteSuperior = varreduras[0].limiteSuperior;
+    int centro = varreduras[0].centro, excentricidadeCentro = varreduras[0].excentricidadeCentro;
+    for (const ResultadoVarredura& r : varreduras) {
+        limites.limiteInferior = std::max(limites.limiteInferior, r.limiteInferior);
+        limites.limiteSuperior = std::min(limites.limiteSuperior, r.limiteSuperior);
+        if (r.excentricidadeCentro < excentricidadeCentro) {
+            centro = r.centro;
+            excentricidadeCentro = r.excentricidadeCentro;
+        }
+    }
+    limites.numeroBFS = 5 * static_cast<int>(sementes.size());
+    if (limites.limiteInferior >= limites.limiteSuperior || orcamentoBFS <= 0) return limites;
+
+    // 3. iFUB: vrtices em ordem decrescente de distncia ao centro (ordenao por contagem)
+    int maisDistante;
+    espacos[0].executar(csr, centro, maisDistante);
+    const std::vector<int>& nivel = espacos[0].nivel;
+    std::vector<int> inicioNivel(static_cast<size_t>(excentricidadeCentro) + 2, 0);
+    for (int v : membros) inicioNivel[excentricidadeCentro - nivel[v] + 1]++;
+    for (size_t k = 1; k < inicioNivel.size(); ++k) inicioNivel[k] += inicioNivel[k - 1];
+    std::vector<int> ordem(membros.size());
+    for (int v : membros) ordem[inicioNivel[excentricidadeCentro - nivel[v]]++] = v;
+    limites.numeroBFS++;
+
+    // Cada lote de MSBFS custa quase o mesmo que uma BFS: as franjas so juntadas at
+    // encher o lote. Depois de cobrir todos os nveis >= i, D <= max(inferior, 2(i - 1)).
+    MSBFS msbfs;
+    const size_t tamanhoLote = static_cast<size_t>(MSBFS::origensPorLote()) * std::max(1, numThreads);
+    size_t processados = 0;
+    size_t restante = static_cast<size_t>(orcamentoBFS);
+    while (processados < ordem.size() && restante > 0 && limites.limiteInferior < limites.limiteSuperior) {
+        const size_t quantidade = std::min({ tamanhoLote, restante, ordem.size() - processados });
+        std::vector<int> origens(ordem.begin() + processados, ordem.begin() + processados + quantidade);
+        for (const EstatisticasBFSOrigem& e : msbfs.calcularEstatisticas(*this, csr, origens, -1, numThreads)) {
+            limites.limiteInferior = std::max(limites.limiteInferior, e.excentricidade);
+        }
+        processados += quantidade;
+        restante -= quantidade;
+        limites.numeroBFS += static_cast<int>(quantidade);
+
+        // Menor nvel totalmente coberto: o do prximo vrtice, se a franja dele ainda no comeou
+        int nivelCoberto = (processados < ordem.size()) ? nivel[ordem[processados]] + 1 : 1;
+        if (processados < ordem.size() && nivel[ordem[processados - 1]] != nivel[ordem[processados]]) {
+            nivelCoberto = nivel[ordem[processados - 1]];
+        }
+        limites.limiteSuperior = std::min(limites.limiteSuperior, std::max(limites.limiteInferior, 2 * (nivelCoberto - 1)));
+    }
+    limites.limiteSuperior = std::max(limites.limiteSuperior, limites.limiteInferior);
+    return limites;
 }
 
 /**
- * @brief Implementao do algoritmo para encontrar componentes conexas,
- * REUTILIZANDO o mtodo executarBFS.
+ * @brief Implementao do clculo de dimetro APROXIMADO.
+ * @details O limite inferior das 4-varreduras (sem iFUB), com sementes reprodutveis.
  */
-std::vector<ComponenteConexa> Grafo::encontrarComponentesConexas() const {
-    // Bloco 1: Preparao
-    std::vector<ComponenteConexa> todasAsComponentes;
-    std::vector<bool> visitado(this->numeroDeVertices + 1, false);
-
-    // Bloco 2: Loop principal para encontrar os pontos de partida das componentes
-    // Itera por todos os vrtices do grafo para garantir que nenhuma componente seja esquecida.
-    for (int v_inicial = 1; v_inicial <= this->numeroDeVertices; ++v_inicial) {
-
-        // Se o vrtice atual ainda no foi visitado, ele pertence a uma nova componente.
-        if (!visitado[v_inicial]) {
-
-            // Bloco 3: REUTILIZAO do BFS que j implementamos!
-            // Em vez de reescrever a lgica da fila aqui, simplesmente chamamos o mtodo principal.
-            // O resultado conter todos os vrtices alcanveis a partir de 'v_inicial'.
-            ResultadoBFS resultadoParcial = this->executarBFS(v_inicial);
-
-            // Bloco 4: Processamento do resultado do BFS
-            // Agora, iteramos pelos resultados para construir a componente
-            // e marcar todos os seus membros como visitados.
-            ComponenteConexa novaComponente;
-            for (int v_componente = 1; v_componente <= this->numeroDeVertices; ++v_componente) {
-                // Se o vrtice 'v_componente' foi alcanado nesta busca (tem um pai ou  a prpria origem)...
-                if (resultadoParcial.pai[v_componente] != -1 || v_componente == v_inicial) {
-                    novaComponente.vertices.push_back(v_componente);
-                    // CRUCIAL: Marcamos o vrtice como visitado no controle do loop principal
-                    // para no iniciarmos uma nova busca para um vrtice que j pertence a esta componente.
-                    visitado[v_componente] = true;
+int Grafo::calcularDiametroAproximado(int iteracoes, unsigned long long semente) const {
+    return this->estimarLimitesDiametro(iteracoes, 0, semente).limiteInferior;
+}
+
+namespace {
+
+    /**
+     * @brief Raiz do conjunto de x na unio-busca compartilhada entre threads.
+     * @details Usa "path halving": cada passo tenta apontar x para o av. Como os
+     * ponteiros s diminuem (pai[x] <= x), a troca concorrente  sempre segura.
+     */
+    int encontrarRaiz(std::vector<int>& pai, int x) {
+        while (true) {
+            int p = std::atomic_ref<int>(pai[x]).load(std::memory_order_acquire);
+            if (p == x) return x;
+            int avo = std::atomic_ref<int>(pai[p]).load(std::memory_order_acquire);
+            if (p != avo) std::atomic_ref<int>(pai[x]).compare_exchange_weak(p, avo, std::memory_order_acq_rel);
+            x = avo;
+        }
+    }
+
+    /**
+     * @brief Une os conjuntos de u e v (a raiz maior passa a apontar para a menor).
+     * @details A ligao  um CAS que s vale se a raiz ainda for raiz; se outra thread
+     * mudou o conjunto no meio tempo, as razes so procuradas de novo.
+     */
+    void unirConjuntos(std::vector<int>& pai, int u, int v) {
+        while (true) {
+            u = encontrarRaiz(pai, u);
+            v = encontrarRaiz(pai, v);
+            if (u == v) return;
+            if (u < v) std::swap(u, v);
+            int esperado = u;
+            if (std::atomic_ref<int>(pai[u]).compare_exchange_strong(esperado, v, std::memory_order_acq_rel)) return;
+        }
+    }
+
+    /**
+     * @brief Buffer de sada pr-alocado: inteiros via std::to_chars, reais via "%g"
+     * (o mesmo formato que o operator<< usa por padro).
+     */
+    class BufferRelatorio {
+    public:
+        explicit BufferRelatorio(size_t capacidade) { texto.reserve(capacidade); }
+
+        BufferRelatorio& operator<<(const char* s) { texto.append(s); return *this; }
+        BufferRelatorio& operator<<(char c) { texto.push_back(c); return *this; }
+        BufferRelatorio& operator<<(long long valor) {
+            char numero[24];
+            char* fim = std::to_chars(numero, numero + sizeof(numero), valor).ptr;
+            texto.append(numero, fim);
+            return *this;
+        }
+        BufferRelatorio& operator<<(int valor) { return *this << static_cast<long long>(valor); }
+        BufferRelatorio& operator<<(size_t valor) { return *this << static_cast<long long>(valor); }
+        BufferRelatorio& operator<<(double valor) {
+            char numero[32];
+            int tamanho = std::snprintf(numero, sizeof(numero), "%g", valor);
+            texto.append(numero, static_cast<size_t>(tamanho));
+            return *this;
+        }
+
+        std::string texto;
+    };
+
+} // namespace
+
+/**
+ * @brief Rotulao das componentes em uma varredura: cada bloco de vrtices une as
+ * pontas das suas arestas (u < v) e, opcionalmente, conta os graus em um histograma
+ * por thread. Depois, como pai[v] <= v, uma passada crescente achata todos os ponteiros.
+ */
+std::vector<int> Grafo::rotularComponentes(int numThreads, EstatisticasGrau* estatisticas) const {
+    const int n = this->numeroDeVertices;
+    std::vector<int> pai(static_cast<size_t>(n) + 1);
+    for (int v = 0; v <= n; ++v) pai[v] = v;
+    if (n <= 0) {
+        if (estatisticas) *estatisticas = EstatisticasGrau();
+        return pai;
+    }
+
+    // Na representao CSR as arestas so lidas direto dos vetores; nas demais, pela interface
+    const ListaAdjacencia* csr = this->obterListaAdjacencia();
+    const int* ponteiros = csr ? csr->obterPonteirosInicio().data() : nullptr;
+    const int* vizinhos = csr ? csr->obterListaVizinhos().data() : nullptr;
+
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    const int numBlocos = std::max(1, std::min(numThreads * 4, n / VERTICES_MINIMOS_POR_BLOCO));
+    const int threadsUsadas = std::min(numThreads, numBlocos);
+    auto inicioBloco = [&](int b) { return 1 + static_cast<int>(static_cast<long long>(n) * b / numBlocos); };
+
+    std::vector<std::vector<int>> histogramas(estatisticas ? threadsUsadas : 0);
+    std::vector<long long> somas(threadsUsadas, 0);
+
+    executarEmParalelo(numBlocos, threadsUsadas, [&](int b, int idThread) {
+        long long soma = 0;
+        for (int u = inicioBloco(b); u < inicioBloco(b + 1); ++u) {
+            int grau;
+            if (ponteiros) {
+                grau = ponteiros[u + 1] - ponteiros[u];
+                for (int i = ponteiros[u]; i < ponteiros[u + 1]; ++i) {
+                    if (vizinhos[i] > u) unirConjuntos(pai, u, vizinhos[i]);
                 }
             }
-
-            // Adiciona a componente completa  lista de resultados.
-            if (!novaComponente.vertices.empty()) {
-                novaComponente.tamanho = novaComponente.vertices.size();
-                todasAsComponentes.push_back(novaComponente);
+            else {
+                std::vector<int> lista = representacaoInterna->obterVizinhos(u);
+                grau = static_cast<int>(lista.size());
+                for (int v : lista) {
+                    if (v > u) unirConjuntos(pai, u, v);
+                }
+            }
+            if (estatisticas) {
+                std::vector<int>& h = histogramas[idThread];
+                if (grau >= static_cast<int>(h.size())) h.resize(static_cast<size_t>(grau) + 1, 0);
+                h[grau]++;
+                soma += grau;
             }
         }
+        somas[idThread] += soma;
+    });
+
+    // pai[v] <= v: em ordem crescente, o pai de v j aponta para a raiz
+    for (int v = 1; v <= n; ++v) pai[v] = pai[pai[v]];
+
+    if (estatisticas) {
+        EstatisticasGrau& est = *estatisticas;
+        est = EstatisticasGrau();
+        long long somaGraus = 0;
+        for (int t = 0; t < threadsUsadas; ++t) {
+            somaGraus += somas[t];
+            if (histogramas[t].size() > est.distribuicao.size()) est.distribuicao.resize(histogramas[t].size(), 0);
+            for (size_t k = 0; k < histogramas[t].size(); ++k) est.distribuicao[k] += histogramas[t][k];
+        }
+        est.grauMax = static_cast<int>(est.distribuicao.size()) - 1;
+        while (est.distribuicao[est.grauMin] == 0) ++est.grauMin;
+        est.grauMedio = static_cast<double>(somaGraus) / n;
+        est.grauMediana = est.percentil(50.0);
     }
+    return pai;
+}
 
-    // Bloco 5: Ordenao das componentes (lgica inalterada)
-    std::sort(todasAsComponentes.begin(), todasAsComponentes.end(),
+/**
+ * @brief Implementao do algoritmo para encontrar componentes conexas.
+ * @details Os vrtices so agrupados pelo rtulo com uma ordenao por contagem,
+ * ento cada componente lista seus vrtices em ordem crescente.
+ */
+std::vector<ComponenteConexa> Grafo::encontrarComponentesConexas(int numThreads) const {
+    const int n = this->numeroDeVertices;
+    std::vector<int> rotulo = this->rotularComponentes(numThreads, nullptr);
+
+    // ndice de cada componente, na ordem do menor vrtice (a raiz)
+    std::vector<int> indice(static_cast<size_t>(n) + 1, -1);
+    std::vector<ComponenteConexa> todasAsComponentes;
+    for (int v = 1; v <= n; ++v) {
+        if (rotulo[v] == v) {
+            indice[v] = static_cast<int>(todasAsComponentes.size());
+            todasAsComponentes.emplace_back();
+        }
+        todasAsComponentes[indice[rotulo[v]]].tamanho++;
+    }
+    for (ComponenteConexa& c : todasAsComponentes) c.vertices.reserve(c.tamanho);
+    for (int v = 1; v <= n; ++v) {
+        todasAsComponentes[indice[rotulo[v]]].vertices.push_back(v);
+    }
+
+    // Ordenao por tamanho decrescente (empates mantm a ordem do menor vrtice)
+    std::stable_sort(todasAsComponentes.begin(), todasAsComponentes.end(),
         [](const ComponenteConexa& a, const ComponenteConexa& b) {
             return a.tamanho > b.tamanho;
         }
@@ -378,18 +754,61 @@ std::vector<ComponenteConexa> Grafo::encontrarComponentesConexas() const {
 }
 
 /**
- * @brief Implementao PRINCIPAL que escreve o relatrio em um fluxo genrico.
+ * @brief Implementao PRINCIPAL do relatrio: uma varredura para graus e componentes,
+ * depois a formatao em um buffer reservado de uma vez.
  */
-void Grafo::gerarRelatorioCompleto(std::ostream& saida) const {
+std::string Grafo::formatarRelatorioCompleto(FormatoRelatorio formato, int numThreads) const {
+    const int n = this->numeroDeVertices;
+
+    // --- Anlise: estatsticas de grau e componentes na mesma varredura ---
+    EstatisticasGrau estatisticas;
+    std::vector<int> rotulo = this->rotularComponentes(numThreads, &estatisticas);
+
+    std::vector<int> tamanhoPorRaiz(static_cast<size_t>(n) + 1, 0);
+    for (int v = 1; v <= n; ++v) tamanhoPorRaiz[rotulo[v]]++;
+    std::vector<int> tamanhos;
+    for (int v = 1; v <= n; ++v) {
+        if (rotulo[v] == v) tamanhos.push_back(tamanhoPorRaiz[v]);
+    }
+    std::sort(tamanhos.begin(), tamanhos.end(), std::greater<int>());
+
+    // --- Formatao: capacidade estimada pelo nmero de linhas/valores ---
+    BufferRelatorio saida(512 + tamanhos.size() * 56 + estatisticas.distribuicao.size() * 12);
+
+    if (formato == FormatoRelatorio::JSON) {
+        saida << "{\n";
+        saida << "  \"numeroVertices\": " << n << ",\n";
+        saida << "  \"numeroArestas\": " << this->numeroDeArestas << ",\n";
+        saida << "  \"grau\": {\n";
+        saida << "    \"minimo\": " << estatisticas.grauMin << ",\n";
+        saida << "    \"maximo\": " << estatisticas.grauMax << ",\n";
+        saida << "    \"medio\": " << estatisticas.grauMedio << ",\n";
+        saida << "    \"mediana\": " << estatisticas.grauMediana << ",\n";
+        saida << "    \"distribuicao\": [";
+        for (size_t k = 0; k < estatisticas.distribuicao.size(); ++k) {
+            if (k > 0) saida << ", ";
+            saida << estatisticas.distribuicao[k];
+        }
+        saida << "]\n  },\n";
+        saida << "  \"componentes\": {\n";
+        saida << "    \"quantidade\": " << tamanhos.size() << ",\n";
+        saida << "    \"tamanhos\": [";
+        for (size_t i = 0; i < tamanhos.size(); ++i) {
+            if (i > 0) saida << ", ";
+            saida << tamanhos[i];
+        }
+        saida << "]\n  }\n}\n";
+        return std::move(saida.texto);
+    }
+
     saida << "--- RELATORIO COMPLETO DO GRAFO ---\n\n";
 
     // --- Bloco 1: Estatsticas Bsicas ---
     saida << "1. ESTATISTICAS BASICAS\n";
-    saida << "   - Numero de Vertices: " << this->numeroDeVertices << "\n";
+    saida << "   - Numero de Vertices: " << n << "\n";
     saida << "   - Numero de Arestas: " << this->numeroDeArestas << "\n\n";
 
     // --- Bloco 2: Estatsticas de Grau ---
-    EstatisticasGrau estatisticas = this->calcularEstatisticasGrau();
     saida << "2. ESTATISTICAS DE GRAU\n";
     saida << "   - Grau Minimo: " << estatisticas.grauMin << "\n";
     saida << "   - Grau Maximo: " << estatisticas.grauMax << "\n";
@@ -397,57 +816,131 @@ void Grafo::gerarRelatorioCompleto(std::ostream& saida) const {
     saida << "   - Mediana de Grau: " << estatisticas.grauMediana << "\n\n";
 
     // --- Bloco 3: Componentes Conexas ---
-    std::vector<ComponenteConexa> componentes = this->encontrarComponentesConexas();
     saida << "3. COMPONENTES CONEXAS\n";
-    saida << "   - Numero total de componentes: " << componentes.size() << "\n";
+    saida << "   - Numero total de componentes: " << tamanhos.size() << "\n";
 
-    for (size_t i = 0; i < componentes.size(); ++i) {
-        saida << "   - Componente " << i + 1 << " (Tamanho: " << componentes[i].tamanho << " vertices)\n";
+    for (size_t i = 0; i < tamanhos.size(); ++i) {
+        saida << "   - Componente " << i + 1 << " (Tamanho: " << tamanhos[i] << " vertices)\n";
     }
 
-    saida << "\n--- FIM DO RELATORIO ---" << std::endl;
+    saida << "\n--- FIM DO RELATORIO ---\n";
+    return std::move(saida.texto);
+}
+
+/**
+ * @brief Envia o relatrio para um fluxo genrico com uma nica escrita.
+ */
+void Grafo::gerarRelatorioCompleto(std::ostream& saida, FormatoRelatorio formato, int numThreads) const {
+    const std::string relatorio = this->formatarRelatorioCompleto(formato, numThreads);
+    saida.write(relatorio.data(), static_cast<std::streamsize>(relatorio.size()));
+    saida.flush();
 }
 
 /**
  * @brief Implementao de convenincia que salva o relatrio em um arquivo.
- * @details Abre um arquivo e chama a implementao principal passando o arquivo como fluxo.
+ * @details Monta o relatrio antes de abrir o arquivo e o grava com uma nica escrita.
  */
-void Grafo::gerarRelatorioCompleto(const std::string& caminhoArquivo) const {
-    std::ofstream arquivo(caminhoArquivo);
+void Grafo::gerarRelatorioCompleto(const std::string& caminhoArquivo, FormatoRelatorio formato, int numThreads) const {
+    const std::string relatorio = this->formatarRelatorioCompleto(formato, numThreads);
+    std::ofstream arquivo(caminhoArquivo, std::ios::binary | std::ios::trunc);
     if (!arquivo.is_open()) {
         throw std::runtime_error("Nao foi possivel criar o arquivo de relatorio: " + caminhoArquivo);
     }
-    // Chama a outra verso da funo, passando o arquivo como o fluxo de sada
-    this->gerarRelatorioCompleto(arquivo);
+    arquivo.write(relatorio.data(), static_cast<std::streamsize>(relatorio.size()));
+    if (!arquivo) {
+        throw std::runtime_error("Erro ao gravar o arquivo de relatorio: " + caminhoArquivo);
+    }
 }
 
-// Nota: Precisamos garantir que o mtodo calcularEstatisticasGrau exista em Grafo.cpp
-// Se ele ainda no foi movido para c, aqui est a implementao dele:
-EstatisticasGrau Grafo::calcularEstatisticasGrau() const {
+/**
+ * @brief Estatsticas de grau em O(V) com histograma (sem ordenar os graus).
+ * @details Passo 1 (paralelo por blocos): mnimo, mximo e soma dos graus.
+ * Passo 2 (paralelo): cada thread conta os graus do seu bloco em um histograma prprio
+ * de tamanho grauMax + 1; os histogramas so somados na distribuio final, da qual
+ * saem a mediana e os percentis.
+ */
+EstatisticasGrau Grafo::calcularEstatisticasGrau(int numThreads) const {
     EstatisticasGrau est;
-    if (this->numeroDeVertices == 0) return est;
+    const int n = this->numeroDeVertices;
+    if (n <= 0) return est;
+
+    // Na representao CSR o grau  a diferena de dois ponteiros; nas demais, usa a interface
+    // (e guarda o resultado, para no pagar duas vezes um obterGrau que pode ser O(V)).
+    const ListaAdjacencia* csr = this->obterListaAdjacencia();
+    const int* ponteiros = csr ? csr->obterPonteirosInicio().data() : nullptr;
+    std::vector<int> grausCalculados;
+    if (!ponteiros) grausCalculados.assign(n + 1, 0);
+
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    const int numBlocos = std::max(1, std::min(numThreads * 4, n / VERTICES_MINIMOS_POR_BLOCO));
+    auto inicioBloco = [&](int b) { return 1 + static_cast<int>(static_cast<long long>(n) * b / numBlocos); };
+
+    // Passo 1: mnimo, mximo e soma por bloco
+    struct ResumoBloco {
+        int minimo = INT_MAX;
+        int maximo = 0;
+        long long soma = 0;
+    };
+    std::vector<ResumoBloco> resumos(numBlocos);
+    executarEmParalelo(numBlocos, numThreads, [&](int b, int) {
+        ResumoBloco r;
+        for (int v = inicioBloco(b); v < inicioBloco(b + 1); ++v) {
+            int grau;
+            if (ponteiros) grau = ponteiros[v + 1] - ponteiros[v];
+            else grau = grausCalculados[v] = representacaoInterna->obterGrau(v);
+            r.minimo = std::min(r.minimo, grau);
+            r.maximo = std::max(r.maximo, grau);
+            r.soma += grau;
+        }
+        resumos[b] = r;
+    });
 
-    std::vector<int> graus;
-    graus.reserve(this->numeroDeVertices);
     long long somaGraus = 0;
-
-    for (int v = 1; v <= this->numeroDeVertices; ++v) {
-        int grau = this->obterGrau(v);
-        graus.push_back(grau);
-        somaGraus += grau;
-    }
-
-    std::sort(graus.begin(), graus.end());
-    est.grauMin = graus.front();
-    est.grauMax = graus.back();
-    est.grauMedio = static_cast<double>(somaGraus) / this->numeroDeVertices;
-
-    if (this->numeroDeVertices % 2 == 1) {
-        est.grauMediana = graus[this->numeroDeVertices / 2];
+    est.grauMin = INT_MAX;
+    for (const ResumoBloco& r : resumos) {
+        est.grauMin = std::min(est.grauMin, r.minimo);
+        est.grauMax = std::max(est.grauMax, r.maximo);
+        somaGraus += r.soma;
     }
-    else {
-        est.grauMediana = (graus[this->numeroDeVertices / 2 - 1] + graus[this->numeroDeVertices / 2]) / 2.0;
+    est.grauMedio = static_cast<double>(somaGraus) / n;
+
+    // Passo 2: histograma por thread (sem disputa), depois a soma dos histogramas
+    const int threadsUsadas = std::min(numThreads, numBlocos);
+    std::vector<std::vector<int>> histogramas(threadsUsadas);
+    executarEmParalelo(numBlocos, threadsUsadas, [&](int b, int idThread) {
+        std::vector<int>& h = histogramas[idThread];
+        if (h.empty()) h.assign(est.grauMax + 1, 0);
+        for (int v = inicioBloco(b); v < inicioBloco(b + 1); ++v) {
+            h[ponteiros ? ponteiros[v + 1] - ponteiros[v] : grausCalculados[v]]++;
+        }
+    });
+    est.distribuicao.assign(est.grauMax + 1, 0);
+    for (const std::vector<int>& h : histogramas) {
+        for (size_t k = 0; k < h.size(); ++k) est.distribuicao[k] += h[k];
     }
 
+    est.grauMediana = est.percentil(50.0);
     return est;
+}
+
+double EstatisticasGrau::percentil(double p) const {
+    long long total = 0;
+    for (int quantidade : distribuicao) total += quantidade;
+    if (total == 0) return 0.0;
+
+    // Posio (0-based) na lista ordenada de graus e as duas posies inteiras vizinhas
+    p = std::min(100.0, std::max(0.0, p));
+    const double posicao = p / 100.0 * static_cast<double>(total - 1);
+    const long long abaixo = static_cast<long long>(std::floor(posicao));
+    const long long acima = std::min(abaixo + 1, total - 1);
+
+    // Percorre a distribuio acumulada at encontrar o grau de cada posio
+    int grauAbaixo = -1, grauAcima = -1;
+    long long acumulado = 0;
+    for (size_t k = 0; k < distribuicao.size() && grauAcima < 0; ++k) {
+        acumulado += distribuicao[k];
+        if (grauAbaixo < 0 && acumulado > abaixo) grauAbaixo = static_cast<int>(k);
+        if (acumulado > acima) grauAcima = static_cast<int>(k);
+    }
+    return grauAbaixo + (grauAcima - grauAbaixo) * (posicao - static_cast<double>(abaixo));
 }
\ No newline at end of file
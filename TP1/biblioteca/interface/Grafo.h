@@ -7,10 +7,14 @@
 #include <string>
 #include <vector>
 #include <memory> // Necessrio para std::unique_ptr
+#include <functional>
+#include <cstddef>
 
  // Inclui as definies dos algoritmos e de seus respectivos resultados
 #include "../algoritmos/BFS.h"
 #include "../algoritmos/DFS.h"
+#include "../algoritmos/MSBFS.h"
+#include "../algoritmos/HyperANF.h"
 
 // --- DEFINIO DAS STRUCTS DE RESULTADO ---
 
@@ -32,6 +36,63 @@ struct EstatisticasGrau {
     int grauMax = 0;
     double grauMedio = 0.0;
     double grauMediana = 0.0;
+
+    /**
+     * @brief Distribuio completa dos graus: distribuicao[k] = nmero de vrtices com grau k.
+     * @details Tamanho grauMax + 1 (til, por exemplo, para ajustar uma lei de potncia).
+     */
+    std::vector<int> distribuicao;
+
+    /**
+     * @brief Calcula um percentil dos graus a partir da distribuio.
+     * @details Interpolao linear entre as posies vizinhas da lista ordenada de graus
+     * (o percentil 50 coincide com a mediana). Custo O(grauMax).
+     * @param p Percentil desejado, entre 0 e 100.
+     * @return O grau correspondente (0 se a distribuio estiver vazia).
+     */
+    double percentil(double p) const;
+};
+
+
+/**
+ * @struct LimitesDiametro
+ * @brief Limites para o dimetro da maior componente conexa.
+ */
+struct LimitesDiametro {
+    int limiteInferior = 0;
+    int limiteSuperior = 0;
+    int numeroBFS = 0;   // Buscas executadas (cada origem de um lote de MSBFS conta como uma)
+    bool conexo = true;  // Se falso, os limites valem para a maior componente (o dimetro do grafo  infinito)
+
+    bool exato() const { return limiteInferior == limiteSuperior; }
+};
+
+/**
+ * @struct ResumoDistancias
+ * @brief Resultado da BFS a partir de todos os vrtices.
+ */
+struct ResumoDistancias {
+    std::vector<int> excentricidade;     // excentricidade[v] = maior distncia de v a um vrtice da sua componente
+    std::vector<long long> distribuicao; // distribuicao[d] = pares no ordenados {u, v}  distncia d (distribuicao[0] = 0)
+    long long paresInalcancaveis = 0;    // Pares no ordenados em componentes diferentes
+};
+
+/**
+ * @enum FormatoRelatorio
+ * @brief Formato de sada do relatrio completo.
+ */
+enum class FormatoRelatorio {
+    TEXTO, // Texto legvel (formato original do relatrio)
+    JSON   // Objeto JSON, com a distribuio de graus e o tamanho de cada componente
+};
+
+/**
+ * @enum FormatoArvore
+ * @brief Formato do arquivo gerado por salvarArvoreBusca.
+ */
+enum class FormatoArvore {
+    TEXTO,  // CSV "Vertice,Pai,Nivel", ordenado por nvel e depois por id
+    BINARIO // "GARV", verso (int32), V (int32), pai[1..V] e nivel[1..V] (int32 cada)
 };
 
 
@@ -39,6 +100,7 @@ struct EstatisticasGrau {
 
 // Declarao antecipada da classe de representao.
 class Representacao;
+class ListaAdjacencia;
 
 /**
  * @enum TipoRepresentacao
@@ -51,6 +113,15 @@ enum class TipoRepresentacao {
     LISTA_ADJACENCIA_SIMPLES
 };
 
+/**
+ * @enum FaseCarga
+ * @brief Etapas da construo do grafo, informadas ao observador opcional do construtor.
+ */
+enum class FaseCarga {
+    LEITURA,    // Arestas lidas do arquivo e entregues  representao
+    FINALIZACAO // Representao finalizada (ex: CSR montado e buffers temporrios liberados)
+};
+
 /**
  * @class Grafo
  * @brief Classe principal que representa um grafo e serve como a API pblica da biblioteca.
@@ -64,9 +135,24 @@ public:
      * representao interna especificada.
      * @param caminhoArquivo O caminho para o arquivo .txt que contm a definio do grafo.
      * @param tipo O tipo de representao a ser usada.
+     * @param aoConcluirFase Se no for vazio,  chamado ao fim de cada FaseCarga (ex: para
+     * medir a memria de cada etapa, com bytesUtilizados() j vlido).
      * @throws std::runtime_error se o arquivo no puder ser aberto.
      */
-    Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo);
+    Grafo(const std::string& caminhoArquivo, TipoRepresentacao tipo,
+        const std::function<void(FaseCarga, const Grafo&)>& aoConcluirFase = {});
+
+    /**
+     * @brief Construtor a partir de arestas j em memria (ex: comum/Geradores.h).
+     * @details As arestas vo direto para a representao (no CSR, o vetor vira o buffer
+     * de construo, sem cpia) e no passam por arquivo texto. A fase LEITURA termina
+     * quando a representao recebe o lote.
+     * @param numeroVertices Nmero de vrtices (arestas usam ids 1..numeroVertices).
+     * @param arestas Pares (u, v); o vetor  consumido.
+     * @throws std::runtime_error se numeroVertices <= 0 ou a representao no comportar o grafo.
+     */
+    Grafo(int numeroVertices, std::vector<std::pair<int, int>> arestas, TipoRepresentacao tipo,
+        const std::function<void(FaseCarga, const Grafo&)>& aoConcluirFase = {});
 
     /**
      * @brief Destrutor da classe Grafo.
@@ -103,6 +189,19 @@ public:
      */
     std::vector<int> obterVizinhos(int vertice) const;
 
+    /**
+     * @brief Acesso  representao CSR, para algoritmos que percorrem os vetores diretamente.
+     * @return A ListaAdjacencia interna, ou nullptr se o grafo usa outra representao.
+     */
+    const ListaAdjacencia* obterListaAdjacencia() const;
+
+    /**
+     * @brief Memria ocupada pelo grafo, em bytes (o objeto e a sua representao).
+     * @details Ver Representacao::bytesUtilizados(); durante a fase LEITURA inclui os
+     * buffers de construo que a finalizao libera.
+     */
+    size_t bytesUtilizados() const;
+
     // --- MTODOS DE ALGORITMOS ---
 
     /**
@@ -137,57 +236,156 @@ public:
 
     /**
      * @brief Estima o dimetro do grafo com uma heurstica rpida.
-     * @param iteracoes O nmero de vezes que a heurstica ser executada (default = 5).
-     * @return O dimetro aproximado do grafo.
+     * @details Limite inferior de estimarLimitesDiametro (4-varreduras, sem iFUB).
+     * @param iteracoes O nmero de sementes da heurstica (default = 5).
+     * @param semente Semente do sorteio (a mesma semente d o mesmo resultado).
+     * @return O dimetro aproximado do grafo (da maior componente, se for desconexo).
      */
-    int calcularDiametroAproximado(int iteracoes = 5) const;
+    int calcularDiametroAproximado(int iteracoes = 5, unsigned long long semente = 0) const;
+
+    /**
+     * @brief Calcula um limite inferior e um superior para o dimetro da maior componente.
+     * @details 4-varreduras em paralelo a partir dos vrtices de maior grau e de vrtices
+     * sorteados; toda excentricidade e(x) encontrada d e(x) <= D <= 2 e(x). Com oramento,
+     * o iFUB calcula as excentricidades das franjas mais distantes do melhor centro (em
+     * lotes de MSBFS) at os limites se encontrarem.
+     * @param numSementes Nmero de 4-varreduras (cada uma custa 5 BFS).
+     * @param orcamentoBFS Mximo de excentricidades extras no iFUB (0 = s as varreduras).
+     * @param semente Semente do sorteio (a mesma semente d o mesmo resultado).
+     * @param numThreads Nmero de threads (<= 0 usa o nmero de ncleos).
+     * @return Um struct LimitesDiametro (limiteInferior == limiteSuperior quando  exato).
+     */
+    LimitesDiametro estimarLimitesDiametro(int numSementes = 4, int orcamentoBFS = 0,
+        unsigned long long semente = 0, int numThreads = 0) const;
 
     /**
      * @brief Encontra todas as componentes conexas do grafo.
-     * @details Utiliza um algoritmo de busca para encontrar todos os subgrafos conexos.
+     * @details Rotula as componentes com uma nica varredura das arestas (unio-busca,
+     * em paralelo) e agrupa os vrtices por rtulo, em O(V + E) no total.
+     * @param numThreads Nmero de threads da rotulao (<= 0 usa o nmero de ncleos).
      * @return Um vetor de structs ComponenteConexa, j ordenado por tamanho em ordem decrescente.
      */
-    std::vector<ComponenteConexa> encontrarComponentesConexas() const;
+    std::vector<ComponenteConexa> encontrarComponentesConexas(int numThreads = 0) const;
+
+    /**
+     * @brief Executa uma BFS a partir de cada vrtice e resume as distncias.
+     * @details As BFS rodam em lotes de MSBFS (vrias origens por varredura do grafo),
+     * distribudos entre as threads, cada uma com seus prprios buffers e histograma.
+     * @param controle Threads, progresso (em vrtices de origem concludos) e cancelamento.
+     * @return Excentricidades, distribuio de distncias e pares inalcanveis.
+     * @throws std::runtime_error se a execuo for cancelada.
+     */
+    ResumoDistancias analisarDistancias(const ControleExecucao& controle = {}) const;
+
+    /**
+     * @brief Calcula a excentricidade de cada vrtice (maior distncia dentro da sua componente).
+     * @param controle Threads, progresso e cancelamento.
+     * @return Vetor com V+1 posies (ndice 0 sem uso).
+     */
+    std::vector<int> calcularExcentricidades(const ControleExecucao& controle = {}) const;
+
+    /**
+     * @brief Calcula o histograma global das distncias em arestas.
+     * @param controle Threads, progresso e cancelamento.
+     * @return distribuicao[d] = nmero de pares no ordenados {u, v}  distncia d.
+     */
+    std::vector<long long> distribuicaoDistancias(const ControleExecucao& controle = {}) const;
+
+    /**
+     * @brief Estima a funo de vizinhana com HyperANF (para grafos grandes demais para BFS de todas as origens).
+     * @details Memria fixa de 2 x V x 2^log2Registradores bytes; cada iterao  uma
+     * varredura paralela das arestas. D a distribuio de distncias, o dimetro
+     * efetivo e a proximidade de cada vrtice, todos aproximados.
+     * @param log2Registradores b, com 2^b registradores por vrtice (entre 4 e 16).
+     * @param controle Threads, progresso (iteraes concludas) e cancelamento.
+     * @return Um struct ResultadoHyperANF com as estimativas.
+     */
+    ResultadoHyperANF estimarFuncaoVizinhanca(int log2Registradores = 6, const ControleExecucao& controle = {}) const;
 
     // --- MTODOS DE ANLISE E RELATRIO ---
 
     /**
-     * @brief Calcula as estatsticas de grau (mn, mx, mdio, mediana) do grafo.
+     * @brief Calcula as estatsticas de grau (mn, mx, mdio, mediana e distribuio) do grafo.
+     * @details Em O(V): os graus so contados em um histograma (ordenao por contagem, j
+     * que o grau  limitado), com um histograma por thread. Na representao CSR os graus
+     * vm direto das diferenas de ponteirosInicio, sem chamada virtual por vrtice.
+     * @param numThreads Nmero de threads (<= 0 usa o nmero de ncleos).
      * @return Um struct EstatisticasGrau com os resultados.
      */
-    EstatisticasGrau calcularEstatisticasGrau() const;
+    EstatisticasGrau calcularEstatisticasGrau(int numThreads = 0) const;
+
+    /**
+     * @brief Monta o relatorio completo em memria. (Verso principal)
+     * @details Estatsticas de grau e componentes conexas saem da mesma varredura paralela
+     * das arestas (o histograma de graus  acumulado durante a rotulao das componentes).
+     * O texto  formatado em um nico buffer pr-alocado, sem fluxos.
+     * @param formato TEXTO ou JSON.
+     * @param numThreads Nmero de threads (<= 0 usa o nmero de ncleos).
+     * @return O relatrio pronto para ser gravado.
+     */
+    std::string formatarRelatorioCompleto(FormatoRelatorio formato = FormatoRelatorio::TEXTO, int numThreads = 0) const;
 
     /**
          * @brief Gera um relatorio completo e o salva em um arquivo. (Verso de convenincia)
+         * @details O contedo  gravado com uma nica escrita.
          * @param caminhoArquivo O nome do arquivo onde o relatorio sera salvo.
+         * @param formato TEXTO ou JSON.
+         * @param numThreads Nmero de threads (<= 0 usa o nmero de ncleos).
          */
-    void gerarRelatorioCompleto(const std::string& caminhoArquivo) const;
+    void gerarRelatorioCompleto(const std::string& caminhoArquivo, FormatoRelatorio formato = FormatoRelatorio::TEXTO, int numThreads = 0) const;
 
     /**
-     * @brief Gera um relatorio completo e o envia para um fluxo de sada (arquivo, console, etc.). (Verso principal)
+     * @brief Gera um relatorio completo e o envia para um fluxo de sada (arquivo, console, etc.).
      * @param saida O fluxo de sada (ex: std::cout ou um std::ofstream).
+     * @param formato TEXTO ou JSON.
+     * @param numThreads Nmero de threads (<= 0 usa o nmero de ncleos).
      */
-    void gerarRelatorioCompleto(std::ostream& saida) const;
+    void gerarRelatorioCompleto(std::ostream& saida, FormatoRelatorio formato = FormatoRelatorio::TEXTO, int numThreads = 0) const;
 
 
     // --- MTODOS DE SALVAMENTO ---
 
     /**
-     * @brief Salva a rvore de busca gerada pelo BFS em um arquivo de texto.
+     * @brief Salva a rvore de busca gerada pelo BFS em um arquivo.
+     * @details Em texto, os vrtices alcanados so ordenados por nvel com uma ordenao
+     * por contagem (O(V)); em binrio, os vetores pai e nivel so gravados como esto.
      * @param resultado O struct ResultadoBFS retornado pelo mtodo de busca.
      * @param caminhoArquivo O nome do arquivo onde a rvore ser salva.
+     * @param formato TEXTO (CSV) ou BINARIO.
+     * @throws std::runtime_error se o arquivo no puder ser escrito.
      */
-    void salvarArvoreBusca(const ResultadoBFS& resultado, const std::string& caminhoArquivo) const;
+    void salvarArvoreBusca(const ResultadoBFS& resultado, const std::string& caminhoArquivo, FormatoArvore formato = FormatoArvore::TEXTO) const;
 
     /**
-     * @brief Salva a rvore de busca gerada pelo DFS em um arquivo de texto.
+     * @brief Salva a rvore de busca gerada pelo DFS em um arquivo.
      * @param resultado O struct ResultadoDFS retornado pelo mtodo de busca.
      * @param caminhoArquivo O nome do arquivo onde a rvore ser salva.
+     * @param formato TEXTO (CSV) ou BINARIO.
+     * @throws std::runtime_error se o arquivo no puder ser escrito.
+     */
+    void salvarArvoreBusca(const ResultadoDFS& resultado, const std::string& caminhoArquivo, FormatoArvore formato = FormatoArvore::TEXTO) const;
+
+    /**
+     * @brief L uma rvore gravada por salvarArvoreBusca no formato BINARIO.
+     * @param caminhoArquivo Caminho do arquivo binrio.
+     * @return Os vetores pai e nivel (V+1 posies, ndice 0 sem uso).
+     * @throws std::runtime_error se o arquivo for invlido ou estiver truncado.
      */
-    void salvarArvoreBusca(const ResultadoDFS& resultado, const std::string& caminhoArquivo) const;
+    static ResultadoBFS lerArvoreBusca(const std::string& caminhoArquivo);
 
 
 private:
+    /**
+     * @brief Rotula as componentes conexas com uma nica varredura paralela das arestas.
+     * @details Unio-busca concorrente (ligaes por CAS, sempre da raiz maior para a menor).
+     * Se 'estatisticas' no for nulo, os graus so contados na mesma varredura e o struct
+     *  preenchido (mn, mx, mdio, mediana e distribuio).
+     * @param numThreads Nmero de threads (<= 0 usa o nmero de ncleos).
+     * @param estatisticas Destino opcional das estatsticas de grau.
+     * @return rotulo[v] = menor vrtice da componente de v (rotulo[0] sem uso).
+     */
+    std::vector<int> rotularComponentes(int numThreads, EstatisticasGrau* estatisticas) const;
+
     /**
      * @brief Ponteiro inteligente para a implementao da representao do grafo.
      * @details O uso de std::unique_ptr garante que a memria seja gerenciada automaticamente (RAII).
@@ -6,6 +6,8 @@
 #include "ListaAdjacencia.h"
 #include <stdexcept>
 #include <algorithm>
+#include <limits>
+#include <string>
 
  /**
   * @brief Construtor da ListaAdjacencia.
@@ -32,13 +34,37 @@ void ListaAdjacencia::adicionarAresta(int u, int v) {
     }
 }
 
+/**
+ * @brief Adiciona um lote de arestas ao buffer temporrio.
+ * @details Mesma validao de adicionarAresta, feita no prprio vetor; se o buffer
+ * ainda estiver vazio, o vetor passa a ser o buffer, sem cpia.
+ */
+void ListaAdjacencia::adicionarArestas(std::vector<std::pair<int, int>>&& arestas) {
+    const int n = numeroDeVertices;
+    arestas.erase(std::remove_if(arestas.begin(), arestas.end(), [n](const std::pair<int, int>& a) {
+        return a.first <= 0 || a.first > n || a.second <= 0 || a.second > n || a.first == a.second;
+    }), arestas.end());
+    if (arestasTemporarias.empty()) {
+        arestasTemporarias = std::move(arestas);
+    }
+    else {
+        arestasTemporarias.insert(arestasTemporarias.end(), arestas.begin(), arestas.end());
+    }
+}
+
 /**
  * @brief Constri a estrutura CSR final a partir das arestas armazenadas.
  * @details Este  o passo mais importante. Ele calcula os graus, determina os
  * ponteiros de incio de cada lista de vizinhos e preenche a lista de vizinhos final.
  */
 void ListaAdjacencia::finalizarConstrucao() {
-    this->numeroDeArestas = arestasTemporarias.size();
+    // Os ponteiros de incio so int e cada aresta ocupa duas posies em listaVizinhos
+    const long long totalEntradas = 2LL * static_cast<long long>(arestasTemporarias.size());
+    if (totalEntradas > std::numeric_limits<int>::max()) {
+        throw std::runtime_error("Grafo grande demais para o CSR: " + std::to_string(totalEntradas) +
+            " entradas (limite de " + std::to_string(std::numeric_limits<int>::max()) + ").");
+    }
+    this->numeroDeArestas = static_cast<int>(arestasTemporarias.size());
 
     // Bloco 1: Contagem dos graus de cada vrtice
     for (const auto& aresta : arestasTemporarias) {
@@ -104,4 +130,31 @@ std::vector<int> ListaAdjacencia::obterVizinhos(int vertice) const {
 
     // Cria e retorna um novo vetor contendo apenas os vizinhos deste vrtice
     return std::vector<int>(inicio, fim);
+}
+
+/**
+ * @brief Retorna os ponteiros de incio do CSR (sem cpia).
+ */
+const std::vector<int>& ListaAdjacencia::obterPonteirosInicio() const {
+    return ponteirosInicio;
+}
+
+/**
+ * @brief Retorna o vetor de vizinhos do CSR (sem cpia).
+ */
+const std::vector<int>& ListaAdjacencia::obterListaVizinhos() const {
+    return listaVizinhos;
+}
+
+/**
+ * @brief Memria do CSR e, antes da finalizao, dos buffers de construo.
+ * @details Antes de finalizarConstrucao() domina o buffer de pares (8 bytes por aresta);
+ * depois ficam s ponteirosInicio (V + 2 inteiros) e listaVizinhos (2E inteiros).
+ */
+size_t ListaAdjacencia::bytesUtilizados() const {
+    return sizeof(*this)
+        + ponteirosInicio.capacity() * sizeof(int)
+        + listaVizinhos.capacity() * sizeof(int)
+        + grausTemporarios.capacity() * sizeof(int)
+        + arestasTemporarias.capacity() * sizeof(std::pair<int, int>);
 }
\ No newline at end of file
@@ -32,10 +32,25 @@ public:
 
     // Bloco: Implementao do "contrato" da interface Representacao
     void adicionarAresta(int u, int v) override;
+    void adicionarArestas(std::vector<std::pair<int, int>>&& arestas) override;
     void finalizarConstrucao() override;
+    size_t bytesUtilizados() const override;
     int obterGrau(int vertice) const override;
     std::vector<int> obterVizinhos(int vertice) const override;
 
+    /**
+     * @brief Acesso direto aos ponteiros de incio do CSR (tamanho V + 2).
+     * @details O grau de v  ponteirosInicio[v + 1] - ponteirosInicio[v]; permite que
+     * algoritmos percorram os graus sem uma chamada virtual por vrtice.
+     */
+    const std::vector<int>& obterPonteirosInicio() const;
+
+    /**
+     * @brief Acesso direto ao vetor de vizinhos do CSR (os de v ficam em
+     * [ponteirosInicio[v], ponteirosInicio[v + 1]), em ordem crescente).
+     */
+    const std::vector<int>& obterListaVizinhos() const;
+
 private:
     int numeroDeVertices;
     int numeroDeArestas;
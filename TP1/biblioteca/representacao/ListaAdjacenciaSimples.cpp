@@ -56,4 +56,21 @@ std::vector<int> ListaAdjacenciaSimples::obterVizinhos(int vertice) const {
     // Copia os elementos da lista de adjacncia para um novo vetor e o retorna.
     const auto& vizinhos_lista = listaDeAdjacencia[vertice];
     return std::vector<int>(vizinhos_lista.begin(), vizinhos_lista.end());
+}
+
+/**
+ * @brief Memria do vetor de listas e de todos os ns.
+ * @details Cada n de std::list guarda dois ponteiros (anterior e prximo) e o valor,
+ * arredondados para o alinhamento de ponteiro: 24 bytes por vizinho em 64 bits, sem
+ * contar o cabealho do malloc em cada n.
+ */
+size_t ListaAdjacenciaSimples::bytesUtilizados() const {
+    const size_t alinhamento = alignof(void*);
+    const size_t bytesPorNo = (2 * sizeof(void*) + sizeof(int) + alinhamento - 1) / alinhamento * alinhamento;
+
+    size_t total = sizeof(*this) + listaDeAdjacencia.capacity() * sizeof(std::list<int>);
+    for (const auto& lista : listaDeAdjacencia) {
+        total += lista.size() * bytesPorNo;
+    }
+    return total;
 }
\ No newline at end of file
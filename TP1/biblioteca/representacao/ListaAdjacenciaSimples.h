@@ -33,6 +33,7 @@ public:
     void adicionarAresta(int u, int v) override;
     int obterGrau(int vertice) const override;
     std::vector<int> obterVizinhos(int vertice) const override;
+    size_t bytesUtilizados() const override;
 
 private:
     int numeroDeVertices;
@@ -73,4 +73,15 @@ std::vector<int> MatrizAdjacencia::obterVizinhos(int vertice) const {
         }
     }
     return vizinhos;
+}
+
+/**
+ * @brief Memria da matriz: um std::vector<bool> (1 bit por posio) por linha.
+ */
+size_t MatrizAdjacencia::bytesUtilizados() const {
+    size_t total = sizeof(*this) + matriz.capacity() * sizeof(std::vector<bool>);
+    for (const auto& linha : matriz) {
+        total += bytesVetorBool(linha);
+    }
+    return total;
 }
\ No newline at end of file
@@ -31,6 +31,7 @@ public:
     void adicionarAresta(int u, int v) override;
     int obterGrau(int vertice) const override;
     std::vector<int> obterVizinhos(int vertice) const override;
+    size_t bytesUtilizados() const override;
 
 private:
     // A matriz de adjacncia. Usamos bool para economizar espao.
@@ -52,4 +52,8 @@ std::vector<int> MatrizAdjacenciaTriangular::obterVizinhos(int vertice) const {
         }
     }
     return vizinhos;
+}
+
+size_t MatrizAdjacenciaTriangular::bytesUtilizados() const {
+    return sizeof(*this) + bytesVetorBool(matrizTriangular);
 }
\ No newline at end of file
@@ -7,6 +7,9 @@
  */
 
 #include <vector>
+#include <utility>
+#include <cstddef>
+#include <climits>
 
  /**
   * @class Representacao
@@ -30,6 +33,18 @@ public:
      */
     virtual void adicionarAresta(int u, int v) = 0;
 
+    /**
+     * @brief Adiciona um lote de arestas (ex: vindas de um gerador sinttico).
+     * @details A implementao padro chama adicionarAresta para cada par; representaes
+     * com buffer de construo (CSR) podem assumir o vetor sem copi-lo.
+     * @param arestas Pares (u, v) indexados em 1; o vetor  consumido.
+     */
+    virtual void adicionarArestas(std::vector<std::pair<int, int>>&& arestas) {
+        for (const auto& aresta : arestas) adicionarAresta(aresta.first, aresta.second);
+        arestas.clear();
+        arestas.shrink_to_fit();
+    }
+
     /**
      * @brief Obtm o grau de um vrtice especfico. (Mtodo virtual puro)
      * @param vertice O vrtice (indexado em 1) cujo grau  desejado.
@@ -50,4 +65,22 @@ public:
      * A implementao padro  vazia, no fazendo nada.
      */
     virtual void finalizarConstrucao() { /* Vazio por padro */ }
+
+    /**
+     * @brief Memria ocupada pela representao, em bytes. (Mtodo virtual puro)
+     * @details Soma o prprio objeto e a capacidade reservada de cada estrutura interna
+     * (inclusive os buffers temporrios que ainda existirem), sem o cabealho que o
+     * alocador acrescenta a cada bloco. Chamado antes de finalizarConstrucao(), mostra
+     * o custo da fase de construo.
+     * @return O nmero de bytes.
+     */
+    virtual size_t bytesUtilizados() const = 0;
+
+protected:
+    /**
+     * @brief Bytes do armazenamento de um std::vector<bool> (um bit por posio reservada).
+     */
+    static size_t bytesVetorBool(const std::vector<bool>& vetor) {
+        return (vetor.capacity() + CHAR_BIT - 1) / CHAR_BIT;
+    }
 };
\ No newline at end of file
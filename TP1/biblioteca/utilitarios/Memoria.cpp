@@ -0,0 +1,147 @@
+/**
+ * @file Memoria.cpp
+ * @brief Implementação da medição de memória (Linux, Windows e, parcialmente, outros POSIX).
+ */
+
+#include "Memoria.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define PSAPI_VERSION 2 // GetProcessMemoryInfo vem do kernel32 (K32GetProcessMemoryInfo)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <malloc.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#define GRAFOS_TEM_MALLINFO2 1
+#endif
+
+namespace {
+
+#if defined(__linux__)
+// Lê um campo "Nome:   123 kB" de /proc/self/status, em bytes (-1 se não existir)
+long long lerCampoStatus(const std::string& conteudo, const char* campo) {
+    size_t posicao = conteudo.find(campo);
+    if (posicao == std::string::npos) return -1;
+    long long valorKB = -1;
+    if (std::sscanf(conteudo.c_str() + posicao + std::strlen(campo), " %lld", &valorKB) != 1) return -1;
+    return valorKB * 1024;
+}
+#endif
+
+double milissegundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+long long diferenca(long long depois, long long antes) {
+    return (depois < 0 || antes < 0) ? -1 : depois - antes;
+}
+
+// Mede a carga feita por 'construir', que recebe o observador de fases e cria o grafo
+template <class Construtor>
+MedicaoCarga medirCarga(Construtor&& construir) {
+    MedicaoCarga medicao;
+    medicao.picoPorFase = reiniciarPicoMemoria();
+    medicao.inicial = lerMemoriaProcesso();
+
+    auto inicioFase = std::chrono::steady_clock::now();
+    medicao.grafo = construir([&](FaseCarga fase, const Grafo& grafo) {
+        if (fase == FaseCarga::LEITURA) {
+            medicao.tempoLeituraMs = milissegundosDesde(inicioFase);
+            medicao.aposLeitura = lerMemoriaProcesso();
+            medicao.bytesLeitura = grafo.bytesUtilizados();
+            medicao.picoPorFase = reiniciarPicoMemoria() && medicao.picoPorFase;
+        } else {
+            medicao.tempoFinalizacaoMs = milissegundosDesde(inicioFase);
+            medicao.aposFinalizacao = lerMemoriaProcesso();
+            medicao.bytesFinal = grafo.bytesUtilizados();
+        }
+        inicioFase = std::chrono::steady_clock::now();
+    });
+    return medicao;
+}
+
+} // namespace
+
+AmostraMemoria lerMemoriaProcesso() {
+    AmostraMemoria amostra;
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS contadores{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &contadores, sizeof(contadores))) {
+        amostra.rssBytes = static_cast<long long>(contadores.WorkingSetSize);
+        amostra.picoRssBytes = static_cast<long long>(contadores.PeakWorkingSetSize);
+    }
+#elif defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string conteudo((std::istreambuf_iterator<char>(status)), std::istreambuf_iterator<char>());
+    amostra.rssBytes = lerCampoStatus(conteudo, "VmRSS:");
+    amostra.picoRssBytes = lerCampoStatus(conteudo, "VmHWM:");
+#else
+    struct rusage uso {};
+    if (getrusage(RUSAGE_SELF, &uso) == 0) {
+#if defined(__APPLE__)
+        amostra.picoRssBytes = static_cast<long long>(uso.ru_maxrss);        // bytes no macOS
+#else
+        amostra.picoRssBytes = static_cast<long long>(uso.ru_maxrss) * 1024; // KB nos demais
+#endif
+    }
+#endif
+
+#if defined(GRAFOS_TEM_MALLINFO2)
+    struct mallinfo2 info = mallinfo2();
+    amostra.heapEmUsoBytes = static_cast<long long>(info.uordblks + info.hblkhd); // arena + blocos mmap
+#endif
+    return amostra;
+}
+
+bool reiniciarPicoMemoria() {
+#if defined(__linux__)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (!clearRefs) return false;
+    clearRefs << "5";
+    clearRefs.flush();
+    return static_cast<bool>(clearRefs);
+#else
+    return false;
+#endif
+}
+
+long long MedicaoCarga::picoLeituraBytes() const {
+    return diferenca(aposLeitura.picoRssBytes, inicial.rssBytes);
+}
+
+long long MedicaoCarga::picoFinalizacaoBytes() const {
+    return diferenca(aposFinalizacao.picoRssBytes, inicial.rssBytes);
+}
+
+long long MedicaoCarga::rssRetidoBytes() const {
+    return diferenca(aposFinalizacao.rssBytes, inicial.rssBytes);
+}
+
+long long MedicaoCarga::heapRetidoBytes() const {
+    return diferenca(aposFinalizacao.heapEmUsoBytes, inicial.heapEmUsoBytes);
+}
+
+MedicaoCarga medirCargaGrafo(const std::string& caminhoArquivo, TipoRepresentacao tipo) {
+    return medirCarga([&](const auto& aoConcluirFase) {
+        return std::make_unique<Grafo>(caminhoArquivo, tipo, aoConcluirFase);
+    });
+}
+
+MedicaoCarga medirCargaGrafo(const ParametrosGerador& parametros, TipoRepresentacao tipo, int numThreads) {
+    return medirCarga([&](const auto& aoConcluirFase) {
+        GrafoGerado<std::pair<int, int>> gerado = gerarArestas<std::pair<int, int>>(parametros, numThreads);
+        return std::make_unique<Grafo>(gerado.numeroVertices, std::move(gerado.arestas), tipo, aoConcluirFase);
+    });
+}
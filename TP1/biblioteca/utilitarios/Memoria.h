@@ -0,0 +1,94 @@
+#pragma once
+/**
+ * @file Memoria.h
+ * @brief Medição automática da memória usada na carga dos grafos.
+ * @details Substitui a verificação manual no gerenciador de tarefas: lê o RSS atual e
+ * o pico de RSS do processo (/proc/self/status no Linux), os bytes em uso no heap
+ * (estatísticas do alocador) e o tamanho exato de cada representação
+ * (Representacao::bytesUtilizados), separando a leitura das arestas da finalização.
+ */
+
+#include <memory>
+#include <string>
+
+#include "../interface/Grafo.h"
+#include "../../../comum/Geradores.h"
+
+/**
+ * @struct AmostraMemoria
+ * @brief Memória do processo em um instante, em bytes (-1 = indisponível nesta plataforma).
+ */
+struct AmostraMemoria {
+    long long rssBytes = -1;       // Memória residente atual (VmRSS)
+    long long picoRssBytes = -1;   // Maior RSS desde o início ou desde reiniciarPicoMemoria() (VmHWM)
+    long long heapEmUsoBytes = -1; // Bytes entregues pelo malloc e ainda não liberados (glibc)
+};
+
+/**
+ * @brief Lê a memória atual do processo.
+ */
+AmostraMemoria lerMemoriaProcesso();
+
+/**
+ * @brief Faz o pico de RSS voltar ao RSS atual, para medir o pico de uma etapa isolada.
+ * @details No Linux escreve "5" em /proc/self/clear_refs (kernel 4.0 ou mais novo).
+ * @return false se a plataforma não permite; o pico continua sendo o do processo todo.
+ */
+bool reiniciarPicoMemoria();
+
+/**
+ * @struct MedicaoCarga
+ * @brief Memória e tempo de carga de um grafo, separados por FaseCarga.
+ * @details O pico de cada fase é o VmHWM no fim da fase, com o pico reiniciado no início
+ * dela. Como o alocador não devolve toda a memória liberada ao sistema, o RSS final pode
+ * ficar acima do necessário; heapEmUsoBytes e bytesFinal não têm esse problema.
+ */
+struct MedicaoCarga {
+    std::unique_ptr<Grafo> grafo;
+    double tempoLeituraMs = 0.0;
+    double tempoFinalizacaoMs = 0.0;
+
+    AmostraMemoria inicial;         // Antes de abrir o arquivo
+    AmostraMemoria aposLeitura;     // Fim da fase LEITURA
+    AmostraMemoria aposFinalizacao; // Fim da fase FINALIZACAO
+    bool picoPorFase = false;       // Falso se reiniciarPicoMemoria() não funcionou
+
+    size_t bytesLeitura = 0; // Grafo::bytesUtilizados() no fim da leitura (com os buffers de construção)
+    size_t bytesFinal = 0;   // Grafo::bytesUtilizados() depois da finalização
+
+    /**
+     * @brief Crescimento do pico de RSS durante a leitura (ou -1).
+     */
+    long long picoLeituraBytes() const;
+
+    /**
+     * @brief Crescimento do pico de RSS durante a finalização, em relação ao início da carga (ou -1).
+     * @details Em relação ao início (e não ao fim da leitura) para ser comparável ao de
+     * picoLeituraBytes: o maior dos dois é o custo máximo de carregar o grafo.
+     */
+    long long picoFinalizacaoBytes() const;
+
+    /**
+     * @brief Crescimento do RSS entre o início da carga e o fim da finalização (ou -1).
+     */
+    long long rssRetidoBytes() const;
+
+    /**
+     * @brief Crescimento do heap em uso entre o início da carga e o fim da finalização (ou -1).
+     */
+    long long heapRetidoBytes() const;
+};
+
+/**
+ * @brief Carrega um grafo medindo o tempo e a memória de cada fase.
+ * @throws std::runtime_error nas mesmas condições do construtor de Grafo.
+ */
+MedicaoCarga medirCargaGrafo(const std::string& caminhoArquivo, TipoRepresentacao tipo);
+
+/**
+ * @brief Gera um grafo sintético (Geradores.h) medindo o tempo e a memória de cada fase.
+ * @details A geração das arestas conta como a fase LEITURA, no lugar da leitura do arquivo.
+ * @param numThreads Threads da geração (<= 0 usa o número de núcleos).
+ * @throws std::runtime_error se os parâmetros forem inválidos ou o grafo não couber na representação.
+ */
+MedicaoCarga medirCargaGrafo(const ParametrosGerador& parametros, TipoRepresentacao tipo, int numThreads = 0);
@@ -0,0 +1,25 @@
+/**
+ * @file VisaoCSR.cpp
+ * @brief Implementação da VisaoCSR.
+ */
+
+#include "VisaoCSR.h"
+#include "../interface/Grafo.h"
+#include "../representacao/ListaAdjacencia.h"
+
+VisaoCSR::VisaoCSR(const Grafo& grafo) {
+    if (const ListaAdjacencia* csr = grafo.obterListaAdjacencia()) {
+        ponteiros = csr->obterPonteirosInicio().data();
+        vizinhos = csr->obterListaVizinhos().data();
+        return;
+    }
+    const int n = grafo.obterNumeroVertices();
+    ponteirosCopia.assign(static_cast<size_t>(n) + 2, 0);
+    for (int u = 1; u <= n; ++u) {
+        std::vector<int> lista = grafo.obterVizinhos(u);
+        vizinhosCopia.insert(vizinhosCopia.end(), lista.begin(), lista.end());
+        ponteirosCopia[u + 1] = static_cast<int>(vizinhosCopia.size());
+    }
+    ponteiros = ponteirosCopia.data();
+    vizinhos = vizinhosCopia.data();
+}
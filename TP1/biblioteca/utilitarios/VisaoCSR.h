@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * @file VisaoCSR.h
+ * @brief Acesso somente leitura aos vetores CSR de um Grafo, para os algoritmos de varredura.
+ */
+
+#include <vector>
+
+class Grafo;
+
+/**
+ * @struct VisaoCSR
+ * @brief Ponteiros para os vetores CSR do grafo (os vizinhos de u ficam em
+ * vizinhos[ponteiros[u] .. ponteiros[u + 1])).
+ * @details Na representação ListaAdjacencia os ponteiros apontam para os próprios
+ * vetores do grafo (sem cópia); nas demais, uma cópia CSR é montada uma vez a partir
+ * de obterVizinhos. O grafo precisa continuar vivo enquanto a visão for usada.
+ */
+struct VisaoCSR {
+    const int* ponteiros = nullptr;
+    const int* vizinhos = nullptr;
+
+    explicit VisaoCSR(const Grafo& grafo);
+
+private:
+    std::vector<int> ponteirosCopia, vizinhosCopia;
+};
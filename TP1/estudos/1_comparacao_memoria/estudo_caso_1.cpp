@@ -1,14 +1,22 @@
 /**
  * @file estudo_caso_1.cpp
  * @brief Implementao do Estudo de Caso 1: Comparao de consumo de memria.
+ * @details A memria  medida automaticamente (ver utilitarios/Memoria.h): tamanho exato
+ * de cada representao antes e depois da finalizao, pico de RSS de cada fase da carga,
+ * RSS e heap retidos. Os resultados vo para o console e para um CSV.
  */
 #include "../estudos.h"
 #include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <vector>
+#include <utility>
 #include <limits>
 #include <stdexcept>
 #include "../../biblioteca/interface/Grafo.h"
+#include "../../biblioteca/utilitarios/Memoria.h"
 
  // --- Funes Auxiliares (locais a este arquivo) ---
 static void pausarParaContinuar_EC1() {
@@ -25,59 +33,78 @@ static void exibirMenu_EC1() {
     std::cout << "---------------------------------" << std::endl;
 }
 
-static void executarTesteDeListas_EC1() {
+// Converte bytes para MiB; valores negativos (medida indisponvel) viram "n/d"
+static std::string formatarMiB_EC1(long long bytes) {
+    if (bytes < 0) return "n/d";
+    std::ostringstream texto;
+    texto << std::fixed << std::setprecision(2) << bytes / (1024.0 * 1024.0);
+    return texto.str();
+}
+
+/**
+ * @brief Carrega cada grafo com cada representao, mede a memria e salva o CSV.
+ * @param representacoes Pares (nome exibido, tipo), carregados nesta ordem.
+ * @param nomeArquivoCSV Arquivo de sada (no diretrio atual).
+ */
+static void executarComparacao_EC1(const std::vector<std::pair<std::string, TipoRepresentacao>>& representacoes,
+    const std::string& nomeArquivoCSV) {
     std::vector<std::string> nomesGrafos = { "grafo_1.txt", "grafo_2.txt", "grafo_3.txt", "grafo_4.txt", "grafo_5.txt", "grafo_6.txt" };
-    std::cout << "\n--- Iniciando Teste de LISTAS ---" << std::endl;
+
+    std::ofstream arquivoCSV(nomeArquivoCSV);
+    arquivoCSV << "Grafo,Representacao,Vertices,Arestas,BytesLeitura,BytesFinal,PicoRSSLeitura_bytes,"
+        "PicoRSSFinalizacao_bytes,RSSRetido_bytes,HeapRetido_bytes,TempoLeitura_ms,TempoFinalizacao_ms,PicoPorFase,Status\n";
+
+    std::cout << "\n" << std::left << std::setw(14) << "Grafo" << std::setw(12) << "Repr."
+        << std::right << std::setw(12) << "Estrut.MiB" << std::setw(12) << "Final MiB"
+        << std::setw(12) << "PicoL MiB" << std::setw(12) << "PicoF MiB"
+        << std::setw(12) << "RSS MiB" << std::setw(12) << "Heap MiB" << std::endl;
+
     for (const auto& nomeBase : nomesGrafos) {
         std::string caminhoCompleto = caminhoEstudos(nomeBase);
-        std::cout << "\n--- Processando: " << nomeBase << " ---" << std::endl;
-        try {
-            {
-                std::cout << "[LISTA 1/2] Carregando com LISTA SIMPLES..." << std::endl;
-                Grafo grafo(caminhoCompleto, TipoRepresentacao::LISTA_ADJACENCIA_SIMPLES);
-                std::cout << "  > Vertices: " << grafo.obterNumeroVertices() << " | Arestas: " << grafo.obterNumeroArestas() << std::endl;
-                std::cout << "\n  >>> ACAO: Verifique a memoria. Pressione ENTER para continuar..." << std::endl;
-                std::cin.get();
+        for (const auto& [nomeRepresentacao, tipo] : representacoes) {
+            try {
+                // O grafo  destrudo ao fim do bloco, antes da prxima carga
+                MedicaoCarga m = medirCargaGrafo(caminhoCompleto, tipo);
+
+                std::cout << std::left << std::setw(14) << nomeBase << std::setw(12) << nomeRepresentacao << std::right
+                    << std::setw(12) << formatarMiB_EC1(static_cast<long long>(m.bytesLeitura))
+                    << std::setw(12) << formatarMiB_EC1(static_cast<long long>(m.bytesFinal))
+                    << std::setw(12) << formatarMiB_EC1(m.picoLeituraBytes())
+                    << std::setw(12) << formatarMiB_EC1(m.picoFinalizacaoBytes())
+                    << std::setw(12) << formatarMiB_EC1(m.rssRetidoBytes())
+                    << std::setw(12) << formatarMiB_EC1(m.heapRetidoBytes()) << std::endl;
+
+                arquivoCSV << nomeBase << "," << nomeRepresentacao << "," << m.grafo->obterNumeroVertices() << ","
+                    << m.grafo->obterNumeroArestas() << "," << m.bytesLeitura << "," << m.bytesFinal << ","
+                    << m.picoLeituraBytes() << "," << m.picoFinalizacaoBytes() << "," << m.rssRetidoBytes() << ","
+                    << m.heapRetidoBytes() << "," << m.tempoLeituraMs << "," << m.tempoFinalizacaoMs << ","
+                    << (m.picoPorFase ? "sim" : "nao") << ",OK\n";
             }
-            {
-                std::cout << "\n[LISTA 2/2] Carregando com LISTA OTIMIZADA (CSR)..." << std::endl;
-                Grafo grafo(caminhoCompleto, TipoRepresentacao::LISTA_ADJACENCIA);
-                std::cout << "  > Vertices: " << grafo.obterNumeroVertices() << " | Arestas: " << grafo.obterNumeroArestas() << std::endl;
-                std::cout << "\n  >>> ACAO: Verifique a memoria. Pressione ENTER para o proximo grafo..." << std::endl;
-                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                std::cin.get();
+            catch (const std::exception& e) {
+                std::cerr << "ERRO (" << nomeBase << ", " << nomeRepresentacao << "): " << e.what() << std::endl;
+                arquivoCSV << nomeBase << "," << nomeRepresentacao << ",,,,,,,,,,,,FALHA\n";
             }
         }
-        catch (const std::exception& e) { std::cerr << "ERRO: " << e.what() << std::endl; }
     }
+    std::cout << "\nColunas: Estrut. = representacao ao fim da leitura (com buffers de construcao);"
+        " Final = apos a finalizacao; PicoL/PicoF = crescimento do pico de RSS ate o fim da leitura/finalizacao;"
+        " RSS/Heap = memoria retida com o grafo carregado (-1/n/d = indisponivel)." << std::endl;
+    std::cout << "Resultados salvos em '" << nomeArquivoCSV << "'." << std::endl;
+}
+
+static void executarTesteDeListas_EC1() {
+    std::cout << "\n--- Iniciando Teste de LISTAS ---" << std::endl;
+    executarComparacao_EC1({ { "simples", TipoRepresentacao::LISTA_ADJACENCIA_SIMPLES },
+                             { "csr", TipoRepresentacao::LISTA_ADJACENCIA } },
+        "resultados_estudo1_memoria_listas.csv");
     std::cout << "\n--- Teste de Listas Concluido! ---" << std::endl;
 }
 
 static void executarTesteDeMatrizes_EC1() {
-    std::vector<std::string> nomesGrafos = { "grafo_1.txt", "grafo_2.txt", "grafo_3.txt", "grafo_4.txt", "grafo_5.txt", "grafo_6.txt" };
     std::cout << "\n--- Iniciando Teste de MATRIZES ---" << std::endl;
-    for (const auto& nomeBase : nomesGrafos) {
-        std::string caminhoCompleto = caminhoEstudos(nomeBase);
-        std::cout << "\n--- Processando: " << nomeBase << " ---" << std::endl;
-        try {
-            {
-                std::cout << "[MATRIZ 1/2] Carregando com MATRIZ CLASSICA..." << std::endl;
-                Grafo grafo(caminhoCompleto, TipoRepresentacao::MATRIZ_ADJACENCIA);
-                std::cout << "  > Vertices: " << grafo.obterNumeroVertices() << " | Arestas: " << grafo.obterNumeroArestas() << std::endl;
-                std::cout << "\n  >>> ACAO: Verifique a memoria. Pressione ENTER para continuar..." << std::endl;
-                std::cin.get();
-            }
-            {
-                std::cout << "\n[MATRIZ 2/2] Carregando com MATRIZ TRIANGULAR..." << std::endl;
-                Grafo grafo(caminhoCompleto, TipoRepresentacao::MATRIZ_ADJACENCIA_TRIANGULAR);
-                std::cout << "  > Vertices: " << grafo.obterNumeroVertices() << " | Arestas: " << grafo.obterNumeroArestas() << std::endl;
-                std::cout << "\n  >>> ACAO: Verifique a memoria. Pressione ENTER para o proximo grafo..." << std::endl;
-                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                std::cin.get();
-            }
-        }
-        catch (const std::exception& e) { std::cerr << "ERRO: " << e.what() << std::endl; }
-    }
+    executarComparacao_EC1({ { "matriz", TipoRepresentacao::MATRIZ_ADJACENCIA },
+                             { "triangular", TipoRepresentacao::MATRIZ_ADJACENCIA_TRIANGULAR } },
+        "resultados_estudo1_memoria_matrizes.csv");
     std::cout << "\n--- Teste de Matrizes Concluido! ---" << std::endl;
 }
 
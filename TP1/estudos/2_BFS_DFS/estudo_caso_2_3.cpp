@@ -11,15 +11,15 @@
 #include <fstream>
 #include <stdexcept>
 #include <iomanip>
-#include <numeric>
-#include <algorithm>
-#include <cmath>
 #include "../../biblioteca/interface/Grafo.h"
 #include "../../biblioteca/algoritmos/BFS.h"
 #include "../../biblioteca/algoritmos/DFS.h"
+#include "../../../comum/Benchmark.h"
 
- // Varivel de controle
+ // Variveis de controle
 const int NUM_EXECUCOES_POR_AMOSTRA = 100;
+const int NUM_AQUECIMENTO_POR_AMOSTRA = 5;          // Execues descartadas antes da medio
+const unsigned long long SEMENTE_ORIGENS = 42;      // Mesmas origens em todas as amostras
 
 // Estruturas de dados locais
 struct TarefaBenchmark {
@@ -28,12 +28,9 @@ struct TarefaBenchmark {
     std::string nomeRepr;
 };
 
-struct ResultadoAmostra {
-    double tempoTotalMs = 0.0, tempoMedioMs = 0.0, tempoMinMs = 0.0, tempoMaxMs = 0.0, desvioPadraoMs = 0.0;
-};
-
-// Prottipo da funo auxiliar
-static ResultadoAmostra executarAmostra(const Grafo& grafo, const std::string& algoritmo, int numExecucoes);
+// Prottipos das funes auxiliares
+static EstatisticasTempo executarAmostra(const Grafo& grafo, const std::string& algoritmo, int numExecucoes);
+static void escreverLinha(std::ofstream& arquivo, const std::string& prefixo, const Grafo& grafo, const EstatisticasTempo& e);
 
 
 void executarEstudoDeCasoTempo() {
@@ -49,7 +46,7 @@ void executarEstudoDeCasoTempo() {
     }
 
     std::ofstream arquivoResultados("resultados_benchmark_final_detalhado.csv");
-    arquivoResultados << "Grafo,Representacao,Algoritmo,Vertices,Arestas,NumExecucoes,TempoTotal_ms,TempoMedio_ms,TempoMin_ms,TempoMax_ms,DesvioPadrao_ms,Status\n";
+    arquivoResultados << "Grafo,Representacao,Algoritmo,Vertices,Arestas,NumExecucoes,TempoTotal_ms,TempoMedio_ms,TempoMin_ms,TempoMax_ms,DesvioPadrao_ms,Status,TempoMediana_ms,TempoP90_ms,TempoP99_ms,Outliers\n";
 
     std::vector<TarefaBenchmark> tarefas;
     std::vector<std::string> grafosPequenos = { "grafo_1.txt", "grafo_2.txt" };
@@ -76,20 +73,20 @@ void executarEstudoDeCasoTempo() {
             Grafo grafo(caminhoEstudos(tarefa.nomeGrafo), tarefa.tipoRepr);
 
             std::cout << "  - Executando Amostra BFS..." << std::flush;
-            ResultadoAmostra resBfs = executarAmostra(grafo, "BFS", NUM_EXECUCOES_POR_AMOSTRA);
-            std::cout << " OK (" << resBfs.tempoMedioMs << " ms/busca)" << std::endl;
-            arquivoResultados << tarefa.nomeGrafo << "," << tarefa.nomeRepr << ",BFS," << grafo.obterNumeroVertices() << "," << grafo.obterNumeroArestas() << "," << NUM_EXECUCOES_POR_AMOSTRA << "," << resBfs.tempoTotalMs << "," << resBfs.tempoMedioMs << "," << resBfs.tempoMinMs << "," << resBfs.tempoMaxMs << "," << resBfs.desvioPadraoMs << ",OK\n";
+            EstatisticasTempo resBfs = executarAmostra(grafo, "BFS", NUM_EXECUCOES_POR_AMOSTRA);
+            std::cout << " OK (" << resBfs.media << " ms/busca)" << std::endl;
+            escreverLinha(arquivoResultados, tarefa.nomeGrafo + "," + tarefa.nomeRepr + ",BFS,", grafo, resBfs);
 
             std::cout << "  - Executando Amostra DFS..." << std::flush;
-            ResultadoAmostra resDfs = executarAmostra(grafo, "DFS", NUM_EXECUCOES_POR_AMOSTRA);
-            std::cout << " OK (" << resDfs.tempoMedioMs << " ms/busca)" << std::endl;
-            arquivoResultados << tarefa.nomeGrafo << "," << tarefa.nomeRepr << ",DFS," << grafo.obterNumeroVertices() << "," << grafo.obterNumeroArestas() << "," << NUM_EXECUCOES_POR_AMOSTRA << "," << resDfs.tempoTotalMs << "," << resDfs.tempoMedioMs << "," << resDfs.tempoMinMs << "," << resDfs.tempoMaxMs << "," << resDfs.desvioPadraoMs << ",OK\n";
+            EstatisticasTempo resDfs = executarAmostra(grafo, "DFS", NUM_EXECUCOES_POR_AMOSTRA);
+            std::cout << " OK (" << resDfs.media << " ms/busca)" << std::endl;
+            escreverLinha(arquivoResultados, tarefa.nomeGrafo + "," + tarefa.nomeRepr + ",DFS,", grafo, resDfs);
 
         }
         catch (const std::exception& e) {
             std::cerr << "  > ERRO: " << e.what() << std::endl;
-            arquivoResultados << tarefa.nomeGrafo << "," << tarefa.nomeRepr << ",BFS,-1,-1," << NUM_EXECUCOES_POR_AMOSTRA << ",-1,-1,-1,-1,-1,FALHA\n";
-            arquivoResultados << tarefa.nomeGrafo << "," << tarefa.nomeRepr << ",DFS,-1,-1," << NUM_EXECUCOES_POR_AMOSTRA << ",-1,-1,-1,-1,-1,FALHA\n";
+            arquivoResultados << tarefa.nomeGrafo << "," << tarefa.nomeRepr << ",BFS,-1,-1," << NUM_EXECUCOES_POR_AMOSTRA << ",-1,-1,-1,-1,-1,FALHA,-1,-1,-1,-1\n";
+            arquivoResultados << tarefa.nomeGrafo << "," << tarefa.nomeRepr << ",DFS,-1,-1," << NUM_EXECUCOES_POR_AMOSTRA << ",-1,-1,-1,-1,-1,FALHA,-1,-1,-1,-1\n";
         }
     }
 
@@ -97,40 +94,22 @@ void executarEstudoDeCasoTempo() {
     std::cout << "\n--- Benchmark completo! Resultados salvos em 'resultados_benchmark_final_detalhado.csv' ---" << std::endl;
 }
 
-static ResultadoAmostra executarAmostra(const Grafo& grafo, const std::string& algoritmo, int numExecucoes) {
-    ResultadoAmostra resultado;
-    if (numExecucoes == 0) return resultado;
+static EstatisticasTempo executarAmostra(const Grafo& grafo, const std::string& algoritmo, int numExecucoes) {
+    if (numExecucoes == 0) return {};
     BFS algoritmoBFS;
     DFS algoritmoDFS;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distrib(1, grafo.obterNumeroVertices());
-
-    std::vector<double> temposIndividuais;
-    temposIndividuais.reserve(numExecucoes);
-
-    for (int k = 0; k < numExecucoes; ++k) {
-        int verticeDePartida = distrib(gen);
-        auto inicio = std::chrono::high_resolution_clock::now();
-        if (algoritmo == "BFS") algoritmoBFS.executar(grafo, verticeDePartida);
-        else if (algoritmo == "DFS") algoritmoDFS.executar(grafo, verticeDePartida);
-        auto fim = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double, std::milli> duracao = fim - inicio;
-        temposIndividuais.push_back(duracao.count());
-    }
 
-    if (!temposIndividuais.empty()) {
-        double somaDosTempos = std::accumulate(temposIndividuais.begin(), temposIndividuais.end(), 0.0);
-        resultado.tempoTotalMs = somaDosTempos;
-        resultado.tempoMedioMs = somaDosTempos / numExecucoes;
-        resultado.tempoMinMs = *std::min_element(temposIndividuais.begin(), temposIndividuais.end());
-        resultado.tempoMaxMs = *std::max_element(temposIndividuais.begin(), temposIndividuais.end());
-        double somaDosDesviosQuadrados = 0.0;
-        for (double tempo : temposIndividuais) {
-            somaDosDesviosQuadrados += (tempo - resultado.tempoMedioMs) * (tempo - resultado.tempoMedioMs);
-        }
-        double variancia = somaDosDesviosQuadrados / numExecucoes;
-        resultado.desvioPadraoMs = std::sqrt(variancia);
-    }
-    return resultado;
-}
\ No newline at end of file
+    // Origens sorteadas com semente fixa: BFS, DFS e todas as representaes medem as mesmas buscas
+    std::vector<int> origens = sortearOrigens(grafo.obterNumeroVertices(), NUM_AQUECIMENTO_POR_AMOSTRA + numExecucoes, SEMENTE_ORIGENS);
+    std::vector<double> temposIndividuais = medirExecucoes(NUM_AQUECIMENTO_POR_AMOSTRA, numExecucoes, [&](int k) {
+        if (algoritmo == "BFS") algoritmoBFS.executar(grafo, origens[k]);
+        else if (algoritmo == "DFS") algoritmoDFS.executar(grafo, origens[k]);
+    });
+    return calcularEstatisticasTempo(temposIndividuais);
+}
+
+static void escreverLinha(std::ofstream& arquivo, const std::string& prefixo, const Grafo& grafo, const EstatisticasTempo& e) {
+    arquivo << prefixo << grafo.obterNumeroVertices() << "," << grafo.obterNumeroArestas() << "," << e.amostras << ","
+        << e.total << "," << e.media << "," << e.minimo << "," << e.maximo << "," << e.desvioPadrao << ",OK,"
+        << e.mediana << "," << e.p90 << "," << e.p99 << "," << e.outliers << "\n";
+}
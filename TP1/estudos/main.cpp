@@ -95,6 +95,8 @@ void menuDeAnalise(Grafo& grafo, const std::string& nomeGrafo) {
         std::cout << "3. Encontrar Componentes Conexas" << std::endl;
         std::cout << "4. Exibir Relatorio Completo no Console" << std::endl;
         std::cout << "5. Executar Benchmark de Performance (BFS/DFS)" << std::endl; // NOVA OPO
+        std::cout << "6. Excentricidades e Distribuicao de Distancias (BFS de todos os vertices)" << std::endl;
+        std::cout << "7. Distribuicao de Distancias Aproximada (HyperANF)" << std::endl;
         std::cout << "0. Voltar (para escolher outro grafo)" << std::endl;
         std::cout << "Escolha uma analise: ";
         std::cin >> escolha;
@@ -116,7 +118,11 @@ void menuDeAnalise(Grafo& grafo, const std::string& nomeGrafo) {
                 break;
             }
             case 2: {
-                std::cout << "  > O diametro (aproximado) e: " << grafo.calcularDiametroAproximado() << std::endl;
+                LimitesDiametro limites = grafo.estimarLimitesDiametro(8, 1024);
+                std::cout << "  > O diametro (aproximado) e: " << limites.limiteInferior << std::endl;
+                std::cout << "  > Limites: " << limites.limiteInferior << " <= D <= " << limites.limiteSuperior
+                    << (limites.exato() ? " (exato)" : "") << ", com " << limites.numeroBFS << " BFS" << std::endl;
+                if (!limites.conexo) std::cout << "  > Grafo desconexo: os limites valem para a maior componente." << std::endl;
                 break;
             }
             case 3: {
@@ -125,8 +131,12 @@ void menuDeAnalise(Grafo& grafo, const std::string& nomeGrafo) {
                 break;
             }
             case 4: {
+                std::cout << "Formato (1 = Texto, 2 = JSON): ";
+                int escolhaFormato;
+                std::cin >> escolhaFormato;
+                FormatoRelatorio formato = (escolhaFormato == 2) ? FormatoRelatorio::JSON : FormatoRelatorio::TEXTO;
                 std::cout << "\n";
-                grafo.gerarRelatorioCompleto(std::cout); // <-- Usando a nova funo com std::cout
+                grafo.gerarRelatorioCompleto(std::cout, formato); // <-- Usando a nova funo com std::cout
                 break;
             }
 
@@ -154,6 +164,53 @@ void menuDeAnalise(Grafo& grafo, const std::string& nomeGrafo) {
                 }
                 break;
             }
+            case 6: {
+                ControleExecucao controle;
+                int ultimoPercentual = -1;
+                controle.progresso = [&](long long concluidas, long long total) {
+                    int percentual = static_cast<int>(100 * concluidas / total);
+                    if (percentual != ultimoPercentual) {
+                        ultimoPercentual = percentual;
+                        std::cout << "\r  Processando... " << percentual << "%" << std::flush;
+                    }
+                };
+                ResumoDistancias resumo = grafo.analisarDistancias(controle);
+                std::cout << std::endl;
+
+                int raio = -1, diametro = 0;
+                for (int v = 1; v <= grafo.obterNumeroVertices(); ++v) {
+                    if (raio == -1 || resumo.excentricidade[v] < raio) raio = resumo.excentricidade[v];
+                    diametro = std::max(diametro, resumo.excentricidade[v]);
+                }
+                std::cout << "  > Maior excentricidade: " << diametro
+                    << (resumo.paresInalcancaveis > 0 ? " (grafo desconexo: maior distancia dentro de uma componente)" : " (diametro)") << "\n";
+                std::cout << "  > Menor excentricidade: " << raio << "\n";
+                std::cout << "  > Pares inalcancaveis: " << resumo.paresInalcancaveis << "\n";
+                std::cout << "  > Distribuicao de distancias (pares de vertices):\n";
+                for (size_t d = 1; d < resumo.distribuicao.size(); ++d) {
+                    std::cout << "      " << d << ": " << resumo.distribuicao[d] << "\n";
+                }
+                break;
+            }
+            case 7: {
+                std::cout << "Registradores por vertice, em log2 (4 a 16, ex: 6): ";
+                int log2Registradores;
+                std::cin >> log2Registradores;
+                ResultadoHyperANF resultado = grafo.estimarFuncaoVizinhanca(log2Registradores);
+                // Formatao s desta opo: restaura a do std::cout no fim
+                const std::ios::fmtflags formatoAnterior = std::cout.flags();
+                const std::streamsize precisaoAnterior = std::cout.precision();
+                std::cout << std::fixed << std::setprecision(2);
+                std::cout << "  > Iteracoes (maior excentricidade aproximada): " << resultado.iteracoes << "\n";
+                std::cout << "  > Diametro efetivo (90%): " << resultado.diametroEfetivo(0.9) << "\n";
+                std::cout << "  > Distribuicao de distancias (pares de vertices, estimada):\n";
+                for (size_t d = 1; d < resultado.distribuicao.size(); ++d) {
+                    std::cout << "      " << d << ": " << resultado.distribuicao[d] << "\n";
+                }
+                std::cout.flags(formatoAnterior);
+                std::cout.precision(precisaoAnterior);
+                break;
+            }
             case 0: std::cout << "Voltando..." << std::endl; break;
             default: std::cout << "Opcao invalida." << std::endl; break;
             }
@@ -0,0 +1,262 @@
+/**
+ * @file bench.cpp
+ * @brief Executor de benchmarks não interativo do TP2 (Dijkstra com vetor, com heap e em lote).
+ * @details Roda os estudos de tempo sem menus nem pausas e grava os resultados em
+ * JSON ou CSV, para uso em scripts e na detecção de regressões.
+ *
+ * Uso: bench --grafo <arquivo> [--grafo <arquivo> ...] [opções]
+ *   --algoritmo heap,vetor,lote (padrão: heap,vetor)
+ *   --repeticoes N     execuções medidas por amostra (padrão: 100)
+ *   --aquecimento N    execuções descartadas antes da medição (padrão: 5)
+ *   --semente S        semente das origens sorteadas (padrão: 42)
+ *   --threads T        threads do Dijkstra em lote (padrão: 0 = número de núcleos)
+ *   --base <arquivo>   resultado JSON anterior para comparação (opcional)
+ *   --operacoes sim|nao   conta as operações dos algoritmos (heap e vetor) (padrão: nao)
+ *   --contadores sim|nao  lê os contadores do processador em cada execução (padrão: nao)
+ *   --limiar F         variação relativa da mediana tolerada na comparação (padrão: 0.05)
+ *   --formato json|csv (padrão: json)
+ *   --saida <arquivo>  (padrão: saída padrão)
+ *
+ * Um arquivo de grafo que não existir no caminho informado é procurado em
+ * estudos/grafos_em_txt. As origens são sorteadas uma vez por grafo, então as duas
+ * implementações medem as mesmas origens. Grafo com peso negativo é registrado
+ * como falha (a exceção do algoritmo vira o status). Não há opção de representação:
+ * o TP2 tem uma única. Cada execução de "lote" roda o Dijkstra (Heap) para
+ * ORIGENS_POR_LOTE origens com GrafoPesado::executarDijkstraLote e as threads pedidas,
+ * então o tempo por execução mede vazão; heap e vetor medem uma origem por execução.
+ * As contagens de --operacoes não se aplicam ao lote.
+ *
+ * As estatísticas vêm de comum/Benchmark.h (mediana, p90/p99, IC de 95%,
+ * outliers). Com --contadores sim, cada execução medida também registra ciclos,
+ * instruções, faltas de LLC e dTLB e desvios mal previstos (comum/ContadoresHardware.h);
+ * se o sistema não permitir, as colunas ficam vazias. Com --operacoes sim, cada origem
+ * medida é executada mais uma vez, sem cronometrar, com a política ComContagem
+ * (comum/ContagemOperacoes.h), e a saída traz a média por execução de vértices
+ * finalizados, arestas examinadas, relaxamentos, operações de heap e rodadas. Com --base, cada medição é comparada à de mesmo grafo e algoritmo
+ * pelo teste de Mann-Whitney; o código de saída é 3 se houver
+ * regressão (e 1 se alguma medição falhar).
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../biblioteca/interface/GrafoPesado.h"
+#include "../biblioteca/algoritmos/Dijkstra.h"
+#include "../../comum/ExecutorBench.h"
+
+namespace {
+
+    // Mesmos nomes usados no CSV do Estudo de Caso 2
+    const char* ALGORITMOS[] = { "heap", "vetor", "lote" };
+
+    // Origens por execução do algoritmo "lote"
+    const size_t ORIGENS_POR_LOTE = 64;
+
+    struct ConfiguracaoBench : OpcoesBench {
+        std::vector<std::string> grafos;
+        std::vector<std::string> algoritmos{ "heap", "vetor" };
+
+        ConfiguracaoBench() {
+            repeticoes = 100;
+            aquecimento = 5;
+        }
+    };
+
+    void imprimirUso(std::ostream& saida) {
+        saida << "Uso: bench --grafo <arquivo> [--grafo <arquivo> ...]\n"
+            << "             [--algoritmo heap,vetor,lote] [--repeticoes N] [--aquecimento N] [--semente S] [--threads T]\n"
+            << "             [--operacoes sim|nao] [--contadores sim|nao] [--base <arquivo.json>] [--limiar F] [--formato json|csv] [--saida <arquivo>]\n";
+    }
+
+    ConfiguracaoBench lerArgumentos(int argc, char** argv) {
+        ConfiguracaoBench config;
+        percorrerArgumentos(argc, argv, imprimirUso, [&](const std::string& opcao, const std::string& valor) {
+            if (opcao == "--grafo") config.grafos.push_back(valor);
+            else if (opcao == "--algoritmo") config.algoritmos = separarLista(valor);
+            else return lerOpcaoBench(config, opcao, valor);
+            return true;
+        });
+
+        if (config.grafos.empty()) throw std::runtime_error("Informe ao menos um --grafo.");
+        for (const auto& chave : config.algoritmos) {
+            if (std::none_of(std::begin(ALGORITMOS), std::end(ALGORITMOS),
+                [&](const char* a) { return chave == a; })) {
+                throw std::runtime_error("Algoritmo desconhecido: " + chave);
+            }
+        }
+        return config;
+    }
+
+    // bench/bench.cpp -> estudos/grafos_em_txt
+    std::string caminhoAlternativo(const std::string& caminho) {
+        namespace fs = std::filesystem;
+        return (fs::path(__FILE__).parent_path().parent_path() / "estudos" / "grafos_em_txt" / caminho).string();
+    }
+
+    /**
+     * @brief Executa aquecimento + repetições de um algoritmo e guarda o tempo de cada repetição.
+     * @param contadores Se não for nulo, também guarda os contadores do processador de cada repetição.
+     */
+    void medirAlgoritmo(const GrafoPesado& grafo, const std::string& algoritmo, const std::vector<int>& origens,
+        const ConfiguracaoBench& config, ContadoresHardware* contadores, ResultadoMedicao& resultado) {
+        Dijkstra dijkstra;
+        const bool usaHeap = (algoritmo == "heap");
+        volatile size_t sumidouro = 0; // Impede que o compilador descarte as execuções
+
+        auto rodar = [&](int execucao) {
+            if (algoritmo == "lote") {
+                // Um lote completo de origens por execução, com as threads pedidas
+                std::vector<int> loteOrigens(origens.begin() + execucao * ORIGENS_POR_LOTE,
+                    origens.begin() + (execucao + 1) * ORIGENS_POR_LOTE);
+                std::atomic<size_t> alcancados(0);
+                grafo.executarDijkstraLote(loteOrigens, [&](int, const ResultadoDijkstra& r) {
+                    alcancados += r.dist.size();
+                }, config.numThreads);
+                sumidouro = sumidouro + alcancados.load();
+                return;
+            }
+            const int origem = origens[execucao];
+            if (usaHeap) sumidouro = sumidouro + dijkstra.executarHeap(grafo, origem).dist.size();
+            else         sumidouro = sumidouro + dijkstra.executarVetor(grafo, origem).dist.size();
+        };
+
+        medirTempos(config, contadores, rodar, resultado);
+
+        // Uma execução extra (não cronometrada) por origem medida, com a política de contagem
+        if (config.operacoes && algoritmo != "lote") {
+            for (int k = 0; k < config.repeticoes; ++k) {
+                const int origem = origens[config.aquecimento + k];
+                somarOperacoes(resultado.somaOperacoes, usaHeap
+                    ? dijkstra.executarHeap<ComContagem>(grafo, origem).operacoes
+                    : dijkstra.executarVetor<ComContagem>(grafo, origem).operacoes);
+            }
+            resultado.execucoesContadas = config.repeticoes;
+        }
+    }
+
+    // Nome do algoritmo no CSV (mesmos nomes do Estudo de Caso 2 para heap e vetor)
+    const char* nomeAlgoritmoCSV(const std::string& algoritmo) {
+        if (algoritmo == "heap") return "Heap";
+        if (algoritmo == "vetor") return "Vetor";
+        return "HeapLote";
+    }
+
+    void escreverCSV(std::ostream& saida, const ConfiguracaoBench& config, const std::vector<ResultadoMedicao>& resultados) {
+        saida << "Grafo,Algoritmo,Vertices,Arestas,NumExecucoes,Aquecimento,Semente,Threads,TempoCarga_ms,";
+        escreverColunasMedicaoCSV(saida);
+        saida << "\n";
+        saida.precision(6);
+        saida << std::fixed;
+        for (const auto& r : resultados) {
+            saida << r.grafo << "," << nomeAlgoritmoCSV(r.algoritmo) << "," << r.vertices << "," << r.arestas << ","
+                << config.repeticoes << "," << config.aquecimento << "," << config.semente << "," << config.numThreads << ","
+                << r.tempoCargaMs << ",";
+            escreverMedicaoCSV(saida, r);
+            saida << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConfiguracaoBench config;
+    try {
+        config = lerArgumentos(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        imprimirUso(std::cerr);
+        return 2;
+    }
+
+    const bool usaLote = std::find(config.algoritmos.begin(), config.algoritmos.end(), "lote") != config.algoritmos.end();
+    const size_t execucoes = static_cast<size_t>(config.aquecimento) + config.repeticoes;
+    const size_t numOrigens = usaLote ? execucoes * ORIGENS_POR_LOTE : execucoes;
+    std::map<std::string, std::vector<double>> temposBase;
+    if (!config.base.empty()) {
+        try {
+            temposBase = lerTemposBase(config.base);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Erro: " << e.what() << "\n";
+            return 2;
+        }
+    }
+
+    std::unique_ptr<ContadoresHardware> contadores = abrirContadores(config);
+
+    std::vector<ResultadoMedicao> resultados;
+    bool houveFalha = false, houveRegressao = false;
+
+    for (const auto& nomeGrafo : config.grafos) {
+        std::cerr << "Processando " << nomeGrafo << "..." << std::endl;
+        try {
+            auto inicio = std::chrono::steady_clock::now();
+            GrafoPesado grafo(resolverCaminhoGrafo(nomeGrafo, caminhoAlternativo(nomeGrafo)));
+            auto fim = std::chrono::steady_clock::now();
+            const double tempoCargaMs = std::chrono::duration<double, std::milli>(fim - inicio).count();
+
+            if (grafo.obterNumeroVertices() <= 0) throw std::runtime_error("Grafo sem vertices.");
+            const std::vector<int> origens = sortearOrigens(grafo.obterNumeroVertices(), numOrigens, config.semente);
+
+            for (const auto& algoritmo : config.algoritmos) {
+                ResultadoMedicao resultado;
+                resultado.grafo = nomeGrafo;
+                resultado.algoritmo = algoritmo;
+                resultado.vertices = grafo.obterNumeroVertices();
+                resultado.arestas = grafo.obterNumeroArestas();
+                resultado.tempoCargaMs = tempoCargaMs;
+                try {
+                    medirAlgoritmo(grafo, algoritmo, origens, config, contadores.get(), resultado);
+                    std::cerr << "  - " << algoritmo << ": " << resultado.estatisticas.mediana << " ms/execucao (mediana)" << std::endl;
+                }
+                catch (const std::exception& e) {
+                    registrarFalha(resultado, e.what());
+                    houveFalha = true;
+                    std::cerr << "  > ERRO (" << algoritmo << "): " << e.what() << std::endl;
+                }
+                resultados.push_back(std::move(resultado));
+            }
+        }
+        catch (const std::exception& e) {
+            houveFalha = true;
+            std::cerr << "  > ERRO: " << e.what() << std::endl;
+            for (const auto& algoritmo : config.algoritmos) {
+                ResultadoMedicao resultado;
+                resultado.grafo = nomeGrafo;
+                resultado.algoritmo = algoritmo;
+                resultado.status = e.what();
+                resultados.push_back(std::move(resultado));
+            }
+        }
+    }
+
+    std::ofstream arquivo;
+    if (!config.saida.empty()) {
+        arquivo.open(config.saida);
+        if (!arquivo.is_open()) {
+            std::cerr << "Erro: nao foi possivel criar " << config.saida << "\n";
+            return 2;
+        }
+    }
+    // Comparação com a base (mesmo grafo, representação e algoritmo)
+    for (auto& r : resultados) {
+        if (compararResultadoComBase(r, temposBase, config.limiar)) houveRegressao = true;
+    }
+
+    std::ostream& saida = config.saida.empty() ? std::cout : arquivo;
+    if (config.formatoCSV) escreverCSV(saida, config, resultados);
+    else escreverJSONBench(saida, "TP2", config, resultados);
+
+    if (houveFalha) return 1;
+    return houveRegressao ? 3 : 0;
+}
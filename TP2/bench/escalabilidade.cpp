@@ -0,0 +1,276 @@
+/**
+ * @file escalabilidade.cpp
+ * @brief Estudo de escalabilidade do TP2: Dijkstra em lote e construção com 1, 2, 4, ... threads.
+ * @details Mede cada algoritmo paralelo com cada número de threads, no mesmo grafo
+ * (escala forte) ou em um grafo gerado que cresce junto com as threads (escala fraca),
+ * e grava speedup e eficiência paralela em CSV. As primeiras colunas são as do estudo de
+ * caso 2 (resultados_estudo2_dijkstra.csv), na mesma ordem e em milissegundos; as
+ * colunas próprias da escalabilidade vêm depois delas.
+ *
+ * Uso: escalabilidade --grafo <arquivo> | --gerar <especificacao> [...] [opções]
+ *   --gerar <espec>    grafo sintético (comum/Geradores.h), ex: rmat:m=1e6:pesos=uniforme;
+ *                      um intervalo "m=1e3..1e9" (ou v=...) varre as potências de 10 do intervalo
+ *   --algoritmo lote,construcao   (padrão: todos)
+ *   --threads 1,2,4,...  números de threads (padrão: potências de 2 até o número de
+ *                      processadores disponíveis, e o próprio número); 1 sempre é medido
+ *   --escala forte|fraca|forte,fraca   (padrão: forte)
+ *   --fixar sim|nao    restringe a medição com t threads a t processadores (padrão: sim)
+ *   --lote N           origens por execução do lote (padrão: 64, como no bench)
+ *   --repeticoes N     execuções medidas por amostra (padrão: 5)
+ *   --aquecimento N    execuções descartadas antes da medição (padrão: 1)
+ *   --semente S        semente das origens sorteadas (padrão: 42)
+ *   --saida <arquivo>  (padrão: resultados_tp2_escalabilidade.csv)
+ *
+ * Algoritmos: lote (Dijkstra com heap por GrafoPesado::executarDijkstraLote, um lote de
+ * origens por execução; "HeapLote" no CSV, como no bench) e construcao (geração paralela
+ * das arestas + CSR, que é montado por uma thread; ignorada nos grafos de arquivo). O TP2
+ * só tem grafos não direcionados e uma representação. As origens são sorteadas uma vez
+ * por grafo, então todos os números de threads medem as mesmas buscas.
+ *
+ * Escala forte, escala fraca e fixação como no estudo de escalabilidade do TP3: o speedup é
+ * RazaoTamanho x mediana(T1) / mediana(Tt), com RazaoTamanho = (Vt + Mt) / (V1 + M1) (1 na
+ * escala forte), e a eficiência é speedup / t. Com --fixar sim, a medição com t threads
+ * roda restrita aos t primeiros processadores (restringirAosProcessadores, em
+ * comum/Paralelo.h) e o grafo é carregado restrito aos do maior número de threads.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../biblioteca/interface/GrafoPesado.h"
+#include "../../comum/ExecutorBench.h"
+#include "../../comum/Paralelo.h"
+
+namespace {
+
+    const char* ALGORITMOS[] = { "lote", "construcao" };
+
+    struct ConfiguracaoEscalabilidade : OpcoesEscalabilidade {
+        std::vector<FonteGrafo> grafos;
+        std::vector<std::string> algoritmos{ std::begin(ALGORITMOS), std::end(ALGORITMOS) };
+        int lote = 64;
+
+        ConfiguracaoEscalabilidade() {
+            saida = "resultados_tp2_escalabilidade.csv";
+        }
+    };
+
+    void imprimirUso(std::ostream& saida) {
+        saida << "Uso: escalabilidade --grafo <arquivo> | --gerar <modelo[:chave=valor]...> [...]\n"
+            << "             [--algoritmo lote,construcao] [--threads 1,2,4,...] [--escala forte|fraca|forte,fraca]\n"
+            << "             [--fixar sim|nao] [--lote N] [--repeticoes N] [--aquecimento N] [--semente S] [--saida <arquivo.csv>]\n";
+    }
+
+    ConfiguracaoEscalabilidade lerArgumentos(int argc, char** argv) {
+        ConfiguracaoEscalabilidade config;
+        percorrerArgumentos(argc, argv, imprimirUso, [&](const std::string& opcao, const std::string& valor) {
+            if (opcao == "--grafo") {
+                FonteGrafo fonte;
+                fonte.nome = valor;
+                config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--gerar") {
+                for (auto& fonte : lerFontesGeradas(valor, true)) config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--algoritmo") config.algoritmos = separarLista(valor);
+            else if (opcao == "--lote") config.lote = static_cast<int>(lerInteiro(opcao, valor, 1));
+            else return lerOpcaoEscalabilidade(config, opcao, valor);
+            return true;
+        });
+
+        if (config.grafos.empty()) throw std::runtime_error("Informe ao menos um --grafo ou --gerar.");
+        for (const auto& chave : config.algoritmos) {
+            if (std::none_of(std::begin(ALGORITMOS), std::end(ALGORITMOS),
+                [&](const char* a) { return chave == a; })) {
+                throw std::runtime_error("Algoritmo desconhecido: " + chave);
+            }
+        }
+        completarOpcoesEscalabilidade(config);
+        for (const auto& fonte : config.grafos) {
+            if (fonte.gerado) verificarDirecaoGerador(fonte.parametros, false); // O TP2 não tem grafos direcionados
+        }
+        return config;
+    }
+
+    // bench/escalabilidade.cpp -> estudos/grafos_em_txt
+    std::string caminhoAlternativo(const std::string& caminho) {
+        namespace fs = std::filesystem;
+        return (fs::path(__FILE__).parent_path().parent_path() / "estudos" / "grafos_em_txt" / caminho).string();
+    }
+
+    std::unique_ptr<GrafoPesado> construirGrafo(const FonteGrafo& fonte, const ParametrosGerador& parametros, int numThreads) {
+        if (!fonte.gerado) {
+            return std::make_unique<GrafoPesado>(resolverCaminhoGrafo(fonte.nome, caminhoAlternativo(fonte.nome)));
+        }
+        GrafoGerado<ArestaComPeso> gerado = gerarArestas<ArestaComPeso>(parametros, numThreads);
+        return std::make_unique<GrafoPesado>(gerado.numeroVertices, std::move(gerado.arestas));
+    }
+
+    /**
+     * @brief Executa aquecimento + repetições de um algoritmo com 'numThreads' threads.
+     * @details Em construcao, cada execução gera as arestas e monta o CSR de novo.
+     */
+    void medirAlgoritmo(const GrafoPesado& grafo, const FonteGrafo& fonte, const ParametrosGerador& parametros,
+        const std::string& algoritmo, const std::vector<int>& origens, int numThreads,
+        const ConfiguracaoEscalabilidade& config, ResultadoEscalabilidade& resultado) {
+        const size_t lote = static_cast<size_t>(config.lote);
+        volatile size_t sumidouro = 0; // Impede que o compilador descarte as execuções
+
+        auto rodar = [&](int execucao) {
+            if (algoritmo == "lote") {
+                std::vector<int> loteOrigens(origens.begin() + execucao * lote, origens.begin() + (execucao + 1) * lote);
+                std::atomic<size_t> alcancados(0); // O callback é chamado por várias threads
+                grafo.executarDijkstraLote(loteOrigens, [&](int, const ResultadoDijkstra& r) {
+                    alcancados.fetch_add(r.dist.size(), std::memory_order_relaxed);
+                }, numThreads);
+                sumidouro = sumidouro + alcancados.load();
+            }
+            else {
+                sumidouro = sumidouro + construirGrafo(fonte, parametros, numThreads)->obterNumeroArestas();
+            }
+        };
+
+        resultado.temposMs = medirExecucoes(config.aquecimento, config.repeticoes, rodar);
+        resultado.estatisticas = calcularEstatisticasTempo(resultado.temposMs);
+    }
+
+    // Nome do algoritmo no CSV (o lote com o mesmo nome do bench)
+    const char* nomeAlgoritmoCSV(const std::string& algoritmo) {
+        return algoritmo == "lote" ? "HeapLote" : "Construcao";
+    }
+
+    // Colunas do estudo de caso 2 primeiro (mesma ordem, falhas com -1), depois as da escalabilidade
+    void escreverCSV(std::ostream& saida, const ConfiguracaoEscalabilidade& config, const std::vector<ResultadoEscalabilidade>& resultados) {
+        saida << "Grafo,Algoritmo,Vertices,Arestas,NumExecucoes,TempoTotal_ms,TempoMedio_ms,TempoMin_ms,TempoMax_ms,"
+            "DesvioPadrao_ms,Status,TempoMediana_ms,TempoP90_ms,TempoP99_ms,Outliers,"
+            "Aquecimento,Semente,Threads,TempoCarga_ms,IC95Inferior_ms,IC95Superior_ms,";
+        escreverColunasEscalabilidadeCSV(saida);
+        saida << "\n";
+        saida.precision(6);
+        saida << std::fixed;
+        for (const auto& r : resultados) {
+            const EstatisticasTempo& e = r.estatisticas;
+            saida << r.grafo << "," << nomeAlgoritmoCSV(r.algoritmo) << ","
+                << r.vertices << "," << r.arestas << "," << config.repeticoes << ",";
+            if (r.status == "OK") {
+                saida << e.total << "," << e.media << "," << e.minimo << "," << e.maximo << "," << e.desvioPadrao << ",OK,"
+                    << e.mediana << "," << e.p90 << "," << e.p99 << "," << e.outliers << ",";
+            }
+            else saida << "-1,-1,-1,-1,-1,FALHA,-1,-1,-1,-1,";
+            saida << config.aquecimento << "," << config.semente << "," << r.threads << "," << r.tempoCargaMs << ",";
+            if (r.status == "OK") saida << e.icInferior << "," << e.icSuperior;
+            else saida << "-1,-1";
+            saida << ",";
+            escreverEscalabilidadeCSV(saida, r, config.fixar);
+            saida << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConfiguracaoEscalabilidade config;
+    try {
+        config = lerArgumentos(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        imprimirUso(std::cerr);
+        return 2;
+    }
+
+    informarProcessadores(config.threads.back());
+
+    const size_t execucoes = static_cast<size_t>(config.aquecimento) + config.repeticoes;
+    std::vector<ResultadoEscalabilidade> resultados;
+    bool houveFalha = false;
+
+    for (const auto& fonte : config.grafos) {
+        for (const auto& escala : config.escalas) {
+            const bool fraca = (escala == "fraca");
+            if (fraca && !fonte.gerado) {
+                std::cerr << "Aviso: escala fraca so se aplica a grafos gerados; " << fonte.nome << " ignorado." << std::endl;
+                continue;
+            }
+            std::cerr << "Processando " << fonte.nome << " (escala " << escala << ")..." << std::endl;
+
+            std::unique_ptr<GrafoPesado> grafo;
+            std::vector<int> origens;
+            double tempoCargaMs = -1.0;
+            std::string erroCarga;
+            for (int numThreads : config.threads) {
+                const ParametrosGerador parametros = fraca ? escalarParametros(fonte.parametros, numThreads) : fonte.parametros;
+                // Na escala forte o grafo (e as origens) são os mesmos para todos os números de threads
+                if (fraca || (!grafo && erroCarga.empty())) {
+                    grafo.reset();
+                    if (config.fixar) restringirAosProcessadores(config.threads.back());
+                    try {
+                        auto inicio = std::chrono::steady_clock::now();
+                        grafo = construirGrafo(fonte, parametros, 0);
+                        auto fim = std::chrono::steady_clock::now();
+                        tempoCargaMs = std::chrono::duration<double, std::milli>(fim - inicio).count();
+                        if (grafo->obterNumeroVertices() <= 0) throw std::runtime_error("Grafo sem vertices.");
+                        origens = sortearOrigens(grafo->obterNumeroVertices(), execucoes * config.lote, config.semente);
+                    }
+                    catch (const std::exception& e) {
+                        grafo.reset();
+                        erroCarga = e.what();
+                        std::cerr << "  > ERRO: " << e.what() << std::endl;
+                    }
+                }
+
+                // As threads que os algoritmos criarem herdam a restrição da thread principal
+                if (config.fixar) restringirAosProcessadores(numThreads);
+                for (const auto& algoritmo : config.algoritmos) {
+                    if (algoritmo == "construcao" && !fonte.gerado) continue; // Só há o que construir em grafos gerados
+                    ResultadoEscalabilidade resultado;
+                    resultado.grafo = fonte.nome;
+                    resultado.algoritmo = algoritmo;
+                    resultado.escala = escala;
+                    resultado.threads = numThreads;
+                    if (!grafo) {
+                        resultado.status = erroCarga;
+                        houveFalha = true;
+                        resultados.push_back(std::move(resultado));
+                        continue;
+                    }
+                    resultado.vertices = grafo->obterNumeroVertices();
+                    resultado.arestas = grafo->obterNumeroArestas();
+                    resultado.tempoCargaMs = tempoCargaMs;
+                    try {
+                        medirAlgoritmo(*grafo, fonte, parametros, algoritmo, origens, numThreads, config, resultado);
+                        std::cerr << "  - " << algoritmo << " com " << numThreads << " thread(s): "
+                            << resultado.estatisticas.mediana << " ms/execucao (mediana)" << std::endl;
+                    }
+                    catch (const std::exception& e) {
+                        resultado.temposMs.clear();
+                        resultado.status = e.what();
+                        houveFalha = true;
+                        std::cerr << "  > ERRO (" << algoritmo << ", " << numThreads << " thread(s)): " << e.what() << std::endl;
+                    }
+                    resultados.push_back(std::move(resultado));
+                }
+            }
+        }
+    }
+
+    calcularSpeedup(resultados);
+
+    std::ofstream arquivo(config.saida);
+    if (!arquivo.is_open()) {
+        std::cerr << "Erro: nao foi possivel criar " << config.saida << "\n";
+        return 2;
+    }
+    escreverCSV(arquivo, config, resultados);
+    std::cerr << "Resultados gravados em " << config.saida << std::endl;
+
+    return houveFalha ? 1 : 0;
+}
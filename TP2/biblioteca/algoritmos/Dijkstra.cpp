@@ -1,22 +1,122 @@
 #include "Dijkstra.h"
 #include "../interface/GrafoPesado.h" // Inclui nossa classe GrafoPesado
 #include <vector>
+#include <limits>
+#include <algorithm> // Para std::push_heap/std::pop_heap
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 // Define um valor grande para representar infinito
 const double infinity = std::numeric_limits<double>::infinity();
 
+namespace {
+
+    // Doubles comparados por iteração da busca do mínimo (cobre um registrador AVX-512 ou dois AVX2)
+    const int LARGURA_BUSCA = 8;
+
+    // Chave dos vértices finalizados e ainda não alcançados em executarVetor. É finita porque,
+    // com -ffast-math (Release), o compilador pode eliminar comparações com infinito.
+    const double SEM_CHAVE = std::numeric_limits<double>::max();
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+    /**
+     * @brief Escolhe, entre os mínimos parciais de cada faixa, o menor valor (e o menor índice no empate).
+     */
+    int reduzirFaixas(const double* minimos, const double* indices, int faixas) {
+        int melhor = 0;
+        for (int f = 1; f < faixas; ++f) {
+            if (minimos[f] < minimos[melhor] || (minimos[f] == minimos[melhor] && indices[f] < indices[melhor])) {
+                melhor = f;
+            }
+        }
+        return static_cast<int>(indices[melhor]);
+    }
+#endif
+
+    /**
+     * @brief Posição do menor valor em p[0..tamanho), a primeira em caso de empate.
+     * @details 'tamanho' deve ser múltiplo de LARGURA_BUSCA. Cada faixa do registrador guarda
+     * o seu mínimo e o índice em que ele apareceu (a comparação estrita mantém o primeiro);
+     * no fim as faixas são reduzidas. Se tudo for SEM_CHAVE, retorna 0.
+     */
+    int posicaoDoMinimo(const double* p, int tamanho) {
+#if defined(__AVX512F__)
+        __m512d minimos = _mm512_set1_pd(SEM_CHAVE);
+        __m512d indices = _mm512_setzero_pd();
+        __m512d atual = _mm512_setr_pd(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m512d passo = _mm512_set1_pd(8.0);
+        for (int i = 0; i < tamanho; i += 8) {
+            const __m512d x = _mm512_loadu_pd(p + i);
+            const __mmask8 menor = _mm512_cmp_pd_mask(x, minimos, _CMP_LT_OQ);
+            minimos = _mm512_mask_mov_pd(minimos, menor, x);
+            indices = _mm512_mask_mov_pd(indices, menor, atual);
+            atual = _mm512_add_pd(atual, passo);
+        }
+        alignas(64) double m[8], idx[8];
+        _mm512_store_pd(m, minimos);
+        _mm512_store_pd(idx, indices);
+        return reduzirFaixas(m, idx, 8);
+#elif defined(__AVX2__)
+        // Dois acumuladores de 4 faixas: posições i..i+3 e i+4..i+7
+        __m256d minimosA = _mm256_set1_pd(SEM_CHAVE), minimosB = minimosA;
+        __m256d indicesA = _mm256_setzero_pd(), indicesB = indicesA;
+        __m256d atualA = _mm256_setr_pd(0, 1, 2, 3);
+        __m256d atualB = _mm256_setr_pd(4, 5, 6, 7);
+        const __m256d passo = _mm256_set1_pd(8.0);
+        for (int i = 0; i < tamanho; i += 8) {
+            const __m256d xA = _mm256_loadu_pd(p + i);
+            const __m256d xB = _mm256_loadu_pd(p + i + 4);
+            const __m256d menorA = _mm256_cmp_pd(xA, minimosA, _CMP_LT_OQ);
+            const __m256d menorB = _mm256_cmp_pd(xB, minimosB, _CMP_LT_OQ);
+            minimosA = _mm256_blendv_pd(minimosA, xA, menorA);
+            minimosB = _mm256_blendv_pd(minimosB, xB, menorB);
+            indicesA = _mm256_blendv_pd(indicesA, atualA, menorA);
+            indicesB = _mm256_blendv_pd(indicesB, atualB, menorB);
+            atualA = _mm256_add_pd(atualA, passo);
+            atualB = _mm256_add_pd(atualB, passo);
+        }
+        alignas(32) double m[8], idx[8];
+        _mm256_store_pd(m, minimosA);
+        _mm256_store_pd(m + 4, minimosB);
+        _mm256_store_pd(idx, indicesA);
+        _mm256_store_pd(idx + 4, indicesB);
+        return reduzirFaixas(m, idx, 8);
+#else
+        int melhor = 0;
+        for (int i = 1; i < tamanho; ++i) {
+            if (p[i] < p[melhor]) melhor = i;
+        }
+        return melhor;
+#endif
+    }
+
+} // namespace
+
 /**
  * Implementação de Dijkstra com HEAP.
  */
+template <class Contagem>
 ResultadoDijkstra Dijkstra::executarHeap(const GrafoPesado& grafo, int origem) {
+    EspacoTrabalhoDijkstra espaco;
+    executarHeap<Contagem>(grafo, origem, espaco);
+    return std::move(espaco.resultado);
+}
+
+/**
+ * Implementação de Dijkstra com HEAP sobre um espaço de trabalho reutilizável.
+ */
+template <class Contagem>
+void Dijkstra::executarHeap(const GrafoPesado& grafo, int origem, EspacoTrabalhoDijkstra& espaco) {
     // 1. Verificação de Pré-condição
     if (grafo.temPesoNegativo()) {
         throw std::runtime_error("Algoritmo de Dijkstra nao suporta grafos com pesos negativos.");
     }
 
-    // 2. Inicialização
+    // 2. Inicialização (assign reaproveita a capacidade já alocada)
     const int numVertices = grafo.obterNumeroVertices();
-    ResultadoDijkstra resultado;
+    ResultadoDijkstra& resultado = espaco.resultado;
     resultado.dist.assign(numVertices + 1, infinity);
     resultado.pai.assign(numVertices + 1, -1); // -1 indica sem predecessor
 
@@ -24,42 +124,55 @@ ResultadoDijkstra Dijkstra::executarHeap(const GrafoPesado& grafo, int origem) {
     resultado.pai[origem] = 0; // Marca a origem com pai 0
 
     // Fila de prioridade (min-heap simulado com max-heap e pesos negativos)
-    // Armazena pares { -distancia, vertice }
-    std::priority_queue<std::pair<double, int>> pq;
-    pq.push({ 0.0, origem });
+    // Armazena pares { -distancia, vertice } no vetor do espaço de trabalho
+    std::vector<std::pair<double, int>>& pq = espaco.heap;
+    pq.clear();
+    pq.push_back({ 0.0, origem });
+    Contagem contagem;
+    contagem.insercaoHeap();
 
     // 3. Loop Principal
     while (!pq.empty()) {
-        double d_neg = pq.top().first; // Distância negativa
-        int u = pq.top().second;
-        pq.pop();
+        std::pop_heap(pq.begin(), pq.end());
+        double d_neg = pq.back().first; // Distância negativa
+        int u = pq.back().second;
+        pq.pop_back();
 
         // Verifica se é uma entrada obsoleta na fila
         if (-d_neg > resultado.dist[u]) {
+            contagem.remocaoObsoleta();
             continue;
         }
+        contagem.verticeFinalizado();
 
-        // 4. Relaxamento dos Vizinhos
-        for (const auto& vizinho : grafo.obterVizinhosComPesos(u)) {
-            int v = vizinho.id;
-            double pesoUV = vizinho.peso;
+        // 4. Relaxamento dos Vizinhos (sem vetor temporário por vértice)
+        grafo.paraCadaVizinhoComPeso(u, [&](int v, double pesoUV) {
+            contagem.arestaExaminada();
 
             // Condição de relaxamento
             if (resultado.dist[u] + pesoUV < resultado.dist[v]) {
                 resultado.dist[v] = resultado.dist[u] + pesoUV;
                 resultado.pai[v] = u;
                 // Adiciona a nova distância (negativa) à fila (simulando decrease-key)
-                pq.push({ -resultado.dist[v], v });
+                pq.push_back({ -resultado.dist[v], v });
+                std::push_heap(pq.begin(), pq.end());
+                contagem.relaxamento();
+                contagem.insercaoHeap();
             }
-        }
+        });
     }
-    return resultado;
+    resultado.operacoes = contagem.obter();
 }
 
 
 /**
  * Implementação de Dijkstra com VETOR.
+ * As chaves dos vértices ficam em um vetor contíguo (SEM_CHAVE para finalizados e ainda não
+ * alcançados), dividido em blocos de ~sqrt(V) posições com o mínimo de cada bloco guardado
+ * à parte. Extrair o mínimo = varrer os mínimos dos blocos + varrer um bloco (O(sqrt(V)));
+ * relaxar = atualizar a chave e, se for o caso, o mínimo do bloco (O(1)).
  */
+template <class Contagem>
 ResultadoDijkstra Dijkstra::executarVetor(const GrafoPesado& grafo, int origem) {
     // 1. Verificação de Pré-condição
     if (grafo.temPesoNegativo()) {
@@ -71,42 +184,64 @@ ResultadoDijkstra Dijkstra::executarVetor(const GrafoPesado& grafo, int origem)
     ResultadoDijkstra resultado;
     resultado.dist.assign(numVertices + 1, infinity);
     resultado.pai.assign(numVertices + 1, -1);
-    std::vector<bool> finalizado(numVertices + 1, false); // Marca vértices cujo caminho mínimo já foi encontrado
 
     resultado.dist[origem] = 0.0;
     resultado.pai[origem] = 0;
 
-    // 3. Loop Principal (executa V vezes)
-    for (int count = 0; count < numVertices; ++count) {
-        // 3.a. Encontrar o vértice 'u' não finalizado com menor dist[u]
-        double minDist = infinity;
-        int u = -1;
-        for (int v_atual = 1; v_atual <= numVertices; ++v_atual) {
-            if (!finalizado[v_atual] && resultado.dist[v_atual] < minDist) {
-                minDist = resultado.dist[v_atual];
-                u = v_atual;
-            }
-        }
-
-        // Se não encontrou (grafo desconexo ou todos alcançáveis já finalizados)
-        if (u == -1) {
-            break;
+    // Blocos com potência de 2 posições (>= sqrt(V + 1)), para achar o bloco com um shift
+    int deslocamento = 3;
+    while ((1LL << (2 * deslocamento)) < numVertices + 1) ++deslocamento;
+    const int tamanhoBloco = 1 << deslocamento;
+    const int numBlocos = (numVertices + tamanhoBloco) / tamanhoBloco;
+    const int numBlocosPreenchido = (numBlocos + LARGURA_BUSCA - 1) / LARGURA_BUSCA * LARGURA_BUSCA;
+
+    std::vector<double> chaves(static_cast<size_t>(numBlocos) * tamanhoBloco, SEM_CHAVE);
+    std::vector<double> minimoDoBloco(numBlocosPreenchido, SEM_CHAVE);
+    chaves[origem] = 0.0;
+    minimoDoBloco[origem >> deslocamento] = 0.0;
+    Contagem contagem;
+
+    // 3. Loop Principal (uma extração por vértice alcançável)
+    while (true) {
+        // 3.a. Bloco com a menor chave e, dentro dele, o vértice 'u' (o de menor índice no empate)
+        const int b = posicaoDoMinimo(minimoDoBloco.data(), numBlocosPreenchido);
+        if (minimoDoBloco[b] == SEM_CHAVE) {
+            break; // Todos os alcançáveis já foram finalizados
         }
+        double* bloco = chaves.data() + static_cast<size_t>(b) * tamanhoBloco;
+        const int u = b * tamanhoBloco + posicaoDoMinimo(bloco, tamanhoBloco);
 
-        // Marca 'u' como finalizado
-        finalizado[u] = true;
+        // Marca 'u' como finalizado e recalcula o mínimo do seu bloco
+        chaves[u] = SEM_CHAVE;
+        minimoDoBloco[b] = bloco[posicaoDoMinimo(bloco, tamanhoBloco)];
+        contagem.verticeFinalizado();
 
         // 4. Relaxamento dos Vizinhos de 'u'
+        // Vizinhos já finalizados nunca melhoram (dist[v] <= dist[u] <= dist[u] + peso), então
+        // não precisam de marcação própria.
+        const double distU = resultado.dist[u];
         for (const auto& vizinho : grafo.obterVizinhosComPesos(u)) {
             int v = vizinho.id;
-            double pesoUV = vizinho.peso;
-
-            // Relaxa apenas se v não foi finalizado e o caminho é melhor
-            if (!finalizado[v] && resultado.dist[u] != infinity && resultado.dist[u] + pesoUV < resultado.dist[v]) {
-                resultado.dist[v] = resultado.dist[u] + pesoUV;
+            const double novaDist = distU + vizinho.peso;
+            contagem.arestaExaminada();
+            if (novaDist < resultado.dist[v]) {
+                contagem.relaxamento();
+                resultado.dist[v] = novaDist;
                 resultado.pai[v] = u;
+                chaves[v] = novaDist;
+                double& minimo = minimoDoBloco[v >> deslocamento];
+                if (novaDist < minimo) minimo = novaDist;
             }
         }
     }
+    resultado.operacoes = contagem.obter();
     return resultado;
-}
\ No newline at end of file
+}
+
+// Instâncias usadas pela biblioteca e pelos estudos (a implementação fica neste arquivo)
+template ResultadoDijkstra Dijkstra::executarHeap<SemContagem>(const GrafoPesado&, int);
+template ResultadoDijkstra Dijkstra::executarHeap<ComContagem>(const GrafoPesado&, int);
+template void Dijkstra::executarHeap<SemContagem>(const GrafoPesado&, int, EspacoTrabalhoDijkstra&);
+template void Dijkstra::executarHeap<ComContagem>(const GrafoPesado&, int, EspacoTrabalhoDijkstra&);
+template ResultadoDijkstra Dijkstra::executarVetor<SemContagem>(const GrafoPesado&, int);
+template ResultadoDijkstra Dijkstra::executarVetor<ComContagem>(const GrafoPesado&, int);
\ No newline at end of file
@@ -5,11 +5,13 @@
 
 #include "GrafoPesado.h"
 #include "../representacao/VetorAdjacenciaPesada.h" // Inclui a representao concreta
+#include "../../../comum/Paralelo.h"
 #include <fstream>   // Para leitura de arquivos (ifstream)
 #include <stdexcept> // Para lanar excees (runtime_error)
 #include <vector>
 #include <string>
 #include <limits>    // Para std::numeric_limits
+#include <algorithm> // Para std::min/std::max
 
  /**
   * @brief Construtor da classe GrafoPesado.
@@ -63,6 +65,22 @@ GrafoPesado::GrafoPesado(const std::string& caminhoArquivo)
     // O arquivo  fechado automaticamente quando 'arquivo' sai de escopo (RAII).
 }
 
+GrafoPesado::GrafoPesado(int numeroVertices, std::vector<ArestaComPeso> arestas)
+    : numeroDeVertices(numeroVertices), numeroDeArestas(static_cast<long long>(arestas.size())), possuiPesoNegativo(false) {
+
+    if (numeroDeVertices <= 0) {
+        throw std::runtime_error("Numero de vertices invalido: " + std::to_string(numeroVertices));
+    }
+    possuiPesoNegativo = std::any_of(arestas.begin(), arestas.end(),
+        [](const ArestaComPeso& aresta) { return aresta.peso < 0.0; });
+
+    // Mesma sequncia do construtor por arquivo, com o lote inteiro entregue de uma vez
+    auto representacaoCSR = std::make_unique<VetorAdjacenciaPesada>(this->numeroDeVertices);
+    representacaoCSR->adicionarArestasComPeso(std::move(arestas));
+    representacaoInterna = std::move(representacaoCSR);
+    representacaoInterna->finalizarConstrucao();
+}
+
 /**
  * @brief Destrutor da classe GrafoPesado.
  * @details A definio explcita aqui, mesmo que vazia,  necessria por causa
@@ -91,6 +109,11 @@ std::vector<VizinhoComPeso> GrafoPesado::obterVizinhosComPesos(int u) const {
     return representacaoInterna->obterVizinhosComPesos(u);
 }
 
+void GrafoPesado::paraCadaVizinhoComPeso(int u, const std::function<void(int v, double w)>& fn) const {
+    // Delega a chamada para o objeto de representao interno.
+    representacaoInterna->paraCadaVizinhoComPeso(u, fn);
+}
+
 double GrafoPesado::obterPesoAresta(int u, int v) const {
     // Delega a chamada para o objeto de representao interno.
     return representacaoInterna->obterPesoAresta(u, v);
@@ -109,4 +132,30 @@ ResultadoDijkstra GrafoPesado::executarDijkstraHeap(int origem) const {
 ResultadoDijkstra GrafoPesado::executarDijkstraVetor(int origem) const {
     Dijkstra dijkstraAlgo; // Cria instncia da classe especialista
     return dijkstraAlgo.executarVetor(*this, origem); // Delega a chamada
+}
+
+void GrafoPesado::executarDijkstraLote(const std::vector<int>& origens,
+    const std::function<void(int origem, const ResultadoDijkstra& resultado)>& callback,
+    int numThreads) const {
+    if (possuiPesoNegativo) {
+        throw std::runtime_error("Algoritmo de Dijkstra nao suporta grafos com pesos negativos.");
+    }
+    for (int origem : origens) {
+        if (origem <= 0 || origem > numeroDeVertices) {
+            throw std::runtime_error("Vertice de origem invalido no lote de Dijkstra: " + std::to_string(origem));
+        }
+    }
+    if (origens.empty()) return;
+
+    // Um espao de trabalho por thread: a memria no cresce com o tamanho do lote
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    numThreads = std::max(1, std::min(numThreads, static_cast<int>(origens.size())));
+    std::vector<EspacoTrabalhoDijkstra> espacos(numThreads);
+
+    executarEmParalelo(static_cast<int>(origens.size()), numThreads, [&](int indice, int idThread) {
+        Dijkstra dijkstraAlgo;
+        EspacoTrabalhoDijkstra& espaco = espacos[idThread];
+        dijkstraAlgo.executarHeap(*this, origens[indice], espaco);
+        callback(origens[indice], espaco.resultado);
+    });
 }
\ No newline at end of file
@@ -4,9 +4,11 @@
 #include <string>
 #include <memory> // Para std::unique_ptr
 #include <limits> // Para std::numeric_limits
+#include <functional> // Para std::function
 
 // Inclui a interface da representação pesada e a struct VizinhoComPeso
-#include "../representacao/RepresentacaoPesada.h" 
+#include "../representacao/representacaoPesada.h" 
+#include "../../../comum/ArestaComPeso.h"
 // Inclui a definição de Dijkstra e ResultadoDijkstra
 #include "../algoritmos/Dijkstra.h" 
 
@@ -31,6 +33,16 @@ public:
      */
     explicit GrafoPesado(const std::string& caminhoArquivo);
 
+    /**
+     * @brief Construtor que monta o grafo a partir de arestas já em memória (ex: comum/Geradores.h).
+     * @details As arestas vão direto para o buffer de construção do CSR, sem cópia e sem
+     * passar por arquivo texto; arestas inválidas e laços são descartados como na leitura.
+     * @param numeroVertices Número de vértices (arestas usam ids 1..numeroVertices).
+     * @param arestas Arestas (u, v, peso); o vetor é consumido.
+     * @throws std::runtime_error Se numeroVertices <= 0.
+     */
+    GrafoPesado(int numeroVertices, std::vector<ArestaComPeso> arestas);
+
     /**
      * @brief Destrutor padrão. Gerencia a memória da representação interna via unique_ptr.
      */
@@ -65,6 +77,13 @@ public:
      */
     std::vector<VizinhoComPeso> obterVizinhosComPesos(int u) const;
 
+    /**
+     * @brief Itera sobre os vizinhos de um vértice (com pesos) sem criar vetor temporário.
+     * @param u O vértice (indexado a partir de 1).
+     * @param fn Função chamada para cada vizinho 'v' com peso 'w'.
+     */
+    void paraCadaVizinhoComPeso(int u, const std::function<void(int v, double w)>& fn) const;
+
     /**
      * @brief Obtém o peso da aresta entre dois vértices, se existir.
      * @param u Primeiro vértice.
@@ -96,6 +115,22 @@ public:
      */
     ResultadoDijkstra executarDijkstraVetor(int origem) const;
 
+    /**
+     * @brief Executa o Dijkstra (Heap) para um lote de origens, em paralelo.
+     * @details As origens são distribuídas dinamicamente entre as threads; cada thread
+     * reaproveita o seu EspacoTrabalhoDijkstra, então a memória fica em O(threads x V)
+     * independentemente do tamanho do lote. Cada resultado é entregue ao callback e
+     * descartado logo em seguida (a referência só é válida durante a chamada).
+     * @param origens Vértices de origem (1-based).
+     * @param callback Chamado uma vez por origem com o resultado correspondente. Pode ser
+     * chamado simultaneamente por várias threads e sem ordem definida.
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * @throws std::runtime_error se o grafo contiver pesos negativos ou alguma origem for inválida.
+     */
+    void executarDijkstraLote(const std::vector<int>& origens,
+        const std::function<void(int origem, const ResultadoDijkstra& resultado)>& callback,
+        int numThreads = 0) const;
+
 
 
 private:
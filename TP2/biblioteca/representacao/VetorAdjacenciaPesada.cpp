@@ -33,6 +33,19 @@ void VetorAdjacenciaPesada::adicionarArestaComPeso(int u, int v, double w) {
     }
 }
 
+void VetorAdjacenciaPesada::adicionarArestasComPeso(std::vector<ArestaComPeso>&& arestas) {
+    const int n = numeroDeVertices;
+    arestas.erase(std::remove_if(arestas.begin(), arestas.end(), [n](const ArestaComPeso& a) {
+        return a.u <= 0 || a.u > n || a.v <= 0 || a.v > n || a.u == a.v;
+    }), arestas.end());
+    if (arestasTemporarias.empty()) {
+        arestasTemporarias = std::move(arestas);
+    }
+    else {
+        arestasTemporarias.insert(arestasTemporarias.end(), arestas.begin(), arestas.end());
+    }
+}
+
 /**
  * @brief Constrói a estrutura CSR final (offsets, vizinhos, pesos).
  */
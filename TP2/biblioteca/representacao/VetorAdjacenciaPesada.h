@@ -4,12 +4,7 @@
 #include "representacaoPesada.h" 
 #include <vector>
 #include <utility> // Para std::pair
-
-// Estrutura temporária para armazenar arestas durante a leitura (pode ser movida para um .h comum)
-struct ArestaComPeso {
-    int u, v;
-    double peso;
-};
+#include "../../../comum/ArestaComPeso.h" // Arestas guardadas durante a leitura
 
 /**
  * @class VetorAdjacenciaPesada
@@ -34,6 +29,14 @@ public:
 
     // Métodos específicos da RepresentacaoPesada
     void adicionarArestaComPeso(int u, int v, double w) override;
+
+    /**
+     * @brief Adiciona um lote de arestas de uma vez, assumindo o vetor.
+     * @details Mesma validação de adicionarArestaComPeso, feita no próprio vetor; se ainda
+     * não houver arestas, ele passa a ser o buffer de construção sem cópia. Usado na
+     * construção direta a partir dos geradores sintéticos.
+     */
+    void adicionarArestasComPeso(std::vector<ArestaComPeso>&& arestas);
     std::vector<VizinhoComPeso> obterVizinhosComPesos(int vertice) const override;
     double obterPesoAresta(int u, int v) const override;
     void paraCadaVizinhoComPeso(int u, const std::function<void(int v, double w)>& fn) const override;
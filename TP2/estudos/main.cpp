@@ -22,33 +22,27 @@
  // Includes da biblioteca TP2
 #include "../biblioteca/interface/GrafoPesado.h"
 #include "../biblioteca/algoritmos/Dijkstra.h"
+#include "../../comum/Benchmark.h"
 
 // --- Constantes e Estruturas ---
 const int NUM_EXECUCOES_BENCHMARK = 100;
+const int NUM_AQUECIMENTO_BENCHMARK = 5;              // Execues descartadas antes da medio
+const unsigned long long SEMENTE_ORIGENS = 42;        // Vetor e Heap medem as mesmas origens
 // Define o valor infinito para facilitar a leitura
 const double infinity = std::numeric_limits<double>::infinity();
 
-// Estrutura para o resultado do benchmark de tempo
-struct ResultadoBenchmarkTempo {
-    double tempoTotalMs = 0.0;
-    double tempoMedioMs = 0.0;
-    double tempoMinMs = std::numeric_limits<double>::infinity();
-    double tempoMaxMs = 0.0;
-    double desvioPadraoMs = 0.0;
-};
-
 // --- Prottipos das Funes ---
 void executarEstudoCaso1_Dijkstra();
 void executarEstudoCaso2_Dijkstra();
 void executarEstudoCaso3_Colaboracao(); // <-- NOVO
 void executarModoInterativo_Pesado();
-void menuDeAnalisePesado(GrafoPesado& grafo, const std::string& nomeGrafoBase, int indiceGrafo); // Adiciona indiceGrafo
+void menuDeAnalisePesado(GrafoPesado& grafo, const std::string& nomeGrafoBase);
 std::vector<int> reconstruirCaminho(const std::vector<int>& pai, int origem, int destino);
 std::string formatarCaminho(const std::vector<int>& caminho, const std::map<int, std::string>& idParaNome); // <-- Modificado
 std::string formatarCaminho(const std::vector<int>& caminho); // Sobrecarga para IDs
 void pausarParaContinuar();
 std::string caminhoEstudos(const std::string& nomeArquivo);
-ResultadoBenchmarkTempo executarAmostraDijkstra(const GrafoPesado& grafo, const std::string& tipoImpl, int numExecucoes, const std::vector<int>& verticesDePartida);
+EstatisticasTempo executarAmostraDijkstra(const GrafoPesado& grafo, const std::string& tipoImpl, int numExecucoes, const std::vector<int>& verticesDePartida);
 bool carregarMapeamentoNomes(const std::string& arquivoVertices,
     std::map<std::string, int>& nomeParaId,
     std::map<int, std::string>& idParaNome); // <-- NOVO
@@ -122,7 +116,7 @@ int main() {
 // --- Implementao dos Estudos de Caso ---
 
 /**
- * @brief Executa o Estudo de Caso 1, com restrio para Vetor nos grafos 4 e 5.
+ * @brief Executa o Estudo de Caso 1 (Heap e Vetor em todos os grafos).
  */
 void executarEstudoCaso1_Dijkstra() {
     std::cout << "\n--- Estudo de Caso 1: Calculo de Caminhos Minimos (Origem 10) ---" << std::endl;
@@ -147,7 +141,6 @@ void executarEstudoCaso1_Dijkstra() {
     for (const auto& pair : nomesBaseGrafos) {
         int indiceGrafo = pair.first;
         const std::string& nomeBase = pair.second;
-        bool executarVetor = (indiceGrafo <= 3); // <<< RESTRIO APLICADA AQUI
 
         std::cout << "\n--- Processando Grafo: " << nomeBase << " (" << indiceGrafo << ") ---" << std::endl;
         try {
@@ -178,25 +171,17 @@ void executarEstudoCaso1_Dijkstra() {
                 arquivoResultados << nomeBase << ",Heap," << dest << "," << distStr << "," << "\"" << caminhoStr << "\"\n";
             }
 
-            // --- Execuo com VETOR (condicional) ---
-            if (executarVetor) {
-                std::cout << "  Executando Dijkstra (Vetor) a partir de " << origem << "..." << std::flush;
-                ResultadoDijkstra resultadoVetor = dijkstraAlgo.executarVetor(grafo, origem);
-                std::cout << " OK." << std::endl;
-                for (int dest : destinos) {
-                    if (dest <= 0 || dest > grafo.obterNumeroVertices()) {
-                        arquivoResultados << nomeBase << ",Vetor," << dest << ",INEXISTENTE,N/A\n"; continue;
-                    }
-                    std::string distStr = (resultadoVetor.dist[dest] == infinity) ? "INFINITA" : std::to_string(resultadoVetor.dist[dest]);
-                    std::string caminhoStr = formatarCaminho(reconstruirCaminho(resultadoVetor.pai, origem, dest));
-                    arquivoResultados << nomeBase << ",Vetor," << dest << "," << distStr << "," << "\"" << caminhoStr << "\"\n";
-                }
-            }
-            else {
-                std::cout << "  Skipping Dijkstra (Vetor) para grafo grande (" << indiceGrafo << ")." << std::endl;
-                for (int dest : destinos) {
-                    arquivoResultados << nomeBase << ",Vetor," << dest << ",N/A (Skipped),N/A\n";
+            // --- Execuo com VETOR (sempre executa: busca do mnimo em blocos, O(V * sqrt(V))) ---
+            std::cout << "  Executando Dijkstra (Vetor) a partir de " << origem << "..." << std::flush;
+            ResultadoDijkstra resultadoVetor = dijkstraAlgo.executarVetor(grafo, origem);
+            std::cout << " OK." << std::endl;
+            for (int dest : destinos) {
+                if (dest <= 0 || dest > grafo.obterNumeroVertices()) {
+                    arquivoResultados << nomeBase << ",Vetor," << dest << ",INEXISTENTE,N/A\n"; continue;
                 }
+                std::string distStr = (resultadoVetor.dist[dest] == infinity) ? "INFINITA" : std::to_string(resultadoVetor.dist[dest]);
+                std::string caminhoStr = formatarCaminho(reconstruirCaminho(resultadoVetor.pai, origem, dest));
+                arquivoResultados << nomeBase << ",Vetor," << dest << "," << distStr << "," << "\"" << caminhoStr << "\"\n";
             }
 
         }
@@ -215,13 +200,13 @@ void executarEstudoCaso1_Dijkstra() {
 
 
 /**
- * @brief Executa o Estudo de Caso 2, com restrio para Vetor nos grafos 4 e 5.
+ * @brief Executa o Estudo de Caso 2 (Heap e Vetor em todos os grafos).
  */
 void executarEstudoCaso2_Dijkstra() {
     std::cout << "\n--- Estudo de Caso 2: Benchmark de Tempo Dijkstra (Vetor vs Heap) ---" << std::endl;
     std::ofstream arquivoResultados("resultados_estudo2_dijkstra.csv");
     if (!arquivoResultados.is_open()) { /* ... erro ... */ return; }
-    arquivoResultados << "Grafo,Algoritmo,Vertices,Arestas,NumExecucoes,TempoTotal_ms,TempoMedio_ms,TempoMin_ms,TempoMax_ms,DesvioPadrao_ms,Status\n";
+    arquivoResultados << "Grafo,Algoritmo,Vertices,Arestas,NumExecucoes,TempoTotal_ms,TempoMedio_ms,TempoMin_ms,TempoMax_ms,DesvioPadrao_ms,Status,TempoMediana_ms,TempoP90_ms,TempoP99_ms,Outliers\n";
     arquivoResultados << std::fixed << std::setprecision(6);
 
     std::map<int, std::string> nomesBaseGrafos; // Usar map
@@ -235,7 +220,6 @@ void executarEstudoCaso2_Dijkstra() {
     for (const auto& pair : nomesBaseGrafos) {
         int indiceGrafo = pair.first;
         const std::string& nomeBase = pair.second;
-        bool executarVetor = (indiceGrafo <= 3); // <<< RESTRIO APLICADA AQUI
 
         std::cout << "\nProcessando Grafo: " << nomeBase << " (" << indiceGrafo << ")..." << std::endl;
         try {
@@ -246,44 +230,32 @@ void executarEstudoCaso2_Dijkstra() {
 
             if (grafo.temPesoNegativo()) { /* ... registro erro negativo ... */ continue; }
 
-            // Gera K vrtices aleatrios
-            std::vector<int> verticesDePartida;
-            // ... (lgica para gerar vrtices aleatrios) ...
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_int_distribution<> distrib(1, numVertices);
-            verticesDePartida.reserve(NUM_EXECUCOES_BENCHMARK);
-            for (int k = 0; k < NUM_EXECUCOES_BENCHMARK; ++k) {
-                verticesDePartida.push_back(distrib(gen));
-            }
+            // Aquecimento + K vrtices sorteados com semente fixa (reprodutvel, iguais para Vetor e Heap)
+            std::vector<int> verticesDePartida = sortearOrigens(numVertices, NUM_AQUECIMENTO_BENCHMARK + NUM_EXECUCOES_BENCHMARK, SEMENTE_ORIGENS);
 
-            // --- Benchmark Vetor (Condicional) ---
-            if (executarVetor) {
-                std::cout << "  - Executando Amostra Dijkstra (Vetor)..." << std::flush;
-                ResultadoBenchmarkTempo resVetor = executarAmostraDijkstra(grafo, "Vetor", NUM_EXECUCOES_BENCHMARK, verticesDePartida);
-                std::cout << " OK (Media: " << resVetor.tempoMedioMs << " ms)" << std::endl;
-                arquivoResultados << nomeBase << ",Vetor," << numVertices << "," << numArestas << "," << NUM_EXECUCOES_BENCHMARK << ","
-                    << resVetor.tempoTotalMs << "," << resVetor.tempoMedioMs << "," << resVetor.tempoMinMs << ","
-                    << resVetor.tempoMaxMs << "," << resVetor.desvioPadraoMs << ",OK\n";
-            }
-            else {
-                std::cout << "  - Skipping Amostra Dijkstra (Vetor) para grafo grande (" << indiceGrafo << ")..." << std::endl;
-                arquivoResultados << nomeBase << ",Vetor," << numVertices << "," << numArestas << "," << NUM_EXECUCOES_BENCHMARK << ",-1,-1,-1,-1,-1,SKIPPED\n";
-            }
+            // --- Benchmark Vetor (Sempre executa) ---
+            std::cout << "  - Executando Amostra Dijkstra (Vetor)..." << std::flush;
+            EstatisticasTempo resVetor = executarAmostraDijkstra(grafo, "Vetor", NUM_EXECUCOES_BENCHMARK, verticesDePartida);
+            std::cout << " OK (Media: " << resVetor.media << " ms)" << std::endl;
+            arquivoResultados << nomeBase << ",Vetor," << numVertices << "," << numArestas << "," << NUM_EXECUCOES_BENCHMARK << ","
+                << resVetor.total << "," << resVetor.media << "," << resVetor.minimo << ","
+                << resVetor.maximo << "," << resVetor.desvioPadrao << ",OK,"
+                << resVetor.mediana << "," << resVetor.p90 << "," << resVetor.p99 << "," << resVetor.outliers << "\n";
 
             // --- Benchmark Heap (Sempre executa) ---
             std::cout << "  - Executando Amostra Dijkstra (Heap)..." << std::flush;
-            ResultadoBenchmarkTempo resHeap = executarAmostraDijkstra(grafo, "Heap", NUM_EXECUCOES_BENCHMARK, verticesDePartida);
-            std::cout << " OK (Media: " << resHeap.tempoMedioMs << " ms)" << std::endl;
+            EstatisticasTempo resHeap = executarAmostraDijkstra(grafo, "Heap", NUM_EXECUCOES_BENCHMARK, verticesDePartida);
+            std::cout << " OK (Media: " << resHeap.media << " ms)" << std::endl;
             arquivoResultados << nomeBase << ",Heap," << numVertices << "," << numArestas << "," << NUM_EXECUCOES_BENCHMARK << ","
-                << resHeap.tempoTotalMs << "," << resHeap.tempoMedioMs << "," << resHeap.tempoMinMs << ","
-                << resHeap.tempoMaxMs << "," << resHeap.desvioPadraoMs << ",OK\n";
+                << resHeap.total << "," << resHeap.media << "," << resHeap.minimo << ","
+                << resHeap.maximo << "," << resHeap.desvioPadrao << ",OK,"
+                << resHeap.mediana << "," << resHeap.p90 << "," << resHeap.p99 << "," << resHeap.outliers << "\n";
 
         }
         catch (const std::exception& e) {
             std::cerr << "  ERRO ao processar grafo " << nomeBase << ": " << e.what() << std::endl;
-            arquivoResultados << nomeBase << ",Vetor,-1,-1," << NUM_EXECUCOES_BENCHMARK << ",-1,-1,-1,-1,-1,ERRO\n";
-            arquivoResultados << nomeBase << ",Heap,-1,-1," << NUM_EXECUCOES_BENCHMARK << ",-1,-1,-1,-1,-1,ERRO\n";
+            arquivoResultados << nomeBase << ",Vetor,-1,-1," << NUM_EXECUCOES_BENCHMARK << ",-1,-1,-1,-1,-1,ERRO,-1,-1,-1,-1\n";
+            arquivoResultados << nomeBase << ",Heap,-1,-1," << NUM_EXECUCOES_BENCHMARK << ",-1,-1,-1,-1,-1,ERRO,-1,-1,-1,-1\n";
         }
     }
     arquivoResultados.close();
@@ -416,7 +388,7 @@ void executarEstudoCaso3_Colaboracao() {
 
 
 /**
- * @brief Orquestra o modo interativo, com restrio para Vetor nos grafos 4 e 5.
+ * @brief Orquestra o modo interativo.
  */
 void executarModoInterativo_Pesado() {
     while (true) {
@@ -448,8 +420,7 @@ void executarModoInterativo_Pesado() {
             auto grafo = std::make_unique<GrafoPesado>(caminho);
             std::cout << "Grafo carregado." << std::endl;
 
-            // Passa o ndice do grafo para o menu de anlise
-            menuDeAnalisePesado(*grafo, nomeGrafoBase, escolhaGrafo);
+            menuDeAnalisePesado(*grafo, nomeGrafoBase);
 
         }
         catch (const std::exception& e) {
@@ -460,11 +431,10 @@ void executarModoInterativo_Pesado() {
 
 
 /**
- * @brief Gerencia o menu de anlise, com restrio para Vetor nos grafos 4 e 5.
+ * @brief Gerencia o menu de anlise (Dijkstra com Heap ou Vetor).
  */
-void menuDeAnalisePesado(GrafoPesado& grafo, const std::string& nomeGrafoBase, int indiceGrafo) { // Recebe indiceGrafo
+void menuDeAnalisePesado(GrafoPesado& grafo, const std::string& nomeGrafoBase) {
     int escolha = -1;
-    bool podeExecutarVetor = (indiceGrafo <= 3); // <<< RESTRIO APLICADA AQUI
 
     while (escolha != 0) {
         std::cout << "\n--- Analisando o grafo '" << nomeGrafoBase << "' ---" << std::endl;
@@ -512,21 +482,15 @@ void menuDeAnalisePesado(GrafoPesado& grafo, const std::string& nomeGrafoBase, i
 
 
                 int impl = 1; // Padro  Heap
-                if (podeExecutarVetor) { // <<< RESTRIO APLICADA AQUI
-                    std::cout << "Qual implementacao? (1 = Heap, 2 = Vetor): ";
-                    std::cin >> impl;
-                    if (std::cin.fail() || (impl != 1 && impl != 2)) {
-                        std::cout << "Implementacao invalida." << std::endl;
-                        if (std::cin.fail()) { std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); }
-                        else { std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); }
-                        break;
-                    }
-                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                }
-                else {
-                    std::cout << "Usando implementacao Heap (Vetor nao disponivel para este grafo)." << std::endl;
-                    impl = 1; // Fora Heap para grafos 4 e 5
+                std::cout << "Qual implementacao? (1 = Heap, 2 = Vetor): ";
+                std::cin >> impl;
+                if (std::cin.fail() || (impl != 1 && impl != 2)) {
+                    std::cout << "Implementacao invalida." << std::endl;
+                    if (std::cin.fail()) { std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); }
+                    else { std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); }
+                    break;
                 }
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
                 Dijkstra dijkstraAlgo;
                 ResultadoDijkstra resultado;
@@ -730,41 +694,20 @@ std::string formatarCaminho(const std::vector<int>& caminho) {
 
 /**
  * @brief Executa uma "amostra" de benchmark Dijkstra, medindo cada execuo.
+ * @details As primeiras NUM_AQUECIMENTO_BENCHMARK origens de 'verticesDePartida' so
+ * usadas no aquecimento (no medidas); as 'numExecucoes' seguintes so medidas.
  */
-ResultadoBenchmarkTempo executarAmostraDijkstra(const GrafoPesado& grafo, const std::string& tipoImpl, int numExecucoes, const std::vector<int>& verticesDePartida) {
-    ResultadoBenchmarkTempo resultado;
-    if (numExecucoes <= 0 || verticesDePartida.size() != numExecucoes) return resultado; // Validao
+EstatisticasTempo executarAmostraDijkstra(const GrafoPesado& grafo, const std::string& tipoImpl, int numExecucoes, const std::vector<int>& verticesDePartida) {
+    if (numExecucoes <= 0 || static_cast<int>(verticesDePartida.size()) != NUM_AQUECIMENTO_BENCHMARK + numExecucoes) return {}; // Validao
 
     Dijkstra dijkstraAlgo;
-    std::vector<double> temposIndividuais;
-    temposIndividuais.reserve(numExecucoes);
-
     bool isHeap = (tipoImpl == "Heap");
 
-    for (int vertice : verticesDePartida) {
-        auto inicio = std::chrono::high_resolution_clock::now();
-        if (isHeap) dijkstraAlgo.executarHeap(grafo, vertice);
-        else        dijkstraAlgo.executarVetor(grafo, vertice);
-        auto fim = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double, std::milli> duracao = fim - inicio;
-        temposIndividuais.push_back(duracao.count());
-    }
-
-    if (!temposIndividuais.empty()) {
-        double somaDosTempos = std::accumulate(temposIndividuais.begin(), temposIndividuais.end(), 0.0);
-        resultado.tempoTotalMs = somaDosTempos;
-        resultado.tempoMedioMs = somaDosTempos / numExecucoes;
-        resultado.tempoMinMs = *std::min_element(temposIndividuais.begin(), temposIndividuais.end());
-        resultado.tempoMaxMs = *std::max_element(temposIndividuais.begin(), temposIndividuais.end());
-        double somaDosDesviosQuadrados = 0.0;
-        for (double tempo : temposIndividuais) {
-            somaDosDesviosQuadrados += (tempo - resultado.tempoMedioMs) * (tempo - resultado.tempoMedioMs);
-        }
-        // Usa N-1 para desvio padro amostral (mais comum em benchmarks)
-        double variancia = (numExecucoes > 1) ? (somaDosDesviosQuadrados / (numExecucoes - 1)) : 0.0;
-        resultado.desvioPadraoMs = std::sqrt(variancia);
-    }
-    return resultado;
+    std::vector<double> temposIndividuais = medirExecucoes(NUM_AQUECIMENTO_BENCHMARK, numExecucoes, [&](int k) {
+        if (isHeap) dijkstraAlgo.executarHeap(grafo, verticesDePartida[k]);
+        else        dijkstraAlgo.executarVetor(grafo, verticesDePartida[k]);
+    });
+    return calcularEstatisticasTempo(temposIndividuais);
 }
 
 /**
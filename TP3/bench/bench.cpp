@@ -0,0 +1,292 @@
+/**
+ * @file bench.cpp
+ * @brief Executor de benchmarks não interativo do TP3 (Dijkstra e variantes de Bellman-Ford).
+ * @details Roda os estudos de tempo sem menus nem pausas e grava os resultados em
+ * JSON ou CSV, para uso em scripts e na detecção de regressões.
+ *
+ * Uso: bench --grafo <arquivo> | --gerar <especificacao> [...] [opções]
+ *   --gerar <espec>    grafo sintético (comum/Geradores.h), ex: rmat:m=1e6:negativos=potenciais;
+ *                      um intervalo "m=1e3..1e9" (ou v=...) varre as potências de 10 do intervalo
+ *   --representacao intercalado,separado   layout do CSR (padrão: intercalado)
+ *   --algoritmo dijkstra-heap,dijkstra-vetor,bellman-ford,spfa,bellman-ford-paralelo
+ *                      (padrão: dijkstra-heap,bellman-ford)
+ *   --direcionado sim|nao  (padrão: sim, como no Estudo de Caso 2)
+ *   --repeticoes N     execuções medidas por amostra (padrão: 10)
+ *   --aquecimento N    execuções descartadas antes da medição (padrão: 1)
+ *   --semente S        semente das origens sorteadas (padrão: 42)
+ *   --threads T        threads do Bellman-Ford paralelo e dos geradores (padrão: 0 = número de núcleos)
+ *   --base <arquivo>   resultado JSON anterior para comparação (opcional)
+ *   --operacoes sim|nao   conta as operações dos algoritmos (dijkstra-heap, dijkstra-vetor e bellman-ford) (padrão: nao)
+ *   --contadores sim|nao  lê os contadores do processador em cada execução (padrão: nao)
+ *   --limiar F         variação relativa da mediana tolerada na comparação (padrão: 0.05)
+ *   --formato json|csv (padrão: json)
+ *   --saida <arquivo>  (padrão: saída padrão)
+ *
+ * Um arquivo de grafo que não existir no caminho informado é procurado em
+ * estudos/grafos_em_txt. Grafos gerados (com --threads threads) vão direto para o CSR,
+ * sem arquivo; o tempo de geração entra em TempoCarga_ms e o nome do grafo é a
+ * especificação canônica (com os tamanhos efetivos). As origens são sorteadas uma vez por grafo, então todos
+ * os layouts e algoritmos medem as mesmas origens. Dijkstra em grafo com peso
+ * negativo é registrado como falha (a exceção do algoritmo vira o status).
+ *
+ * As estatísticas vêm de comum/Benchmark.h (mediana, p90/p99, IC de 95%,
+ * outliers). Com --contadores sim, cada execução medida também registra ciclos,
+ * instruções, faltas de LLC e dTLB e desvios mal previstos (comum/ContadoresHardware.h);
+ * se o sistema não permitir, as colunas ficam vazias. Com --operacoes sim, cada origem
+ * medida é executada mais uma vez, sem cronometrar, com a política ComContagem
+ * (comum/ContagemOperacoes.h), e a saída traz a média por execução de vértices
+ * finalizados, arestas examinadas, relaxamentos, operações de heap e rodadas. Com --base, cada medição é comparada à de mesmo grafo, representação
+ * e algoritmo pelo teste de Mann-Whitney; o código de saída é 3 se houver
+ * regressão (e 1 se alguma medição falhar).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../biblioteca/interface/GrafoPesado.h"
+#include "../biblioteca/algoritmos/Dijkstra.h"
+#include "../biblioteca/algoritmos/BellmanFord.h"
+#include "../../comum/ExecutorBench.h"
+#include "../../comum/Geradores.h"
+
+namespace {
+
+    struct OpcaoRepresentacao {
+        const char* chave;
+        const char* nome;
+        LayoutCSR layout;
+    };
+
+    const OpcaoRepresentacao REPRESENTACOES[] = {
+        { "intercalado", "CSR Intercalado", LayoutCSR::Intercalado },
+        { "separado", "CSR Separado", LayoutCSR::Separado },
+    };
+
+    const char* ALGORITMOS[] = { "dijkstra-heap", "dijkstra-vetor", "bellman-ford", "spfa", "bellman-ford-paralelo" };
+
+    struct ConfiguracaoBench : OpcoesBench {
+        std::vector<FonteGrafo> grafos;
+        std::vector<std::string> representacoes{ "intercalado" };
+        std::vector<std::string> algoritmos{ "dijkstra-heap", "bellman-ford" };
+        bool direcionado = true;
+    };
+
+    void imprimirUso(std::ostream& saida) {
+        saida << "Uso: bench --grafo <arquivo> | --gerar <modelo[:chave=valor]...> [...]\n"
+            << "             [--representacao intercalado,separado]\n"
+            << "             [--algoritmo dijkstra-heap,dijkstra-vetor,bellman-ford,spfa,bellman-ford-paralelo]\n"
+            << "             [--direcionado sim|nao] [--repeticoes N] [--aquecimento N] [--semente S] [--threads T]\n"
+            << "             [--operacoes sim|nao] [--contadores sim|nao] [--base <arquivo.json>] [--limiar F] [--formato json|csv] [--saida <arquivo>]\n";
+    }
+
+    ConfiguracaoBench lerArgumentos(int argc, char** argv) {
+        ConfiguracaoBench config;
+        percorrerArgumentos(argc, argv, imprimirUso, [&](const std::string& opcao, const std::string& valor) {
+            if (opcao == "--grafo") {
+                FonteGrafo fonte;
+                fonte.nome = valor;
+                config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--gerar") {
+                for (auto& fonte : lerFontesGeradas(valor, true)) config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--representacao") config.representacoes = separarLista(valor);
+            else if (opcao == "--algoritmo") config.algoritmos = separarLista(valor);
+            else if (opcao == "--direcionado") config.direcionado = lerSimNao(opcao, valor);
+            else return lerOpcaoBench(config, opcao, valor);
+            return true;
+        });
+
+        if (config.grafos.empty()) throw std::runtime_error("Informe ao menos um --grafo ou --gerar.");
+        for (const auto& chave : config.representacoes) {
+            if (std::none_of(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; })) {
+                throw std::runtime_error("Representacao desconhecida: " + chave);
+            }
+        }
+        for (const auto& chave : config.algoritmos) {
+            if (std::none_of(std::begin(ALGORITMOS), std::end(ALGORITMOS),
+                [&](const char* a) { return chave == a; })) {
+                throw std::runtime_error("Algoritmo desconhecido: " + chave);
+            }
+        }
+        for (const auto& fonte : config.grafos) {
+            if (fonte.gerado) verificarDirecaoGerador(fonte.parametros, config.direcionado);
+        }
+        return config;
+    }
+
+    // bench/bench.cpp -> estudos/grafos_em_txt
+    std::string caminhoAlternativo(const std::string& caminho) {
+        namespace fs = std::filesystem;
+        return (fs::path(__FILE__).parent_path().parent_path() / "estudos" / "grafos_em_txt" / caminho).string();
+    }
+
+    /**
+     * @brief Executa aquecimento + repetições de um algoritmo e guarda o tempo de cada repetição.
+     * @param contadores Se não for nulo, também guarda os contadores do processador de cada repetição.
+     */
+    void medirAlgoritmo(const GrafoPesado& grafo, const std::string& algoritmo, const std::vector<int>& origens,
+        const ConfiguracaoBench& config, ContadoresHardware* contadores, ResultadoMedicao& resultado) {
+        Dijkstra dijkstra;
+        BellmanFord bf;
+        volatile size_t sumidouro = 0; // Impede que o compilador descarte as execuções
+
+        auto rodar = [&](int execucao) {
+            const int origem = origens[execucao];
+            if (algoritmo == "dijkstra-heap") sumidouro = sumidouro + dijkstra.executarHeap(grafo, origem).dist.size();
+            else if (algoritmo == "dijkstra-vetor") sumidouro = sumidouro + dijkstra.executarVetor(grafo, origem).dist.size();
+            else if (algoritmo == "spfa") sumidouro = sumidouro + bf.executarFila(grafo, origem).dist.size();
+            else if (algoritmo == "bellman-ford-paralelo") sumidouro = sumidouro + bf.executarParalelo(grafo, origem, config.numThreads).dist.size();
+            else sumidouro = sumidouro + bf.executar(grafo, origem).dist.size();
+        };
+
+        medirTempos(config, contadores, rodar, resultado);
+
+        // Uma execução extra (não cronometrada) por origem medida, com a política de contagem
+        if (config.operacoes && (algoritmo == "dijkstra-heap" || algoritmo == "dijkstra-vetor" || algoritmo == "bellman-ford")) {
+            for (int k = 0; k < config.repeticoes; ++k) {
+                const int origem = origens[config.aquecimento + k];
+                somarOperacoes(resultado.somaOperacoes, algoritmo == "dijkstra-heap" ? dijkstra.executarHeap<ComContagem>(grafo, origem).operacoes
+                    : algoritmo == "dijkstra-vetor" ? dijkstra.executarVetor<ComContagem>(grafo, origem).operacoes
+                    : bf.executar<ComContagem>(grafo, origem).operacoes);
+            }
+            resultado.execucoesContadas = config.repeticoes;
+        }
+    }
+
+    void escreverCSV(std::ostream& saida, const ConfiguracaoBench& config, const std::vector<ResultadoMedicao>& resultados) {
+        saida << "Grafo,Representacao,Algoritmo,Direcionado,Vertices,Arestas,NumExecucoes,Aquecimento,Semente,Threads,TempoCarga_ms,";
+        escreverColunasMedicaoCSV(saida);
+        saida << "\n";
+        saida.precision(6);
+        saida << std::fixed;
+        for (const auto& r : resultados) {
+            saida << r.grafo << "," << r.representacao << "," << r.algoritmo << "," << (config.direcionado ? "Sim" : "Nao") << ","
+                << r.vertices << "," << r.arestas << ","
+                << config.repeticoes << "," << config.aquecimento << "," << config.semente << "," << config.numThreads << ","
+                << r.tempoCargaMs << ",";
+            escreverMedicaoCSV(saida, r);
+            saida << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConfiguracaoBench config;
+    try {
+        config = lerArgumentos(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        imprimirUso(std::cerr);
+        return 2;
+    }
+
+    const size_t execucoes = static_cast<size_t>(config.aquecimento) + config.repeticoes;
+    std::map<std::string, std::vector<double>> temposBase;
+    if (!config.base.empty()) {
+        try {
+            temposBase = lerTemposBase(config.base);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Erro: " << e.what() << "\n";
+            return 2;
+        }
+    }
+
+    std::unique_ptr<ContadoresHardware> contadores = abrirContadores(config);
+
+    std::vector<ResultadoMedicao> resultados;
+    bool houveFalha = false, houveRegressao = false;
+
+    for (const auto& fonte : config.grafos) {
+        const std::string& nomeGrafo = fonte.nome;
+        std::vector<int> origens; // Sorteadas na primeira carga do grafo
+        for (const auto& chave : config.representacoes) {
+            const auto& repr = *std::find_if(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; });
+            std::cerr << "Processando " << nomeGrafo << " com " << repr.nome << "..." << std::endl;
+
+            try {
+                auto inicio = std::chrono::steady_clock::now();
+                std::unique_ptr<GrafoPesado> carregado;
+                if (fonte.gerado) {
+                    GrafoGerado<ArestaComPeso> gerado = gerarArestas<ArestaComPeso>(fonte.parametros, config.numThreads);
+                    carregado = std::make_unique<GrafoPesado>(gerado.numeroVertices, std::move(gerado.arestas),
+                        config.direcionado, false, repr.layout);
+                }
+                else {
+                    carregado = std::make_unique<GrafoPesado>(resolverCaminhoGrafo(nomeGrafo, caminhoAlternativo(nomeGrafo)), config.direcionado, false, repr.layout);
+                }
+                const GrafoPesado& grafo = *carregado;
+                auto fim = std::chrono::steady_clock::now();
+                const double tempoCargaMs = std::chrono::duration<double, std::milli>(fim - inicio).count();
+
+                if (grafo.obterNumeroVertices() <= 0) throw std::runtime_error("Grafo sem vertices.");
+                if (origens.empty()) origens = sortearOrigens(grafo.obterNumeroVertices(), execucoes, config.semente);
+
+                for (const auto& algoritmo : config.algoritmos) {
+                    ResultadoMedicao resultado;
+                    resultado.grafo = nomeGrafo;
+                    resultado.representacao = repr.nome;
+                    resultado.algoritmo = algoritmo;
+                    resultado.vertices = grafo.obterNumeroVertices();
+                    resultado.arestas = grafo.obterNumeroArestas();
+                    resultado.tempoCargaMs = tempoCargaMs;
+                    try {
+                        medirAlgoritmo(grafo, algoritmo, origens, config, contadores.get(), resultado);
+                        std::cerr << "  - " << algoritmo << ": " << resultado.estatisticas.mediana << " ms/execucao (mediana)" << std::endl;
+                    }
+                    catch (const std::exception& e) {
+                        registrarFalha(resultado, e.what());
+                        houveFalha = true;
+                        std::cerr << "  > ERRO (" << algoritmo << "): " << e.what() << std::endl;
+                    }
+                    resultados.push_back(std::move(resultado));
+                }
+            }
+            catch (const std::exception& e) {
+                houveFalha = true;
+                std::cerr << "  > ERRO: " << e.what() << std::endl;
+                for (const auto& algoritmo : config.algoritmos) {
+                    ResultadoMedicao resultado;
+                    resultado.grafo = nomeGrafo;
+                    resultado.representacao = repr.nome;
+                    resultado.algoritmo = algoritmo;
+                    resultado.status = e.what();
+                    resultados.push_back(std::move(resultado));
+                }
+            }
+        }
+    }
+
+    std::ofstream arquivo;
+    if (!config.saida.empty()) {
+        arquivo.open(config.saida);
+        if (!arquivo.is_open()) {
+            std::cerr << "Erro: nao foi possivel criar " << config.saida << "\n";
+            return 2;
+        }
+    }
+    // Comparação com a base (mesmo grafo, representação e algoritmo)
+    for (auto& r : resultados) {
+        if (compararResultadoComBase(r, temposBase, config.limiar)) houveRegressao = true;
+    }
+
+    std::ostream& saida = config.saida.empty() ? std::cout : arquivo;
+    if (config.formatoCSV) escreverCSV(saida, config, resultados);
+    else escreverJSONBench(saida, "TP3", config, resultados, std::string("\"direcionado\": ") + (config.direcionado ? "true" : "false"));
+
+    if (houveFalha) return 1;
+    return houveRegressao ? 3 : 0;
+}
@@ -0,0 +1,320 @@
+/**
+ * @file escalabilidade.cpp
+ * @brief Estudo de escalabilidade do TP3: algoritmos paralelos com 1, 2, 4, ... threads.
+ * @details Mede cada algoritmo paralelo com cada número de threads, no mesmo grafo
+ * (escala forte) ou em um grafo gerado que cresce junto com as threads (escala fraca),
+ * e grava speedup e eficiência paralela em CSV. As primeiras colunas são as do estudo de
+ * caso 2 (resultados_tp3_estudo2_tempo.csv), na mesma ordem e também em segundos; as
+ * colunas próprias da escalabilidade vêm depois delas.
+ *
+ * Uso: escalabilidade --grafo <arquivo> | --gerar <especificacao> [...] [opções]
+ *   --gerar <espec>    grafo sintético (comum/Geradores.h), ex: rmat:m=1e6:negativos=potenciais;
+ *                      um intervalo "m=1e3..1e9" (ou v=...) varre as potências de 10 do intervalo
+ *   --representacao intercalado,separado   layout do CSR (padrão: intercalado)
+ *   --algoritmo bellman-ford-paralelo,dijkstra-lote,construcao   (padrão: todos)
+ *   --threads 1,2,4,...  números de threads (padrão: potências de 2 até o número de
+ *                      processadores disponíveis, e o próprio número); 1 sempre é medido
+ *   --escala forte|fraca|forte,fraca   (padrão: forte)
+ *   --fixar sim|nao    restringe a medição com t threads a t processadores (padrão: sim)
+ *   --direcionado sim|nao  (padrão: sim, como no Estudo de Caso 2)
+ *   --lote N           origens por execução do dijkstra-lote (padrão: 64)
+ *   --repeticoes N     execuções medidas por amostra (padrão: 5)
+ *   --aquecimento N    execuções descartadas antes da medição (padrão: 1)
+ *   --semente S        semente das origens sorteadas (padrão: 42)
+ *   --saida <arquivo>  (padrão: resultados_tp3_escalabilidade.csv)
+ *
+ * Algoritmos: bellman-ford-paralelo (uma origem por execução), dijkstra-lote
+ * (GrafoPesado::executarDijkstraLote, um lote de origens por execução) e construcao
+ * (geração das arestas + CSR; ignorada nos grafos de arquivo). As origens são sorteadas uma vez
+ * por grafo, então todos os números de threads medem as mesmas buscas.
+ *
+ * Escala forte: o grafo é carregado uma vez (com todas as threads) e o speedup é
+ * mediana(T1) / mediana(Tt), com eficiência speedup / t. Escala fraca (só grafos
+ * gerados): com t threads, o gerador recebe t vezes os vértices e as arestas do grafo
+ * informado, mas arredonda o tamanho (o R-MAT para potência de 2, as grades para L x L),
+ * então o crescimento real é medido: RazaoTamanho = (Vt + Mt) / (V1 + M1), com V e M os
+ * vértices e as arestas efetivos. O speedup (escalado) é RazaoTamanho x mediana(T1) /
+ * mediana(Tt) e a eficiência é speedup / t; na escala forte RazaoTamanho vale 1. O nome
+ * do grafo é sempre o do grafo com 1 thread; Vertices e Arestas trazem o tamanho efetivo.
+ *
+ * Com --fixar sim, a medição com t threads roda restrita aos t primeiros processadores
+ * da lista de processadores disponíveis ordenada por nó NUMA (restringirAosProcessadores,
+ * em comum/Paralelo.h): as threads criadas pelos algoritmos herdam a restrição da
+ * thread principal. O grafo é carregado restrito aos processadores do maior número de
+ * threads, então a sua memória fica nos nós que as medições usam. As colunas
+ * Processadores e NosNUMA listam os processadores e os nós usados (separados por ';');
+ * sem fixação, ficam vazias. Mais threads do que processadores dão sobreposição.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../biblioteca/interface/GrafoPesado.h"
+#include "../biblioteca/algoritmos/BellmanFord.h"
+#include "../../comum/ExecutorBench.h"
+#include "../../comum/Paralelo.h"
+
+namespace {
+
+    struct OpcaoRepresentacao {
+        const char* chave;
+        const char* nome;
+        LayoutCSR layout;
+    };
+
+    const OpcaoRepresentacao REPRESENTACOES[] = {
+        { "intercalado", "CSR Intercalado", LayoutCSR::Intercalado },
+        { "separado", "CSR Separado", LayoutCSR::Separado },
+    };
+
+    const char* ALGORITMOS[] = { "bellman-ford-paralelo", "dijkstra-lote", "construcao" };
+
+    struct ConfiguracaoEscalabilidade : OpcoesEscalabilidade {
+        std::vector<FonteGrafo> grafos;
+        std::vector<std::string> representacoes{ "intercalado" };
+        std::vector<std::string> algoritmos{ std::begin(ALGORITMOS), std::end(ALGORITMOS) };
+        bool direcionado = true;
+        int lote = 64;
+
+        ConfiguracaoEscalabilidade() {
+            saida = "resultados_tp3_escalabilidade.csv";
+        }
+    };
+
+    void imprimirUso(std::ostream& saida) {
+        saida << "Uso: escalabilidade --grafo <arquivo> | --gerar <modelo[:chave=valor]...> [...]\n"
+            << "             [--representacao intercalado,separado] [--algoritmo bellman-ford-paralelo,dijkstra-lote,construcao]\n"
+            << "             [--threads 1,2,4,...] [--escala forte|fraca|forte,fraca] [--fixar sim|nao] [--direcionado sim|nao]\n"
+            << "             [--lote N] [--repeticoes N] [--aquecimento N] [--semente S] [--saida <arquivo.csv>]\n";
+    }
+
+    ConfiguracaoEscalabilidade lerArgumentos(int argc, char** argv) {
+        ConfiguracaoEscalabilidade config;
+        percorrerArgumentos(argc, argv, imprimirUso, [&](const std::string& opcao, const std::string& valor) {
+            if (opcao == "--grafo") {
+                FonteGrafo fonte;
+                fonte.nome = valor;
+                config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--gerar") {
+                for (auto& fonte : lerFontesGeradas(valor, true)) config.grafos.push_back(std::move(fonte));
+            }
+            else if (opcao == "--representacao") config.representacoes = separarLista(valor);
+            else if (opcao == "--algoritmo") config.algoritmos = separarLista(valor);
+            else if (opcao == "--direcionado") config.direcionado = lerSimNao(opcao, valor);
+            else if (opcao == "--lote") config.lote = static_cast<int>(lerInteiro(opcao, valor, 1));
+            else return lerOpcaoEscalabilidade(config, opcao, valor);
+            return true;
+        });
+
+        if (config.grafos.empty()) throw std::runtime_error("Informe ao menos um --grafo ou --gerar.");
+        for (const auto& chave : config.representacoes) {
+            if (std::none_of(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; })) {
+                throw std::runtime_error("Representacao desconhecida: " + chave);
+            }
+        }
+        for (const auto& chave : config.algoritmos) {
+            if (std::none_of(std::begin(ALGORITMOS), std::end(ALGORITMOS),
+                [&](const char* a) { return chave == a; })) {
+                throw std::runtime_error("Algoritmo desconhecido: " + chave);
+            }
+        }
+        completarOpcoesEscalabilidade(config);
+        for (const auto& fonte : config.grafos) {
+            if (fonte.gerado) verificarDirecaoGerador(fonte.parametros, config.direcionado);
+        }
+        return config;
+    }
+
+    // bench/escalabilidade.cpp -> estudos/grafos_em_txt
+    std::string caminhoAlternativo(const std::string& caminho) {
+        namespace fs = std::filesystem;
+        return (fs::path(__FILE__).parent_path().parent_path() / "estudos" / "grafos_em_txt" / caminho).string();
+    }
+
+    std::unique_ptr<GrafoPesado> construirGrafo(const FonteGrafo& fonte, const ParametrosGerador& parametros,
+        const ConfiguracaoEscalabilidade& config, LayoutCSR layout, int numThreads) {
+        if (!fonte.gerado) {
+            return std::make_unique<GrafoPesado>(resolverCaminhoGrafo(fonte.nome, caminhoAlternativo(fonte.nome)), config.direcionado, false, layout);
+        }
+        GrafoGerado<ArestaComPeso> gerado = gerarArestas<ArestaComPeso>(parametros, numThreads);
+        return std::make_unique<GrafoPesado>(gerado.numeroVertices, std::move(gerado.arestas), config.direcionado, false, layout);
+    }
+
+    /**
+     * @brief Executa aquecimento + repetições de um algoritmo com 'numThreads' threads.
+     * @details Em construcao, cada execução gera as arestas e monta o CSR de novo.
+     */
+    void medirAlgoritmo(const GrafoPesado& grafo, const FonteGrafo& fonte, const ParametrosGerador& parametros,
+        LayoutCSR layout, const std::string& algoritmo, const std::vector<int>& origens, int numThreads,
+        const ConfiguracaoEscalabilidade& config, ResultadoEscalabilidade& resultado) {
+        BellmanFord bf;
+        const size_t lote = static_cast<size_t>(config.lote);
+        volatile size_t sumidouro = 0; // Impede que o compilador descarte as execuções
+
+        auto rodar = [&](int execucao) {
+            if (algoritmo == "bellman-ford-paralelo") {
+                sumidouro = sumidouro + bf.executarParalelo(grafo, origens[execucao], numThreads).dist.size();
+            }
+            else if (algoritmo == "dijkstra-lote") {
+                std::vector<int> loteOrigens(origens.begin() + execucao * lote, origens.begin() + (execucao + 1) * lote);
+                std::atomic<size_t> alcancados(0); // O callback é chamado por várias threads
+                grafo.executarDijkstraLote(loteOrigens, [&](int, const ResultadoDijkstra& r) {
+                    alcancados.fetch_add(r.dist.size(), std::memory_order_relaxed);
+                }, numThreads);
+                sumidouro = sumidouro + alcancados.load();
+            }
+            else {
+                sumidouro = sumidouro + construirGrafo(fonte, parametros, config, layout, numThreads)->obterNumeroArestas();
+            }
+        };
+
+        resultado.temposMs = medirExecucoes(config.aquecimento, config.repeticoes, rodar);
+        resultado.estatisticas = calcularEstatisticasTempo(resultado.temposMs);
+    }
+
+    // Colunas do estudo de caso 2 primeiro (mesma ordem, em segundos), depois as da escalabilidade
+    void escreverCSV(std::ostream& saida, const ConfiguracaoEscalabilidade& config, const std::vector<ResultadoEscalabilidade>& resultados) {
+        saida << "Grafo,Algoritmo,Direcionado,NumRodadas,TempoTotal_s,TempoMedio_s,TempoMin_s,TempoMax_s,DesvioPadrao_s,"
+            "TempoMediana_s,TempoP90_s,TempoP99_s,Outliers,"
+            "Representacao,Vertices,Arestas,Aquecimento,Semente,Threads,TempoCarga_s,IC95Inferior_s,IC95Superior_s,";
+        escreverColunasEscalabilidadeCSV(saida);
+        saida << ",Status\n";
+        saida.precision(6);
+        saida << std::fixed;
+        for (const auto& r : resultados) {
+            const EstatisticasTempo& e = r.estatisticas;
+            const bool ok = (r.status == "OK");
+            saida << r.grafo << "," << r.algoritmo << "," << (config.direcionado ? "Sim" : "Nao") << "," << config.repeticoes << ",";
+            if (ok) {
+                saida << e.total / 1000.0 << "," << e.media / 1000.0 << "," << e.minimo / 1000.0 << "," << e.maximo / 1000.0 << ","
+                    << e.desvioPadrao / 1000.0 << "," << e.mediana / 1000.0 << "," << e.p90 / 1000.0 << "," << e.p99 / 1000.0 << ","
+                    << e.outliers;
+            }
+            else saida << ",,,,,,,,";
+            saida << "," << r.representacao << "," << r.vertices << "," << r.arestas << ","
+                << config.aquecimento << "," << config.semente << "," << r.threads << ",";
+            if (r.tempoCargaMs >= 0.0) saida << r.tempoCargaMs / 1000.0;
+            saida << ",";
+            if (ok) saida << e.icInferior / 1000.0 << "," << e.icSuperior / 1000.0;
+            else saida << ",";
+            saida << ",";
+            escreverEscalabilidadeCSV(saida, r, config.fixar);
+            saida << "," << (ok ? "OK" : "FALHA") << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConfiguracaoEscalabilidade config;
+    try {
+        config = lerArgumentos(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        imprimirUso(std::cerr);
+        return 2;
+    }
+
+    informarProcessadores(config.threads.back());
+
+    const size_t execucoes = static_cast<size_t>(config.aquecimento) + config.repeticoes;
+    std::vector<ResultadoEscalabilidade> resultados;
+    bool houveFalha = false;
+
+    for (const auto& fonte : config.grafos) {
+        for (const auto& chave : config.representacoes) {
+            const auto& repr = *std::find_if(std::begin(REPRESENTACOES), std::end(REPRESENTACOES),
+                [&](const OpcaoRepresentacao& r) { return chave == r.chave; });
+            for (const auto& escala : config.escalas) {
+                const bool fraca = (escala == "fraca");
+                if (fraca && !fonte.gerado) {
+                    std::cerr << "Aviso: escala fraca so se aplica a grafos gerados; " << fonte.nome << " ignorado." << std::endl;
+                    continue;
+                }
+                std::cerr << "Processando " << fonte.nome << " com " << repr.nome << " (escala " << escala << ")..." << std::endl;
+
+                std::unique_ptr<GrafoPesado> grafo;
+                std::vector<int> origens;
+                double tempoCargaMs = -1.0;
+                std::string erroCarga;
+                for (int numThreads : config.threads) {
+                    const ParametrosGerador parametros = fraca ? escalarParametros(fonte.parametros, numThreads) : fonte.parametros;
+                    // Na escala forte o grafo (e as origens) são os mesmos para todos os números de threads
+                    if (fraca || (!grafo && erroCarga.empty())) {
+                        grafo.reset();
+                        if (config.fixar) restringirAosProcessadores(config.threads.back());
+                        try {
+                            auto inicio = std::chrono::steady_clock::now();
+                            grafo = construirGrafo(fonte, parametros, config, repr.layout, 0);
+                            auto fim = std::chrono::steady_clock::now();
+                            tempoCargaMs = std::chrono::duration<double, std::milli>(fim - inicio).count();
+                            if (grafo->obterNumeroVertices() <= 0) throw std::runtime_error("Grafo sem vertices.");
+                            origens = sortearOrigens(grafo->obterNumeroVertices(), execucoes * config.lote, config.semente);
+                        }
+                        catch (const std::exception& e) {
+                            grafo.reset();
+                            erroCarga = e.what();
+                            std::cerr << "  > ERRO: " << e.what() << std::endl;
+                        }
+                    }
+
+                    // As threads que os algoritmos criarem herdam a restrição da thread principal
+                    if (config.fixar) restringirAosProcessadores(numThreads);
+                    for (const auto& algoritmo : config.algoritmos) {
+                        if (algoritmo == "construcao" && !fonte.gerado) continue; // Só há o que construir em grafos gerados
+                        ResultadoEscalabilidade resultado;
+                        resultado.grafo = fonte.nome;
+                        resultado.representacao = repr.nome;
+                        resultado.algoritmo = algoritmo;
+                        resultado.escala = escala;
+                        resultado.threads = numThreads;
+                        if (!grafo) {
+                            resultado.status = erroCarga;
+                            houveFalha = true;
+                            resultados.push_back(std::move(resultado));
+                            continue;
+                        }
+                        resultado.vertices = grafo->obterNumeroVertices();
+                        resultado.arestas = grafo->obterNumeroArestas();
+                        resultado.tempoCargaMs = tempoCargaMs;
+                        try {
+                            medirAlgoritmo(*grafo, fonte, parametros, repr.layout, algoritmo, origens, numThreads, config, resultado);
+                            std::cerr << "  - " << algoritmo << " com " << numThreads << " thread(s): "
+                                << resultado.estatisticas.mediana << " ms/execucao (mediana)" << std::endl;
+                        }
+                        catch (const std::exception& e) {
+                            resultado.temposMs.clear();
+                            resultado.status = e.what();
+                            houveFalha = true;
+                            std::cerr << "  > ERRO (" << algoritmo << ", " << numThreads << " thread(s)): " << e.what() << std::endl;
+                        }
+                        resultados.push_back(std::move(resultado));
+                    }
+                }
+            }
+        }
+    }
+
+    calcularSpeedup(resultados);
+
+    std::ofstream arquivo(config.saida);
+    if (!arquivo.is_open()) {
+        std::cerr << "Erro: nao foi possivel criar " << config.saida << "\n";
+        return 2;
+    }
+    escreverCSV(arquivo, config, resultados);
+    std::cerr << "Resultados gravados em " << config.saida << std::endl;
+
+    return houveFalha ? 1 : 0;
+}
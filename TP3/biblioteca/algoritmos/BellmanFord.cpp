@@ -5,12 +5,220 @@
 
 #include "BellmanFord.h"
 #include "../interface/GrafoPesado.h"
+#include "../../../comum/Paralelo.h"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <limits>
 #include <stdexcept>
+#include <thread>
 
  // Define um valor grande para representar o infinito.
 static const double INFINITO_BF = std::numeric_limits<double>::infinity();
 
+namespace {
+
+    // Testa os bits do expoente: com -ffast-math (Release) comparações com infinito
+    // podem ser eliminadas pelo compilador.
+    bool finito(double d) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return ((bits >> 52) & 0x7FF) != 0x7FF;
+    }
+
+    /**
+     * @brief Núcleo da variante com fila (SPFA + SLF/LLL + desmontagem de subárvores).
+     * @details Os vértices de 'raizes' começam na árvore com profundidade 0 (pai 0), o
+     * que permite tanto uma origem única quanto uma "super-origem" virtual ligada a
+     * todos os vértices com peso 0. Cada ciclo negativo detectado é entregue em
+     * 'ciclos' na ordem das arestas. Se 'todosOsCiclos' for falso, para no primeiro;
+     * caso contrário, os vértices do ciclo são bloqueados (saem do grafo) e a busca
+     * continua até que o restante não tenha mais ciclos negativos.
+     * @tparam VisaoCSR VisaoCSRIntercalada ou VisaoCSRSeparada (ver GrafoPesado::visitarCSR).
+     */
+    template <class VisaoCSR>
+    void executarSPFA(const VisaoCSR& csr, int numVertices, std::vector<double>& dist, std::vector<int>& pai,
+        const std::vector<int>& raizes, bool todosOsCiclos, std::vector<std::vector<int>>& ciclos) {
+
+        // Árvore de caminhos em pré-ordem: lista duplamente ligada + profundidade.
+        // A subárvore de v é o trecho contíguo após v com profundidade maior que a de v.
+        // O índice 0 funciona como sentinela (início/fim da lista, profundidade -1).
+        std::vector<int> proximo(numVertices + 1, 0), anterior(numVertices + 1, 0);
+        std::vector<int> profundidade(numVertices + 1, 0);
+        std::vector<char> naArvore(numVertices + 1, 0), naFila(numVertices + 1, 0), bloqueado(numVertices + 1, 0);
+        profundidade[0] = -1;
+
+        std::deque<int> fila;
+        double somaFila = 0.0; // Soma das distâncias na fila (usada pelo LLL)
+
+        // Só com todosOsCiclos: vértices desmontados desde o último ciclo. São os únicos que
+        // podem estar fora da árvore quando um ciclo é bloqueado, então religá-los não exige
+        // varrer todos os vértices (o custo fica proporcional às desmontagens já feitas).
+        std::vector<int> desmontados;
+        std::vector<char> pendente(todosOsCiclos ? numVertices + 1 : 0, 0); // Já está em 'desmontados'
+        auto marcarDesmontado = [&](int x) {
+            if (!pendente[x]) {
+                pendente[x] = 1;
+                desmontados.push_back(x);
+            }
+        };
+
+        // Pendura v (profundidade 0) logo após a sentinela e o coloca na fila
+        auto inserirRaiz = [&](int v) {
+            naArvore[v] = 1;
+            profundidade[v] = 0;
+            pai[v] = 0;
+            proximo[v] = proximo[0];
+            anterior[v] = 0;
+            anterior[proximo[0]] = v;
+            proximo[0] = v;
+            if (!naFila[v]) {
+                naFila[v] = 1;
+                somaFila += dist[v];
+                fila.push_back(v);
+            }
+        };
+        for (int r : raizes) inserirRaiz(r);
+
+        while (!fila.empty()) {
+            // LLL: move para o fim vértices acima da média (limitado a uma volta na fila)
+            double media = somaFila / static_cast<double>(fila.size());
+            for (size_t giros = fila.size(); giros > 1 && dist[fila.front()] > media; --giros) {
+                fila.push_back(fila.front());
+                fila.pop_front();
+            }
+            int u = fila.front();
+            fila.pop_front();
+            naFila[u] = 0;
+            somaFila -= dist[u];
+            if (fila.empty()) somaFila = 0.0; // Evita acúmulo de erro de arredondamento
+
+            // Vértice desmontado: sua distância será melhorada de novo antes de valer a pena processá-lo
+            if (!naArvore[u] || bloqueado[u]) continue;
+
+            const double distU = dist[u];
+            bool pararVarredura = false;
+            csr.paraCadaVizinho(u, [&](int v, double pesoUV) {
+                if (pararVarredura || bloqueado[v]) return;
+                double novaDist = distU + pesoUV;
+                // Um vértice desmontado também é religado com distância igual: em ponto
+                // flutuante a melhora do ancestral pode sumir no arredondamento
+                // (dist[u] + w == dist[v]), e sem isso ele nunca voltaria a ser processado.
+                bool religar = !naArvore[v] && novaDist == dist[v];
+                if (!(novaDist < dist[v]) && !religar) return;
+
+                // Desmonta a subárvore de v (se v já estava na árvore). Se u estiver nela,
+                // a aresta (u, v) fecha um ciclo no grafo de pais, que é negativo.
+                bool fechaCiclo = (v == u);
+                int x = v;
+                if (naArvore[v] && !fechaCiclo) {
+                    x = proximo[v];
+                    while (profundidade[x] > profundidade[v]) {
+                        if (x == u) {
+                            fechaCiclo = true;
+                            break;
+                        }
+                        naArvore[x] = 0;
+                        if (todosOsCiclos) marcarDesmontado(x);
+                        x = proximo[x];
+                    }
+                }
+
+                if (fechaCiclo) {
+                    // O ciclo é o caminho da árvore v -> ... -> u mais a aresta (u, v)
+                    std::vector<int> ciclo;
+                    for (int y = u; y != v; y = pai[y]) ciclo.push_back(y);
+                    ciclo.push_back(v);
+                    std::reverse(ciclo.begin(), ciclo.end());
+                    ciclos.push_back(ciclo);
+                    pararVarredura = true;
+                    if (!todosOsCiclos) return;
+
+                    // Bloqueia os vértices do ciclo, desmonta toda a subárvore de v e
+                    // religa à super-origem os vértices que ficaram sem pai válido (em ordem
+                    // crescente, como uma varredura de 1 a V faria).
+                    for (int y : ciclo) bloqueado[y] = 1;
+                    for (x = v; x != 0 && (x == v || profundidade[x] > profundidade[v]); x = proximo[x]) {
+                        naArvore[x] = 0;
+                        marcarDesmontado(x);
+                    }
+                    proximo[anterior[v]] = x;
+                    anterior[x] = anterior[v];
+                    auto religarNaRaiz = [&](int y) {
+                        pendente[y] = 0;
+                        if (!naArvore[y] && !bloqueado[y] && dist[y] != INFINITO_BF) inserirRaiz(y);
+                    };
+                    // Ordenar custa O(k log k); se isso passar de O(V), percorre as marcas
+                    if (desmontados.size() * 32 < static_cast<size_t>(numVertices)) {
+                        std::sort(desmontados.begin(), desmontados.end());
+                        for (int y : desmontados) religarNaRaiz(y);
+                    }
+                    else {
+                        for (int y = 1; y <= numVertices; ++y) {
+                            if (pendente[y]) religarNaRaiz(y);
+                        }
+                    }
+                    desmontados.clear();
+                    return;
+                }
+
+                if (naArvore[v]) {
+                    proximo[anterior[v]] = x;
+                    anterior[x] = anterior[v];
+                }
+
+                // Atualiza a distância e pendura v logo após u na pré-ordem
+                if (naFila[v]) somaFila += novaDist - dist[v];
+                dist[v] = novaDist;
+                pai[v] = u;
+                profundidade[v] = profundidade[u] + 1;
+                naArvore[v] = 1;
+                proximo[v] = proximo[u];
+                anterior[v] = u;
+                anterior[proximo[u]] = v;
+                proximo[u] = v;
+
+                // SLF: distância pequena vai para o início da fila
+                if (!naFila[v]) {
+                    naFila[v] = 1;
+                    somaFila += novaDist;
+                    if (!fila.empty() && novaDist < dist[fila.front()]) fila.push_front(v);
+                    else fila.push_back(v);
+                }
+            });
+
+            if (!todosOsCiclos && !ciclos.empty()) return;
+        }
+    }
+
+    /**
+     * @brief Recupera um ciclo a partir de um vértice relaxado na V-ésima passagem.
+     * @details Recuar V vezes pela cadeia de pais garante cair dentro do ciclo; a
+     * partir daí basta seguir os pais até voltar ao mesmo vértice.
+     * @return Vértices do ciclo na ordem das arestas (vazio se a cadeia chegar à origem).
+     */
+    std::vector<int> extrairCicloDosPais(const std::vector<int>& pai, int vertice, int numVertices) {
+        int x = vertice;
+        for (int i = 0; i < numVertices; ++i) {
+            x = pai[x];
+            if (x <= 0) return {};
+        }
+        std::vector<int> ciclo;
+        int y = x;
+        do {
+            ciclo.push_back(y);
+            y = pai[y];
+        } while (y != x && y > 0 && static_cast<int>(ciclo.size()) <= numVertices);
+        std::reverse(ciclo.begin(), ciclo.end());
+        return ciclo;
+    }
+
+} // namespace
+
+template <class Contagem>
 ResultadoBellmanFord BellmanFord::executar(const GrafoPesado& grafo, int origem) const {
     ResultadoBellmanFord resultado;
 
@@ -32,65 +240,295 @@ ResultadoBellmanFord BellmanFord::executar(const GrafoPesado& grafo, int origem)
     // Configuração da origem
     resultado.dist[origem] = 0.0;
     resultado.pai[origem] = 0; // 0 => marca a raiz da árvore de caminhos
+    Contagem contagem;
 
     // 2. Relaxamento das arestas (V - 1) vezes
     //
     // O algoritmo relaxa todas as arestas do grafo V-1 vezes.
     // Graças à abstração do GrafoPesado/VetorAdjacenciaPesada, iterar pelos vizinhos
     // cobre corretamente todas as arestas, seja o grafo direcionado ou não.
-    for (int i = 1; i <= numVertices - 1; ++i) {
-        bool houveAtualizacao = false;
+    // O laço é instanciado para o layout do CSR (sem vetor temporário por vértice).
+    grafo.visitarCSR([&](const auto& csr) {
+        for (int i = 1; i <= numVertices - 1; ++i) {
+            bool houveAtualizacao = false;
+            contagem.rodada();
 
-        // Itera sobre todos os vértices u
-        for (int u = 1; u <= numVertices; ++u) {
-            double distU = resultado.dist[u];
+            // Itera sobre todos os vértices u
+            for (int u = 1; u <= numVertices; ++u) {
+                double distU = resultado.dist[u];
+
+                // Se u é inalcançável, não podemos relaxar seus vizinhos
+                if (distU == INFINITO_BF) {
+                    continue;
+                }
+                contagem.verticeFinalizado();
 
-            // Se u é inalcançável, não podemos relaxar seus vizinhos
+                // Itera sobre todos os vizinhos v de u
+                csr.paraCadaVizinho(u, [&](int v, double pesoUV) {
+                    contagem.arestaExaminada();
+                    // Passo de relaxamento
+                    if (distU + pesoUV < resultado.dist[v]) {
+                        resultado.dist[v] = distU + pesoUV;
+                        resultado.pai[v] = u;
+                        houveAtualizacao = true;
+                        contagem.relaxamento();
+                    }
+                });
+            }
+
+            // Otimização: Se nenhuma distância mudou nesta passagem, 
+            // o caminho mínimo já foi encontrado.
+            if (!houveAtualizacao) {
+                break;
+            }
+        }
+
+        // 3. Detecção de ciclos de peso negativo
+        //
+        // Uma passagem adicional para verificar se ainda é possível relaxar alguma aresta.
+        // Se sim, existe um ciclo negativo alcançável a partir da origem.
+        contagem.rodada();
+        for (int u = 1; u <= numVertices && !resultado.temCicloNegativo; ++u) {
+            double distU = resultado.dist[u];
             if (distU == INFINITO_BF) {
                 continue;
             }
+            contagem.verticeFinalizado();
 
-            // Itera sobre todos os vizinhos v de u
-            for (const auto& viz : grafo.obterVizinhosComPesos(u)) {
-                int v = viz.id;
-                double pesoUV = viz.peso;
-
-                // Passo de relaxamento
-                if (distU + pesoUV < resultado.dist[v]) {
-                    resultado.dist[v] = distU + pesoUV;
+            csr.paraCadaVizinho(u, [&](int v, double pesoUV) {
+                contagem.arestaExaminada();
+                if (!resultado.temCicloNegativo && distU + pesoUV < resultado.dist[v]) {
+                    resultado.temCicloNegativo = true;
+                    // A aresta (u, v) faz parte da cadeia de pais que leva ao ciclo
                     resultado.pai[v] = u;
-                    houveAtualizacao = true;
+                    resultado.cicloNegativo = extrairCicloDosPais(resultado.pai, v, numVertices);
                 }
-            }
-        }   
-
-        // Otimização: Se nenhuma distância mudou nesta passagem, 
-        // o caminho mínimo já foi encontrado.
-        if (!houveAtualizacao) {
-            break;
+            });
         }
+    });
+
+    resultado.operacoes = contagem.obter();
+    return resultado;
+}
+
+// Instâncias usadas pela biblioteca e pelos estudos (a implementação fica neste arquivo)
+template ResultadoBellmanFord BellmanFord::executar<SemContagem>(const GrafoPesado&, int) const;
+template ResultadoBellmanFord BellmanFord::executar<ComContagem>(const GrafoPesado&, int) const;
+
+ResultadoBellmanFord BellmanFord::executarFila(const GrafoPesado& grafo, int origem) const {
+    ResultadoBellmanFord resultado;
+
+    const int numVertices = grafo.obterNumeroVertices();
+    if (numVertices <= 0) {
+        throw std::runtime_error("GrafoPesado com numero de vertices invalido em Bellman-Ford.");
+    }
+    if (origem <= 0 || origem > numVertices) {
+        throw std::runtime_error("Vertice de origem invalido em Bellman-Ford.");
     }
 
-    // 3. Detecção de ciclos de peso negativo
-    //
-    // Uma passagem adicional para verificar se ainda é possível relaxar alguma aresta.
-    // Se sim, existe um ciclo negativo alcançável a partir da origem.
-    for (int u = 1; u <= numVertices; ++u) {
-        double distU = resultado.dist[u];
-        if (distU == INFINITO_BF) {
-            continue;
+    // Inicialização (mesma convenção de executar)
+    resultado.dist.assign(numVertices + 1, INFINITO_BF);
+    resultado.pai.assign(numVertices + 1, -1);
+    resultado.dist[origem] = 0.0;
+    resultado.pai[origem] = 0;
+
+    std::vector<std::vector<int>> ciclos;
+    grafo.visitarCSR([&](const auto& csr) {
+        executarSPFA(csr, numVertices, resultado.dist, resultado.pai, { origem }, false, ciclos);
+    });
+    resultado.temCicloNegativo = !ciclos.empty();
+    if (resultado.temCicloNegativo) resultado.cicloNegativo = std::move(ciclos.front());
+    return resultado;
+}
+
+std::vector<std::vector<int>> BellmanFord::encontrarCiclosNegativos(const GrafoPesado& grafo) const {
+    const int numVertices = grafo.obterNumeroVertices();
+    if (numVertices <= 0) {
+        throw std::runtime_error("GrafoPesado com numero de vertices invalido em Bellman-Ford.");
+    }
+
+    // Super-origem virtual: aresta de peso 0 para todo vértice, ou seja, todos começam
+    // com distância 0, pai 0 (a própria super-origem) e na fila.
+    std::vector<double> dist(numVertices + 1, 0.0);
+    std::vector<int> pai(numVertices + 1, 0);
+    std::vector<int> raizes(numVertices);
+    for (int v = 1; v <= numVertices; ++v) raizes[v - 1] = v;
+
+    std::vector<std::vector<int>> ciclos;
+    grafo.visitarCSR([&](const auto& csr) {
+        executarSPFA(csr, numVertices, dist, pai, raizes, true, ciclos);
+    });
+    return ciclos;
+}
+
+ResultadoBellmanFord BellmanFord::executarSuperOrigem(const GrafoPesado& grafo) const {
+    ResultadoBellmanFord resultado;
+
+    const int numVertices = grafo.obterNumeroVertices();
+    if (numVertices <= 0) {
+        throw std::runtime_error("GrafoPesado com numero de vertices invalido em Bellman-Ford.");
+    }
+
+    resultado.dist.assign(numVertices + 1, 0.0);
+    resultado.pai.assign(numVertices + 1, 0);
+    std::vector<int> raizes(numVertices);
+    for (int v = 1; v <= numVertices; ++v) raizes[v - 1] = v;
+
+    std::vector<std::vector<int>> ciclos;
+    grafo.visitarCSR([&](const auto& csr) {
+        executarSPFA(csr, numVertices, resultado.dist, resultado.pai, raizes, false, ciclos);
+    });
+    resultado.temCicloNegativo = !ciclos.empty();
+    if (resultado.temCicloNegativo) resultado.cicloNegativo = std::move(ciclos.front());
+    return resultado;
+}
+
+namespace {
+
+    // Aresta do vetor plano usado pela versão paralela (12 bytes, leitura sequencial)
+    struct ArestaPlana {
+        int u;
+        int v;
+        float peso; // Mesma precisão do CSR
+    };
+
+    // Menor quantidade de arestas por thread que compensa a sincronização por rodada
+    const size_t ARESTAS_MINIMAS_POR_THREAD = 4096;
+
+} // namespace
+
+ResultadoBellmanFord BellmanFord::executarParalelo(const GrafoPesado& grafo, int origem, int numThreads) const {
+    ResultadoBellmanFord resultado;
+
+    const int numVertices = grafo.obterNumeroVertices();
+    if (numVertices <= 0) {
+        throw std::runtime_error("GrafoPesado com numero de vertices invalido em Bellman-Ford.");
+    }
+    if (origem <= 0 || origem > numVertices) {
+        throw std::runtime_error("Vertice de origem invalido em Bellman-Ford.");
+    }
+
+    resultado.dist.assign(numVertices + 1, INFINITO_BF);
+    resultado.pai.assign(numVertices + 1, -1);
+    resultado.temCicloNegativo = false;
+    resultado.dist[origem] = 0.0;
+    resultado.pai[origem] = 0;
+
+    // 1. Vetor plano de arestas (na ordem do CSR)
+    std::vector<ArestaPlana> arestas;
+    arestas.reserve(static_cast<size_t>(grafo.obterNumeroArestas()) * (grafo.consultaDirecionado() ? 1 : 2));
+    grafo.visitarCSR([&](const auto& csr) {
+        for (int u = 1; u <= numVertices; ++u) {
+            csr.paraCadaVizinho(u, [&](int v, double peso) {
+                arestas.push_back({ u, v, static_cast<float>(peso) });
+            });
         }
+    });
 
-        for (const auto& viz : grafo.obterVizinhosComPesos(u)) {
-            int v = viz.id;
-            double pesoUV = viz.peso;
+    // 2. Partição em blocos contíguos, um por thread
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    const size_t maxThreads = std::max<size_t>(1, arestas.size() / ARESTAS_MINIMAS_POR_THREAD);
+    numThreads = static_cast<int>(std::min<size_t>(static_cast<size_t>(numThreads), maxThreads));
 
-            if (distU + pesoUV < resultado.dist[v]) {
-                resultado.temCicloNegativo = true;
-                return resultado; // Retorna imediatamente ao detectar o ciclo
+    std::vector<double>& dist = resultado.dist;
+    std::atomic<bool> houveMudanca(false);
+    bool parar = false;
+    int rodada = 0;
+
+    // Executada por uma única thread quando todas chegam à barreira
+    auto fimDaRodada = [&]() noexcept {
+        ++rodada;
+        if (!houveMudanca.load(std::memory_order_relaxed)) {
+            parar = true; // Convergiu
+        }
+        else if (rodada >= numVertices) {
+            resultado.temCicloNegativo = true; // A rodada V ainda relaxou alguma aresta
+            parar = true;
+        }
+        houveMudanca.store(false, std::memory_order_relaxed);
+    };
+    std::barrier sincronizacao(numThreads, fimDaRodada);
+
+    auto trabalhador = [&](int idThread) {
+        const size_t inicio = arestas.size() * idThread / numThreads;
+        const size_t fim = arestas.size() * (idThread + 1) / numThreads;
+        while (true) {
+            bool mudouLocal = false;
+            for (size_t i = inicio; i < fim; ++i) {
+                const ArestaPlana& a = arestas[i];
+                double distU = std::atomic_ref<double>(dist[a.u]).load(std::memory_order_relaxed);
+                if (distU == INFINITO_BF) continue;
+
+                // Mínimo atômico: tenta gravar enquanto a nova distância for menor
+                double novaDist = distU + a.peso;
+                std::atomic_ref<double> distV(dist[a.v]);
+                double atual = distV.load(std::memory_order_relaxed);
+                while (novaDist < atual) {
+                    if (distV.compare_exchange_weak(atual, novaDist, std::memory_order_relaxed)) {
+                        mudouLocal = true;
+                        break;
+                    }
+                }
             }
+            if (mudouLocal) houveMudanca.store(true, std::memory_order_relaxed);
+            sincronizacao.arrive_and_wait(); // Também publica as escritas da rodada
+            if (parar) break;
         }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; ++t) {
+        threads.emplace_back(trabalhador, t);
     }
+    trabalhador(0);
+    for (auto& th : threads) th.join();
+
+    if (resultado.temCicloNegativo) {
+        // Os relaxamentos paralelos não mantêm a árvore de pais: o ciclo é obtido pela
+        // variante com fila, que para assim que o encontra.
+        resultado.cicloNegativo = executarFila(grafo, origem).cicloNegativo;
+        return resultado;
+    }
+
+    // 3. Predecessores determinísticos: BFS a partir da origem pelas arestas justas
+    // (dist[u] + w == dist[v]). Os relaxamentos usam o peso em float, então o arredondamento
+    // pode deixar vértices finitos fora da BFS; como no FloydWarshall, o vértice pendente de
+    // menor folga dist[u] + w - dist[v] entra pela sua melhor aresta vinda da árvore e a BFS
+    // continua. Assim todo vértice finito tem um caminho de pais até a origem.
+    std::vector<int>& pai = resultado.pai;
+    std::vector<double> melhorFolga(numVertices + 1, std::numeric_limits<double>::max());
+    std::vector<int> candidato(numVertices + 1, -1), fila, tocados;
+    fila.push_back(origem);
+    size_t frente = 0;
+    grafo.visitarCSR([&](const auto& csr) {
+        while (true) {
+            for (; frente < fila.size(); ++frente) {
+                const int u = fila[frente];
+                csr.paraCadaVizinho(u, [&](int v, double peso) {
+                    if (pai[v] != -1 || !finito(dist[v])) return;
+                    if (dist[u] + peso == dist[v]) {
+                        pai[v] = u;
+                        fila.push_back(v);
+                        return;
+                    }
+                    const double folga = dist[u] + peso - dist[v];
+                    if (folga < melhorFolga[v]) {
+                        if (candidato[v] == -1) tocados.push_back(v);
+                        melhorFolga[v] = folga;
+                        candidato[v] = u;
+                    }
+                });
+            }
+            int escolhido = -1;
+            for (int v : tocados) {
+                if (pai[v] == -1 && (escolhido == -1 || melhorFolga[v] < melhorFolga[escolhido])) escolhido = v;
+            }
+            if (escolhido == -1) break;
+            pai[escolhido] = candidato[escolhido];
+            fila.push_back(escolhido);
+        }
+    });
 
     return resultado;
-}
\ No newline at end of file
+}
@@ -6,12 +6,18 @@
  * - Suporta arestas com pesos negativos.
  * - É capaz de detectar ciclos de peso negativo alcançáveis a partir da origem.
  * - Complexidade: O(V * E).
+ * * A variante com fila (SPFA) só relaxa as arestas de saída dos vértices cuja
+ * distância mudou, usando as heurísticas SLF/LLL para a ordem da fila e a
+ * "desmontagem de subárvores" de Tarjan para detectar ciclos negativos cedo.
+ * * Quando há ciclo negativo, os vértices do ciclo são devolvidos em cicloNegativo.
  */
 
 #pragma once
 
 #include <vector>
 
+#include "../../../comum/ContagemOperacoes.h"
+
  // Forward declaration da classe principal de grafos do TP3
 class GrafoPesado;
 
@@ -22,6 +28,8 @@ struct ResultadoBellmanFord {
     std::vector<double> dist;           ///< dist[v]: distância mínima da origem até v
     std::vector<int>    pai;            ///< pai[v]: predecessor de v no caminho mínimo
     bool                temCicloNegativo = false; ///< Indica se foi detectado um ciclo negativo
+    std::vector<int>    cicloNegativo;  ///< Vértices do ciclo encontrado, na ordem das arestas (c0 -> c1 -> ... -> c0)
+    ContadoresOperacoes operacoes;      ///< Preenchido só por executar<ComContagem>
 };
 
 /**
@@ -38,9 +46,79 @@ public:
      * em um ciclo negativo (ida e volta), o que será detectado por este algoritmo.
      * * @param grafo  Referência constante para o grafo ponderado.
      * @param origem Vértice de origem (indexado a partir de 1).
+     * @tparam Contagem SemContagem (padrão) ou ComContagem. Contagens: rodadas (incluindo
+     * a de verificação de ciclo negativo), vértices alcançados expandidos em cada rodada
+     * (verticesFinalizados), arestas examinadas e relaxamentos.
      * * @throws std::runtime_error se a origem for inválida ou o grafo estiver vazio.
      * * @return Estrutura ResultadoBellmanFord contendo distâncias, predecessores
      * e flag de ciclo negativo.
      */
+    template <class Contagem = SemContagem>
     ResultadoBellmanFord executar(const GrafoPesado& grafo, int origem) const;
+
+    /**
+     * @brief Executa a variante com fila do Bellman-Ford (SPFA).
+     * * @details Apenas vértices cuja distância diminuiu entram na fila (deque):
+     * - SLF (Small Label First): um vértice entra no início da fila se sua distância
+     *   for menor que a do vértice no início; caso contrário, entra no fim.
+     * - LLL (Large Label Last): ao retirar, vértices com distância acima da média
+     *   da fila são movidos para o fim.
+     * A árvore de caminhos é mantida em pré-ordem (lista duplamente ligada). Ao
+     * melhorar dist[v], a subárvore de v é desmontada (seus vértices deixam de ser
+     * processados até serem melhorados de novo); se o vértice u que melhorou v
+     * estiver nessa subárvore, existe um ciclo negativo e a execução para na hora.
+     * No caso comum o custo fica próximo ao do Dijkstra; o pior caso continua O(V * E).
+     * * @param grafo  Referência constante para o grafo ponderado.
+     * @param origem Vértice de origem (indexado a partir de 1).
+     * * @throws std::runtime_error se a origem for inválida ou o grafo estiver vazio.
+     * * @return Estrutura ResultadoBellmanFord (mesma semântica de executar). Se houver
+     * ciclo negativo, dist/pai refletem o estado no momento da detecção.
+     */
+    ResultadoBellmanFord executarFila(const GrafoPesado& grafo, int origem) const;
+
+    /**
+     * @brief Executa o Bellman-Ford em paralelo sobre um vetor plano de arestas.
+     * * @details As arestas são copiadas para um vetor contíguo (u, v, peso) e divididas
+     * em blocos, um por thread. Em cada rodada cada thread percorre seu bloco em
+     * sequência (acesso de memória linear) e aplica um "mínimo atômico" em dist[v];
+     * uma flag por rodada indica se alguma distância mudou. As threads são criadas
+     * uma única vez e sincronizadas por barreira ao fim de cada rodada.
+     * Se a rodada V ainda alterar alguma distância, existe ciclo negativo.
+     * O vetor 'pai' é calculado no final, por uma busca em largura (na ordem do CSR)
+     * sobre as arestas "justas" (dist[u] + w == dist[v]), então não depende da ordem
+     * em que as threads fizeram os relaxamentos. Vértices finitos que o arredondamento
+     * deixar fora da busca entram pela aresta de menor folga vinda da árvore.
+     * * @param grafo      Referência constante para o grafo ponderado.
+     * @param origem     Vértice de origem (indexado a partir de 1).
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * * @throws std::runtime_error se a origem for inválida ou o grafo estiver vazio.
+     * * @return Estrutura ResultadoBellmanFord. Se houver ciclo negativo, apenas
+     * 'dist' e a flag são preenchidos ('pai' fica só com a origem).
+     */
+    ResultadoBellmanFord executarParalelo(const GrafoPesado& grafo, int origem, int numThreads = 0) const;
+
+    /**
+     * @brief Encontra ciclos negativos em qualquer parte do grafo (não só os alcançáveis de uma origem).
+     * * @details Usa uma super-origem virtual ligada a todos os vértices com peso 0
+     * (todos começam com distância 0) e a variante com fila, em uma única execução.
+     * A cada ciclo detectado, seus vértices são retirados do grafo e a busca continua,
+     * até que o restante não tenha mais ciclos negativos. Os ciclos retornados são
+     * disjuntos em vértices; se a lista for vazia, o grafo não tem ciclo negativo.
+     * * @param grafo Referência constante para o grafo ponderado.
+     * * @throws std::runtime_error se o grafo estiver vazio.
+     * * @return Lista de ciclos, cada um com os vértices na ordem das arestas.
+     */
+    std::vector<std::vector<int>> encontrarCiclosNegativos(const GrafoPesado& grafo) const;
+
+    /**
+     * @brief Executa a variante com fila a partir de uma super-origem virtual.
+     * * @details A super-origem tem aresta de peso 0 para todo vértice, então dist[v]
+     * é o menor peso de um caminho que termina em v (sempre <= 0). São os potenciais
+     * usados pelo algoritmo de Johnson para eliminar pesos negativos.
+     * * @param grafo Referência constante para o grafo ponderado.
+     * * @throws std::runtime_error se o grafo estiver vazio.
+     * * @return ResultadoBellmanFord com pai[v] = 0 para os vértices ligados direto à
+     * super-origem. Se houver ciclo negativo, a flag e cicloNegativo são preenchidos.
+     */
+    ResultadoBellmanFord executarSuperOrigem(const GrafoPesado& grafo) const;
 };
\ No newline at end of file
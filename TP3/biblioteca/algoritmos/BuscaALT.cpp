@@ -0,0 +1,363 @@
+/**
+ * @file BuscaALT.cpp
+ * @brief Implementação do pré-processamento (landmarks) e das consultas A* da classe BuscaALT.
+ */
+
+#include "BuscaALT.h"
+#include "../interface/GrafoPesado.h"
+#include "../../../comum/Paralelo.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+
+static const double INFINITO_ALT = std::numeric_limits<double>::infinity();
+
+// As tabelas são guardadas em float; cada estimativa é reduzida por esta margem
+// relativa para compensar o arredondamento e manter h(v) <= d(v,t).
+static const float MARGEM_ARREDONDAMENTO = 2.4e-7f;
+
+// Marca, na tabela de distâncias, os pares sem caminho. As distâncias são não negativas,
+// então qualquer valor negativo serve e todas as comparações ficam entre números finitos.
+// Com -ffast-math (Release) o compilador pode supor que não há infinitos nem NaN e
+// eliminar testes como "x == infinito"; por isso a tabela não guarda infinito.
+static const float SEM_CAMINHO_ALT = -1.0f;
+
+namespace {
+
+    // Testa os bits do expoente, em vez de comparar com infinito (ver SEM_CAMINHO_ALT).
+    bool alcancado(double d) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return ((bits >> 52) & 0x7FF) != 0x7FF;
+    }
+
+    float valorTabela(double d) {
+        return alcancado(d) ? static_cast<float>(d) : SEM_CAMINHO_ALT;
+    }
+
+    // Dijkstra sobre um CSR simples (pesos não negativos). 'pai' é opcional.
+    void dijkstraCSR(const std::vector<int>& ponteiros, const std::vector<int>& alvos, const std::vector<double>& pesos,
+        int numVertices, int origem, std::vector<double>& dist, std::vector<int>* pai) {
+        using ItemFila = std::pair<double, int>;
+        std::priority_queue<ItemFila, std::vector<ItemFila>, std::greater<ItemFila>> fila;
+
+        dist.assign(numVertices + 1, INFINITO_ALT);
+        if (pai) pai->assign(numVertices + 1, -1);
+        dist[origem] = 0.0;
+        if (pai) (*pai)[origem] = 0;
+        fila.push({ 0.0, origem });
+
+        while (!fila.empty()) {
+            auto [d, u] = fila.top();
+            fila.pop();
+            if (d > dist[u]) continue;
+            for (int i = ponteiros[u]; i < ponteiros[u + 1]; ++i) {
+                int v = alvos[i];
+                double nd = d + pesos[i];
+                if (nd < dist[v]) {
+                    dist[v] = nd;
+                    if (pai) (*pai)[v] = u;
+                    fila.push({ nd, v });
+                }
+            }
+        }
+    }
+
+} // namespace
+
+void BuscaALT::dijkstraInterno(const std::vector<int>& ponteiros, const std::vector<int>& alvos,
+    const std::vector<double>& pesos, int origem, std::vector<double>& distSaida) const {
+    dijkstraCSR(ponteiros, alvos, pesos, numeroDeVertices, origem, distSaida, nullptr);
+}
+
+void BuscaALT::preprocessar(const GrafoPesado& grafo, int numLandmarks, SelecaoLandmarks selecao, unsigned int semente, int numThreads) {
+    if (grafo.temPesoNegativo()) {
+        throw std::runtime_error("ALT nao suporta grafos com pesos negativos.");
+    }
+    const int n = grafo.obterNumeroVertices();
+    if (numLandmarks <= 0 || numLandmarks > n) {
+        throw std::runtime_error("Numero de landmarks invalido para ALT.");
+    }
+    numeroDeVertices = n;
+    k = numLandmarks;
+    const int largura = 2 * k;
+
+    // 1. Cópia CSR do grafo (saída) e CSR reverso temporário (entrada)
+    ponteirosInicio.assign(n + 2, 0);
+    listaVizinhos.clear();
+    listaPesos.clear();
+    std::vector<int> grauEntrada(n + 2, 0);
+    for (int u = 1; u <= n; ++u) {
+        for (const auto& viz : grafo.obterVizinhosComPesos(u)) {
+            listaVizinhos.push_back(viz.id);
+            listaPesos.push_back(viz.peso);
+            grauEntrada[viz.id]++;
+        }
+        ponteirosInicio[u + 1] = static_cast<int>(listaVizinhos.size());
+    }
+
+    std::vector<int> ponteirosReversos(n + 2, 0);
+    for (int v = 1; v <= n; ++v) ponteirosReversos[v + 1] = ponteirosReversos[v] + grauEntrada[v];
+    std::vector<int> vizinhosReversos(listaVizinhos.size());
+    std::vector<double> pesosReversos(listaPesos.size());
+    {
+        std::vector<int> escrita(ponteirosReversos.begin(), ponteirosReversos.end());
+        for (int u = 1; u <= n; ++u) {
+            for (int i = ponteirosInicio[u]; i < ponteirosInicio[u + 1]; ++i) {
+                int pos = escrita[listaVizinhos[i]]++;
+                vizinhosReversos[pos] = u;
+                pesosReversos[pos] = listaPesos[i];
+            }
+        }
+    }
+
+    tabelaDistancias.assign(static_cast<size_t>(n + 1) * largura, SEM_CAMINHO_ALT);
+    auto gravarColunaIda = [&](int i, const std::vector<double>& d) {
+        for (int v = 1; v <= n; ++v) tabelaDistancias[static_cast<size_t>(v) * largura + i] = valorTabela(d[v]);
+    };
+
+    // 2. Escolha dos landmarks. Cada landmark escolhido já tem sua coluna de ida
+    // (d(L,v)) calculada, pois as heurísticas dependem dos landmarks anteriores.
+    std::mt19937 gerador(semente);
+    std::uniform_int_distribution<int> sorteio(1, n);
+    std::vector<char> ehLandmark(n + 1, 0);
+    landmarks.clear();
+
+    auto sortearNaoLandmark = [&]() {
+        int v;
+        do { v = sorteio(gerador); } while (ehLandmark[v]);
+        return v;
+    };
+
+    std::vector<double> distAtual;
+    std::vector<int> paiAtual;
+
+    if (selecao == SelecaoLandmarks::MAIS_DISTANTE) {
+        // menorDist[v]: distância de v ao landmark mais próximo (a partir de um vértice aleatório no início)
+        std::vector<double> menorDist;
+        dijkstraInterno(ponteirosInicio, listaVizinhos, listaPesos, sortearNaoLandmark(), menorDist);
+
+        for (int i = 0; i < k; ++i) {
+            int escolhido = -1;
+            double maior = -1.0;
+            for (int v = 1; v <= n; ++v) {
+                if (!ehLandmark[v] && alcancado(menorDist[v]) && menorDist[v] > maior) {
+                    maior = menorDist[v];
+                    escolhido = v;
+                }
+            }
+            if (escolhido == -1) escolhido = sortearNaoLandmark(); // Nada alcançável: outra componente
+
+            landmarks.push_back(escolhido);
+            ehLandmark[escolhido] = 1;
+            dijkstraInterno(ponteirosInicio, listaVizinhos, listaPesos, escolhido, distAtual);
+            gravarColunaIda(i, distAtual);
+            if (i == 0) menorDist = distAtual; // Descarta a raiz aleatória usada só para achar o primeiro
+            else {
+                for (int v = 1; v <= n; ++v) menorDist[v] = std::min(menorDist[v], distAtual[v]);
+            }
+        }
+    }
+    else {
+        // Heurística "avoid": a partir de uma raiz aleatória r, pesa cada vértice pela
+        // folga d(r,v) - estimativa(r,v) e desce na árvore de caminhos mínimos pelo
+        // filho de maior peso acumulado (ignorando subárvores que já têm landmark).
+        std::vector<double> pesoSubarvore(n + 1);
+        std::vector<char> contemLandmark(n + 1);
+        std::vector<int> ordem, ponteirosFilhos(n + 2), filhos(n);
+
+        for (int i = 0; i < k; ++i) {
+            int raiz = sortearNaoLandmark();
+            dijkstraCSR(ponteirosInicio, listaVizinhos, listaPesos, n, raiz, distAtual, &paiAtual);
+
+            ordem.clear();
+            std::fill(ponteirosFilhos.begin(), ponteirosFilhos.end(), 0);
+            for (int v = 1; v <= n; ++v) {
+                pesoSubarvore[v] = 0.0;
+                contemLandmark[v] = ehLandmark[v];
+                if (!alcancado(distAtual[v])) continue;
+                ordem.push_back(v);
+
+                double estimativaRV = 0.0;
+                for (int j = 0; j < i; ++j) {
+                    double dLv = tabelaDistancias[static_cast<size_t>(v) * largura + j];
+                    double dLr = tabelaDistancias[static_cast<size_t>(raiz) * largura + j];
+                    if (dLv >= 0.0 && dLr >= 0.0) estimativaRV = std::max(estimativaRV, dLv - dLr);
+                }
+                pesoSubarvore[v] = std::max(0.0, distAtual[v] - estimativaRV);
+                if (v != raiz) ponteirosFilhos[paiAtual[v] + 1]++;
+            }
+            for (int v = 1; v <= n; ++v) ponteirosFilhos[v + 1] += ponteirosFilhos[v];
+            {
+                std::vector<int> escrita(ponteirosFilhos.begin(), ponteirosFilhos.end());
+                for (int v : ordem) {
+                    if (v != raiz) filhos[escrita[paiAtual[v]]++] = v;
+                }
+            }
+
+            // Acumula pesos das folhas para a raiz (ordem decrescente de distância)
+            std::sort(ordem.begin(), ordem.end(), [&](int a, int b) { return distAtual[a] > distAtual[b]; });
+            for (int v : ordem) {
+                if (v == raiz) continue;
+                int p = paiAtual[v];
+                if (contemLandmark[v]) contemLandmark[p] = 1;
+                else pesoSubarvore[p] += pesoSubarvore[v];
+            }
+
+            // Desce pelo filho mais pesado sem landmark até chegar a uma folha
+            int atual = raiz;
+            while (true) {
+                int melhorFilho = -1;
+                double melhorPeso = 0.0;
+                for (int f = ponteirosFilhos[atual]; f < ponteirosFilhos[atual + 1]; ++f) {
+                    int c = filhos[f];
+                    if (!contemLandmark[c] && pesoSubarvore[c] > melhorPeso) {
+                        melhorPeso = pesoSubarvore[c];
+                        melhorFilho = c;
+                    }
+                }
+                if (melhorFilho == -1) break;
+                atual = melhorFilho;
+            }
+            int escolhido = ehLandmark[atual] ? sortearNaoLandmark() : atual;
+
+            landmarks.push_back(escolhido);
+            ehLandmark[escolhido] = 1;
+            dijkstraInterno(ponteirosInicio, listaVizinhos, listaPesos, escolhido, distAtual);
+            gravarColunaIda(i, distAtual);
+        }
+    }
+
+    // 3. Colunas de volta (d(v,L)): Dijkstra no grafo reverso, um landmark por tarefa.
+    // Em grafos não direcionados d(v,L) = d(L,v) e basta copiar.
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    std::vector<std::vector<float>> colunasVolta(k);
+    if (grafo.consultaDirecionado()) {
+        std::vector<std::vector<double>> distPorThread(numThreads);
+        executarEmParalelo(k, numThreads, [&](int i, int idThread) {
+            std::vector<double>& d = distPorThread[idThread];
+            dijkstraInterno(ponteirosReversos, vizinhosReversos, pesosReversos, landmarks[i], d);
+            colunasVolta[i].resize(d.size());
+            std::transform(d.begin(), d.end(), colunasVolta[i].begin(), valorTabela);
+        });
+    }
+
+    // Transposição para o layout vértice-major, em blocos de vértices independentes
+    const int tamanhoBloco = 4096;
+    const int numBlocos = (n + tamanhoBloco) / tamanhoBloco;
+    executarEmParalelo(numBlocos, numThreads, [&](int bloco, int) {
+        int inicio = std::max(1, bloco * tamanhoBloco);
+        int fim = std::min(n, (bloco + 1) * tamanhoBloco - 1);
+        for (int v = inicio; v <= fim; ++v) {
+            float* linha = &tabelaDistancias[static_cast<size_t>(v) * largura];
+            for (int i = 0; i < k; ++i) {
+                linha[k + i] = colunasVolta[i].empty() ? linha[i] : colunasVolta[i][v];
+            }
+        }
+    });
+
+    dist.assign(n + 1, INFINITO_ALT);
+    pai.assign(n + 1, -1);
+    marca.assign(n + 1, 0);
+    tickConsulta = 0;
+}
+
+const std::vector<int>& BuscaALT::obterLandmarks() const {
+    return landmarks;
+}
+
+/**
+ * @brief Estimativa inferior de d(v, t) pela desigualdade triangular.
+ * @details Um termo só vale se a distância subtraída existe (L alcança v, ou t
+ * alcança L). Se ela existe e a outra não, t não é alcançável a partir de v: a
+ * função devolve SEM_CAMINHO_ALT e o vértice é descartado da busca.
+ */
+float BuscaALT::estimativa(int v, const float* linhaDestino) const {
+    const float* linhaV = &tabelaDistancias[static_cast<size_t>(v) * 2 * k];
+    float h = 0.0f;
+    for (int i = 0; i < k; ++i) {
+        // d(v,t) >= d(L,t) - d(L,v)
+        if (linhaV[i] >= 0.0f) {
+            if (linhaDestino[i] < 0.0f) return SEM_CAMINHO_ALT; // L alcança v mas não t
+            float ida = linhaDestino[i] * (1.0f - MARGEM_ARREDONDAMENTO) - linhaV[i] * (1.0f + MARGEM_ARREDONDAMENTO);
+            if (ida > h) h = ida;
+        }
+        // d(v,t) >= d(v,L) - d(t,L)
+        if (linhaDestino[k + i] >= 0.0f) {
+            if (linhaV[k + i] < 0.0f) return SEM_CAMINHO_ALT; // t alcança L mas v não
+            float volta = linhaV[k + i] * (1.0f - MARGEM_ARREDONDAMENTO) - linhaDestino[k + i] * (1.0f + MARGEM_ARREDONDAMENTO);
+            if (volta > h) h = volta;
+        }
+    }
+    return h;
+}
+
+ResultadoALT BuscaALT::consultar(int origem, int destino) const {
+    if (numeroDeVertices <= 0) {
+        throw std::runtime_error("BuscaALT: execute preprocessar antes de consultar.");
+    }
+    if (origem <= 0 || origem > numeroDeVertices || destino <= 0 || destino > numeroDeVertices) {
+        throw std::runtime_error("Vertice invalido na consulta ALT.");
+    }
+
+    ResultadoALT resultado{ INFINITO_ALT, {}, 0 };
+
+    if (tickConsulta == std::numeric_limits<int>::max()) {
+        std::fill(marca.begin(), marca.end(), 0);
+        tickConsulta = 0;
+    }
+    const int tick = ++tickConsulta;
+    auto distDe = [&](int v) { return marca[v] == tick ? dist[v] : INFINITO_ALT; };
+
+    const float* linhaDestino = &tabelaDistancias[static_cast<size_t>(destino) * 2 * k];
+
+    // Fila do A*: {f = g + h, g, vértice}
+    using ItemFila = std::tuple<double, double, int>;
+    std::priority_queue<ItemFila, std::vector<ItemFila>, std::greater<ItemFila>> fila;
+
+    const float hOrigem = estimativa(origem, linhaDestino);
+    if (hOrigem < 0.0f) return resultado; // Destino inalcançável a partir da origem
+    dist[origem] = 0.0;
+    pai[origem] = 0;
+    marca[origem] = tick;
+    fila.push({ hOrigem, 0.0, origem });
+
+    bool encontrado = false;
+
+    while (!fila.empty()) {
+        auto [f, g, u] = fila.top();
+        fila.pop();
+        if (g > dist[u]) continue; // Entrada obsoleta
+
+        resultado.verticesFinalizados++;
+        if (u == destino) {
+            resultado.distancia = g;
+            encontrado = true;
+            break;
+        }
+
+        for (int i = ponteirosInicio[u]; i < ponteirosInicio[u + 1]; ++i) {
+            int v = listaVizinhos[i];
+            double nd = g + listaPesos[i];
+            if (nd < distDe(v)) {
+                float h = estimativa(v, linhaDestino);
+                if (h < 0.0f) continue; // Destino inalcançável a partir de v
+                dist[v] = nd;
+                pai[v] = u;
+                marca[v] = tick;
+                fila.push({ nd + h, nd, v });
+            }
+        }
+    }
+
+    if (encontrado) {
+        for (int v = destino; v != 0; v = pai[v]) resultado.caminho.push_back(v);
+        std::reverse(resultado.caminho.begin(), resultado.caminho.end());
+    }
+    return resultado;
+}
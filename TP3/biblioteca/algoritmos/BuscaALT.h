@@ -0,0 +1,101 @@
+/**
+ * @file BuscaALT.h
+ * @brief Declaração da classe BuscaALT (A*, Landmarks e desigualdade Triangular).
+ * * O algoritmo ALT:
+ * - Pré-processamento leve: escolhe k vértices "landmarks" e guarda as distâncias
+ *   de cada landmark para todos os vértices e de todos os vértices para cada landmark.
+ * - Consulta: A* em que a estimativa h(v) vem da desigualdade triangular:
+ *   d(v,t) >= d(L,t) - d(L,v)  e  d(v,t) >= d(v,L) - d(t,L).
+ * - A busca é guiada para o destino e finaliza bem menos vértices que o Dijkstra.
+ * - Requer pesos não negativos (mesma restrição do Dijkstra).
+ */
+
+#pragma once
+
+#include <vector>
+
+ // Forward declaration da classe principal de grafos do TP3
+class GrafoPesado;
+
+/**
+ * @enum SelecaoLandmarks
+ * @brief Heurística usada para escolher os landmarks.
+ */
+enum class SelecaoLandmarks {
+    MAIS_DISTANTE, ///< Cada novo landmark é o vértice mais distante dos já escolhidos
+    EVITAR         ///< Heurística "avoid": cobre regiões onde as estimativas atuais são piores
+};
+
+/**
+ * @brief Estrutura que armazena o resultado de uma consulta ALT.
+ * @details Como no ResultadoConsultaCH, só o caminho é devolvido: a árvore da busca
+ * fica nos buffers internos e a consulta não aloca vetores de tamanho V.
+ */
+struct ResultadoALT {
+    double distancia;          ///< Distância mínima (infinito se o destino for inalcançável)
+    std::vector<int> caminho;  ///< Vértices do caminho mínimo, de origem a destino (vazio se inalcançável)
+    int verticesFinalizados;   ///< Quantidade de vértices retirados da fila (esforço da busca)
+};
+
+/**
+ * @class BuscaALT
+ * @brief Motor de consultas ponto-a-ponto com A* e landmarks.
+ * @details Após o pré-processamento o objeto guarda uma cópia compacta do grafo
+ * (CSR) e não depende mais do GrafoPesado. As consultas reutilizam buffers
+ * internos: um mesmo objeto não deve ser consultado por várias threads ao mesmo tempo.
+ */
+class BuscaALT {
+public:
+    /**
+     * @brief Escolhe os landmarks e calcula as tabelas de distâncias.
+     * @details As tabelas de distância reversa (vértice -> landmark) são calculadas
+     * com execuções de Dijkstra em paralelo, uma por landmark.
+     * @param grafo O grafo ponderado (direcionado ou não).
+     * @param numLandmarks Quantidade de landmarks (k).
+     * @param selecao Heurística de escolha dos landmarks.
+     * @param semente Semente do gerador aleatório (torna a escolha reprodutível).
+     * @param numThreads Threads usadas nas execuções de Dijkstra (<= 0 usa o padrão).
+     * @throws std::runtime_error se o grafo contiver pesos negativos ou k for inválido.
+     */
+    void preprocessar(const GrafoPesado& grafo, int numLandmarks = 8,
+        SelecaoLandmarks selecao = SelecaoLandmarks::EVITAR, unsigned int semente = 42, int numThreads = 0);
+
+    /**
+     * @brief Calcula a distância mínima (e o caminho) entre dois vértices.
+     * @param origem Vértice de origem (indexado a partir de 1).
+     * @param destino Vértice de destino (indexado a partir de 1).
+     * @return ResultadoALT com a distância, o caminho e o número de vértices finalizados.
+     * @throws std::runtime_error se o pré-processamento não foi feito ou os vértices forem inválidos.
+     */
+    ResultadoALT consultar(int origem, int destino) const;
+
+    /**
+     * @brief Obtém os landmarks escolhidos no pré-processamento.
+     */
+    const std::vector<int>& obterLandmarks() const;
+
+private:
+    float estimativa(int v, const float* linhaDestino) const;
+    void dijkstraInterno(const std::vector<int>& ponteiros, const std::vector<int>& alvos,
+        const std::vector<double>& pesos, int origem, std::vector<double>& dist) const;
+
+    int numeroDeVertices = 0;
+    int k = 0;
+    std::vector<int> landmarks;
+
+    // Cópia CSR do grafo (arestas de saída)
+    std::vector<int> ponteirosInicio;
+    std::vector<int> listaVizinhos;
+    std::vector<double> listaPesos;
+
+    // Tabela de distâncias "vértice-major": para cada v, 2k floats contíguos:
+    // [d(L_0,v) .. d(L_k-1,v) | d(v,L_0) .. d(v,L_k-1)]
+    // Pares sem caminho guardam um valor negativo (sentinela finito), e não infinito.
+    std::vector<float> tabelaDistancias;
+
+    // Buffers reutilizados entre consultas (dist[v] e pai[v] só valem se marca[v] é o tick atual)
+    mutable std::vector<double> dist;
+    mutable std::vector<int> pai;
+    mutable std::vector<int> marca;
+    mutable int tickConsulta = 0;
+};
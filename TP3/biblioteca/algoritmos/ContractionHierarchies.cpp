@@ -0,0 +1,630 @@
+/**
+ * @file ContractionHierarchies.cpp
+ * @brief Implementação do pré-processamento, consulta e serialização das Contraction Hierarchies.
+ */
+
+#include "ContractionHierarchies.h"
+#include "../interface/GrafoPesado.h"
+#include "../../../comum/Paralelo.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+static const double INFINITO_CH = std::numeric_limits<double>::infinity();
+
+// Limite de vértices finalizados em cada busca de testemunha. Se a busca parar
+// antes de provar que existe um caminho alternativo, o atalho é criado (seguro).
+static const int LIMITE_BUSCA_TESTEMUNHA = 500;
+
+// Identificação do arquivo binário do índice
+static const char ASSINATURA_INDICE_CH[4] = { 'G', 'P', 'C', 'H' };
+static const std::uint32_t VERSAO_INDICE_CH = 1;
+
+namespace {
+
+    // Aresta do grafo dinâmico usado durante a contração
+    struct ArestaDinamica {
+        int alvo;
+        double peso;
+        int meio;
+    };
+
+    struct AtalhoCandidato {
+        int de;
+        int para;
+        double peso;
+    };
+
+    /**
+     * @brief Grafo de trabalho do pré-processamento (listas de saída e entrada editáveis).
+     */
+    struct GrafoContracao {
+        std::vector<std::vector<ArestaDinamica>> saida;
+        std::vector<std::vector<ArestaDinamica>> entrada;
+        std::vector<char> contraido;
+        std::vector<int> vizinhosContraidos;
+    };
+
+    /**
+     * @brief Buffers de uma busca de testemunha (um por thread).
+     */
+    struct EspacoTestemunha {
+        std::vector<double> dist;
+        std::vector<int> tocados;
+        std::vector<std::pair<double, int>> heap;
+
+        explicit EspacoTestemunha(int n) : dist(n + 1, INFINITO_CH) {}
+
+        void limpar() {
+            for (int v : tocados) dist[v] = INFINITO_CH;
+            tocados.clear();
+            heap.clear();
+        }
+    };
+
+    // Insere (ou melhora) a aresta de -> alvo em uma lista de adjacência dinâmica.
+    // Retorna true se a aresta não existia.
+    bool inserirOuMelhorar(std::vector<ArestaDinamica>& lista, int alvo, double peso, int meio) {
+        for (auto& a : lista) {
+            if (a.alvo == alvo) {
+                if (peso < a.peso) {
+                    a.peso = peso;
+                    a.meio = meio;
+                }
+                return false;
+            }
+        }
+        lista.push_back({ alvo, peso, meio });
+        return true;
+    }
+
+    void removerAlvo(std::vector<ArestaDinamica>& lista, int alvo) {
+        for (size_t i = 0; i < lista.size(); ++i) {
+            if (lista[i].alvo == alvo) {
+                lista[i] = lista.back();
+                lista.pop_back();
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Dijkstra local a partir de 'origem' ignorando o vértice 'ignorado'.
+     * @details Para quando a menor distância da fila ultrapassa 'limite' ou quando
+     * LIMITE_BUSCA_TESTEMUNHA vértices foram finalizados.
+     */
+    void buscaTestemunha(const GrafoContracao& g, int origem, int ignorado, double limite, EspacoTestemunha& esp) {
+        auto maiorPrioridade = [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+            return a.first > b.first; // min-heap
+        };
+
+        esp.limpar();
+        esp.dist[origem] = 0.0;
+        esp.tocados.push_back(origem);
+        esp.heap.push_back({ 0.0, origem });
+
+        int finalizados = 0;
+        while (!esp.heap.empty()) {
+            std::pop_heap(esp.heap.begin(), esp.heap.end(), maiorPrioridade);
+            auto [d, u] = esp.heap.back();
+            esp.heap.pop_back();
+
+            if (d > esp.dist[u]) continue; // Entrada obsoleta
+            if (d > limite || ++finalizados > LIMITE_BUSCA_TESTEMUNHA) break;
+
+            for (const auto& a : g.saida[u]) {
+                int v = a.alvo;
+                if (v == ignorado || g.contraido[v]) continue;
+                double nd = d + a.peso;
+                if (nd < esp.dist[v]) {
+                    if (esp.dist[v] == INFINITO_CH) esp.tocados.push_back(v);
+                    esp.dist[v] = nd;
+                    esp.heap.push_back({ nd, v });
+                    std::push_heap(esp.heap.begin(), esp.heap.end(), maiorPrioridade);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Simula a contração de v, preenchendo 'atalhos' com os atalhos necessários.
+     */
+    void simularContracao(const GrafoContracao& g, int v, EspacoTestemunha& esp, std::vector<AtalhoCandidato>& atalhos) {
+        atalhos.clear();
+        const auto& entrada = g.entrada[v];
+        const auto& saida = g.saida[v];
+        if (entrada.empty() || saida.empty()) return;
+
+        double maiorSaida = 0.0;
+        for (const auto& s : saida) maiorSaida = std::max(maiorSaida, s.peso);
+
+        for (const auto& e : entrada) {
+            int u = e.alvo;
+            buscaTestemunha(g, u, v, e.peso + maiorSaida, esp);
+            for (const auto& s : saida) {
+                int w = s.alvo;
+                if (w == u) continue;
+                double viaV = e.peso + s.peso;
+                if (esp.dist[w] > viaV) {
+                    atalhos.push_back({ u, w, viaV });
+                }
+            }
+        }
+    }
+
+    int calcularPrioridade(const GrafoContracao& g, int v, int numAtalhos) {
+        // Diferença de arestas + vizinhos já contraídos (espalha a contração pelo grafo)
+        int arestasRemovidas = static_cast<int>(g.entrada[v].size() + g.saida[v].size());
+        return (numAtalhos - arestasRemovidas) + g.vizinhosContraidos[v];
+    }
+
+    template <typename T>
+    void escreverVetor(std::ofstream& arquivo, const std::vector<T>& vetor) {
+        std::uint64_t tamanho = vetor.size();
+        arquivo.write(reinterpret_cast<const char*>(&tamanho), sizeof(tamanho));
+        arquivo.write(reinterpret_cast<const char*>(vetor.data()), static_cast<std::streamsize>(tamanho * sizeof(T)));
+    }
+
+    // Peso finito e não negativo. O teste de finitude olha os bits: com -ffast-math
+    // (Release), o compilador pode supor que NaN e infinito não existem e eliminar
+    // comparações com eles.
+    bool pesoValido(double peso) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &peso, sizeof(bits));
+        return ((bits >> 52) & 0x7FF) != 0x7FF && peso >= 0.0;
+    }
+
+    // 'restante' é o número de bytes do arquivo ainda não lidos (evita alocar um tamanho corrompido)
+    template <typename T>
+    void lerVetor(std::ifstream& arquivo, std::vector<T>& vetor, std::uint64_t& restante) {
+        std::uint64_t tamanho = 0;
+        arquivo.read(reinterpret_cast<char*>(&tamanho), sizeof(tamanho));
+        if (!arquivo || restante < sizeof(tamanho)) throw std::runtime_error("Indice CH truncado.");
+        restante -= sizeof(tamanho);
+        if (tamanho > restante / sizeof(T)) throw std::runtime_error("Indice CH truncado.");
+        restante -= tamanho * sizeof(T);
+        vetor.resize(static_cast<size_t>(tamanho));
+        arquivo.read(reinterpret_cast<char*>(vetor.data()), static_cast<std::streamsize>(tamanho * sizeof(T)));
+        if (!arquivo) throw std::runtime_error("Indice CH truncado.");
+    }
+
+} // namespace
+
+void ContractionHierarchies::preprocessar(const GrafoPesado& grafo, int numThreads) {
+    if (grafo.temPesoNegativo()) {
+        throw std::runtime_error("Contraction Hierarchies nao suporta grafos com pesos negativos.");
+    }
+
+    const int n = grafo.obterNumeroVertices();
+
+    // 1. Monta o grafo dinâmico (listas de saída e entrada, sem arestas paralelas)
+    GrafoContracao g;
+    g.saida.resize(n + 1);
+    g.entrada.resize(n + 1);
+    g.contraido.assign(n + 1, 0);
+    g.vizinhosContraidos.assign(n + 1, 0);
+
+    for (int u = 1; u <= n; ++u) {
+        for (const auto& viz : grafo.obterVizinhosComPesos(u)) {
+            g.saida[u].push_back({ viz.id, viz.peso, -1 });
+            g.entrada[viz.id].push_back({ u, viz.peso, -1 });
+        }
+    }
+    auto porAlvoEPeso = [](const ArestaDinamica& a, const ArestaDinamica& b) {
+        return a.alvo != b.alvo ? a.alvo < b.alvo : a.peso < b.peso;
+    };
+    auto mesmoAlvo = [](const ArestaDinamica& a, const ArestaDinamica& b) { return a.alvo == b.alvo; };
+    for (int u = 1; u <= n; ++u) {
+        for (auto* lista : { &g.saida[u], &g.entrada[u] }) {
+            std::sort(lista->begin(), lista->end(), porAlvoEPeso);
+            lista->erase(std::unique(lista->begin(), lista->end(), mesmoAlvo), lista->end()); // Mantém a mais leve
+        }
+    }
+
+    // 2. Prioridades iniciais: cada simulação é independente, então roda em paralelo
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    std::vector<int> prioridade(n + 1, 0);
+    std::vector<EspacoTestemunha> espacos(numThreads, EspacoTestemunha(n));
+    std::vector<std::vector<AtalhoCandidato>> atalhosPorThread(numThreads);
+    executarEmParalelo(n, numThreads, [&](int indice, int idThread) {
+        int v = indice + 1;
+        simularContracao(g, v, espacos[idThread], atalhosPorThread[idThread]);
+        prioridade[v] = calcularPrioridade(g, v, static_cast<int>(atalhosPorThread[idThread].size()));
+    });
+
+    // 3. Contração em rodadas. Cada rodada seleciona os vértices cuja prioridade é mínima
+    // entre os vizinhos (um conjunto independente) e simula a contração de todos em
+    // paralelo. Durante essas buscas de testemunha, todos os selecionados já contam como
+    // contraídos: uma testemunha que passasse por outro vértice da rodada deixaria de
+    // existir depois dela. A atualização das prioridades é preguiçosa, como na versão com
+    // fila: a simulação dá a prioridade atual do vértice, e ele só é contraído se ela
+    // continuar mínima entre os vizinhos; senão, volta para a próxima rodada com a nova
+    // prioridade. O índice não depende do número de threads.
+    auto precede = [&](int a, int b) { // Ordem total: prioridade, depois o número do vértice
+        return prioridade[a] != prioridade[b] ? prioridade[a] < prioridade[b] : a < b;
+    };
+    auto minimoEntreVizinhos = [&](int v) {
+        for (const auto* lista : { &g.saida[v], &g.entrada[v] }) {
+            for (const auto& a : *lista) {
+                if (precede(a.alvo, v)) return false;
+            }
+        }
+        return true;
+    };
+    std::vector<std::vector<ArestaDinamica>> subida(n + 1), descida(n + 1);
+    std::vector<int> restantes(n);
+    for (int v = 1; v <= n; ++v) restantes[v - 1] = v;
+    std::vector<char> selecionado(n + 1, 0), adiado(n + 1, 0);
+    std::vector<int> rodada;
+    std::vector<std::vector<AtalhoCandidato>> atalhosRodada;
+    nivel.assign(n + 1, 0);
+    numeroDeAtalhos = 0;
+    int proximoNivel = 0;
+    const int TAMANHO_BLOCO = 1024;
+
+    while (!restantes.empty()) {
+        // 3a. Seleção do conjunto independente (em blocos de 'restantes')
+        const int total = static_cast<int>(restantes.size());
+        executarEmParalelo((total + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO, numThreads, [&](int bloco, int) {
+            const int fim = std::min(total, (bloco + 1) * TAMANHO_BLOCO);
+            for (int i = bloco * TAMANHO_BLOCO; i < fim; ++i) selecionado[restantes[i]] = minimoEntreVizinhos(restantes[i]);
+        });
+        rodada.clear();
+        for (int v : restantes) {
+            if (selecionado[v]) rodada.push_back(v);
+        }
+        for (int v : rodada) g.contraido[v] = 1;
+
+        // 3b. Atalhos e prioridade atual de cada vértice da rodada (buscas de testemunha em
+        // paralelo). Os vizinhos não estão na rodada, então suas prioridades não mudam aqui.
+        atalhosRodada.resize(rodada.size());
+        executarEmParalelo(static_cast<int>(rodada.size()), numThreads, [&](int indice, int idThread) {
+            const int v = rodada[indice];
+            simularContracao(g, v, espacos[idThread], atalhosRodada[indice]);
+            prioridade[v] = calcularPrioridade(g, v, static_cast<int>(atalhosRodada[indice].size()));
+            adiado[v] = !minimoEntreVizinhos(v);
+        });
+
+        // 3c. Aplica a contração (sequencial: os vértices da rodada têm vizinhos em comum)
+        for (size_t k = 0; k < rodada.size(); ++k) {
+            const int v = rodada[k];
+            if (adiado[v]) {
+                // Ficou mais caro que algum vizinho: reavalia na próxima rodada
+                g.contraido[v] = 0;
+                adiado[v] = 0;
+                atalhosRodada[k].clear();
+                continue;
+            }
+            // Arestas de v para vértices ainda não contraídos sobem na hierarquia
+            subida[v] = g.saida[v];
+            descida[v] = g.entrada[v];
+            nivel[v] = proximoNivel++;
+
+            for (const auto& a : atalhosRodada[k]) {
+                if (inserirOuMelhorar(g.saida[a.de], a.para, a.peso, v)) {
+                    ++numeroDeAtalhos;
+                }
+                inserirOuMelhorar(g.entrada[a.para], a.de, a.peso, v);
+            }
+
+            // Remove v das listas dos vizinhos
+            for (const auto& e : g.entrada[v]) {
+                removerAlvo(g.saida[e.alvo], v);
+                g.vizinhosContraidos[e.alvo]++;
+            }
+            for (const auto& s : g.saida[v]) {
+                removerAlvo(g.entrada[s.alvo], v);
+                g.vizinhosContraidos[s.alvo]++;
+            }
+            std::vector<ArestaDinamica>().swap(g.saida[v]);
+            std::vector<ArestaDinamica>().swap(g.entrada[v]);
+            std::vector<AtalhoCandidato>().swap(atalhosRodada[k]);
+        }
+
+        restantes.erase(std::remove_if(restantes.begin(), restantes.end(), [&](int v) { return g.contraido[v] != 0; }),
+            restantes.end());
+    }
+
+    // 4. Compacta os grafos de subida/descida em CSR, ordenados por alvo
+    auto montarCSR = [n](std::vector<std::vector<ArestaDinamica>>& listas, std::vector<int>& ponteiros, std::vector<ArestaCH>& arestas) {
+        ponteiros.assign(n + 2, 0);
+        for (int v = 1; v <= n; ++v) {
+            ponteiros[v + 1] = ponteiros[v] + static_cast<int>(listas[v].size());
+        }
+        arestas.clear();
+        arestas.reserve(ponteiros[n + 1]);
+        for (int v = 1; v <= n; ++v) {
+            auto& lista = listas[v];
+            std::sort(lista.begin(), lista.end(), [](const ArestaDinamica& a, const ArestaDinamica& b) { return a.alvo < b.alvo; });
+            for (const auto& a : lista) arestas.push_back({ a.alvo, a.peso, a.meio });
+            std::vector<ArestaDinamica>().swap(lista);
+        }
+    };
+    montarCSR(subida, ponteirosSubida, arestasSubida);
+    montarCSR(descida, ponteirosDescida, arestasDescida);
+
+    numeroDeVertices = n;
+    prepararBuffersConsulta();
+}
+
+void ContractionHierarchies::prepararBuffersConsulta() const {
+    distIda.assign(numeroDeVertices + 1, INFINITO_CH);
+    distVolta.assign(numeroDeVertices + 1, INFINITO_CH);
+    paiIda.assign(numeroDeVertices + 1, -1);
+    paiVolta.assign(numeroDeVertices + 1, -1);
+    marcaIda.assign(numeroDeVertices + 1, 0);
+    marcaVolta.assign(numeroDeVertices + 1, 0);
+    tickConsulta = 0;
+}
+
+bool ContractionHierarchies::estaPronto() const {
+    return numeroDeVertices > 0;
+}
+
+int ContractionHierarchies::obterNumeroVertices() const {
+    return numeroDeVertices;
+}
+
+long long ContractionHierarchies::obterNumeroAtalhos() const {
+    return numeroDeAtalhos;
+}
+
+ResultadoConsultaCH ContractionHierarchies::consultar(int origem, int destino) const {
+    if (!estaPronto()) {
+        throw std::runtime_error("Indice CH nao foi construido nem carregado.");
+    }
+    if (origem <= 0 || origem > numeroDeVertices || destino <= 0 || destino > numeroDeVertices) {
+        throw std::runtime_error("Vertice invalido na consulta CH.");
+    }
+
+    ResultadoConsultaCH resultado{ INFINITO_CH, {} };
+    if (origem == destino) {
+        resultado.distancia = 0.0;
+        resultado.caminho.push_back(origem);
+        return resultado;
+    }
+
+    if (tickConsulta == std::numeric_limits<int>::max()) prepararBuffersConsulta();
+    const int tick = ++tickConsulta;
+    auto lerDist = [tick](const std::vector<double>& dist, const std::vector<int>& marca, int v) {
+        return marca[v] == tick ? dist[v] : INFINITO_CH;
+    };
+
+    using ItemFila = std::pair<double, int>;
+    std::priority_queue<ItemFila, std::vector<ItemFila>, std::greater<ItemFila>> filaIda, filaVolta;
+
+    distIda[origem] = 0.0; paiIda[origem] = 0; marcaIda[origem] = tick;
+    distVolta[destino] = 0.0; paiVolta[destino] = 0; marcaVolta[destino] = tick;
+    filaIda.push({ 0.0, origem });
+    filaVolta.push({ 0.0, destino });
+
+    double melhor = INFINITO_CH;
+    int encontro = -1;
+
+    // Um passo de uma das buscas; ambas só percorrem arestas que sobem de nível
+    auto passo = [&](auto& fila, std::vector<double>& dist, std::vector<int>& pai, std::vector<int>& marca,
+        const std::vector<double>& distOposta, const std::vector<int>& marcaOposta,
+        const std::vector<int>& ponteiros, const std::vector<ArestaCH>& arestas) {
+        auto [d, u] = fila.top();
+        fila.pop();
+        if (d > dist[u]) return; // Entrada obsoleta
+
+        double dOposta = lerDist(distOposta, marcaOposta, u);
+        if (d + dOposta < melhor) {
+            melhor = d + dOposta;
+            encontro = u;
+        }
+
+        for (int i = ponteiros[u]; i < ponteiros[u + 1]; ++i) {
+            const ArestaCH& a = arestas[i];
+            double nd = d + a.peso;
+            if (nd < lerDist(dist, marca, a.alvo)) {
+                dist[a.alvo] = nd;
+                pai[a.alvo] = u;
+                marca[a.alvo] = tick;
+                fila.push({ nd, a.alvo });
+            }
+        }
+    };
+
+    while (!filaIda.empty() || !filaVolta.empty()) {
+        // Uma busca pode parar quando sua menor chave já não melhora o resultado
+        bool idaAtiva = !filaIda.empty() && filaIda.top().first < melhor;
+        bool voltaAtiva = !filaVolta.empty() && filaVolta.top().first < melhor;
+        if (!idaAtiva && !voltaAtiva) break;
+
+        if (idaAtiva && (!voltaAtiva || filaIda.top().first <= filaVolta.top().first)) {
+            passo(filaIda, distIda, paiIda, marcaIda, distVolta, marcaVolta, ponteirosSubida, arestasSubida);
+        }
+        else {
+            passo(filaVolta, distVolta, paiVolta, marcaVolta, distIda, marcaIda, ponteirosDescida, arestasDescida);
+        }
+    }
+
+    if (encontro == -1) return resultado; // Inalcançável
+    resultado.distancia = melhor;
+
+    // Sequência de vértices da hierarquia: origem -> ... -> encontro -> ... -> destino
+    std::vector<int> trechoIda;
+    for (int v = encontro; v != 0; v = paiIda[v]) trechoIda.push_back(v);
+    std::reverse(trechoIda.begin(), trechoIda.end());
+
+    std::vector<int>& caminho = resultado.caminho;
+    caminho.push_back(origem);
+    for (size_t i = 0; i + 1 < trechoIda.size(); ++i) {
+        int de = trechoIda[i], para = trechoIda[i + 1];
+        const ArestaCH* a = buscarAresta(ponteirosSubida, arestasSubida, de, para);
+        desempacotar(de, para, a->meio, caminho);
+    }
+    for (int v = encontro; v != destino; v = paiVolta[v]) {
+        int para = paiVolta[v];
+        // A aresta v -> para está guardada na lista de descida de 'para'
+        const ArestaCH* a = buscarAresta(ponteirosDescida, arestasDescida, para, v);
+        desempacotar(v, para, a->meio, caminho);
+    }
+    return resultado;
+}
+
+const ContractionHierarchies::ArestaCH* ContractionHierarchies::buscarAresta(
+    const std::vector<int>& ponteiros, const std::vector<ArestaCH>& arestas, int dono, int alvo) const {
+    auto inicio = arestas.begin() + ponteiros[dono];
+    auto fim = arestas.begin() + ponteiros[dono + 1];
+    auto it = std::lower_bound(inicio, fim, alvo, [](const ArestaCH& a, int x) { return a.alvo < x; });
+    if (it == fim || it->alvo != alvo) {
+        throw std::runtime_error("Indice CH inconsistente ao desempacotar caminho.");
+    }
+    return &*it;
+}
+
+/**
+ * @brief Acrescenta ao caminho os vértices da aresta de -> para (sem incluir 'de').
+ * @details Um atalho de -> para com vértice do meio m substitui de -> m -> para.
+ * Como m foi contraído antes dos dois, a aresta de -> m está na lista de descida
+ * de m e a aresta m -> para está na lista de subida de m.
+ */
+void ContractionHierarchies::desempacotar(int de, int para, int meio, std::vector<int>& caminho) const {
+    if (meio == -1) {
+        caminho.push_back(para);
+        return;
+    }
+    const ArestaCH* primeira = buscarAresta(ponteirosDescida, arestasDescida, meio, de);
+    desempacotar(de, meio, primeira->meio, caminho);
+    const ArestaCH* segunda = buscarAresta(ponteirosSubida, arestasSubida, meio, para);
+    desempacotar(meio, para, segunda->meio, caminho);
+}
+
+void ContractionHierarchies::salvarIndice(const std::string& caminhoArquivo) const {
+    if (!estaPronto()) {
+        throw std::runtime_error("Indice CH vazio: execute preprocessar antes de salvar.");
+    }
+    std::ofstream arquivo(caminhoArquivo, std::ios::binary);
+    if (!arquivo.is_open()) {
+        throw std::runtime_error("Nao foi possivel criar o arquivo de indice: " + caminhoArquivo);
+    }
+
+    // Formato: assinatura, versão, V, número de atalhos e os vetores (tamanho + dados).
+    // Os dados são gravados na ordem de bytes nativa da máquina.
+    std::int32_t n = numeroDeVertices;
+    std::int64_t atalhos = numeroDeAtalhos;
+    arquivo.write(ASSINATURA_INDICE_CH, sizeof(ASSINATURA_INDICE_CH));
+    arquivo.write(reinterpret_cast<const char*>(&VERSAO_INDICE_CH), sizeof(VERSAO_INDICE_CH));
+    arquivo.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    arquivo.write(reinterpret_cast<const char*>(&atalhos), sizeof(atalhos));
+    escreverVetor(arquivo, nivel);
+    escreverVetor(arquivo, ponteirosSubida);
+    escreverVetor(arquivo, arestasSubida);
+    escreverVetor(arquivo, ponteirosDescida);
+    escreverVetor(arquivo, arestasDescida);
+
+    if (!arquivo) {
+        throw std::runtime_error("Erro ao escrever o arquivo de indice: " + caminhoArquivo);
+    }
+}
+
+void ContractionHierarchies::carregarIndice(const std::string& caminhoArquivo) {
+    std::ifstream arquivo(caminhoArquivo, std::ios::binary);
+    if (!arquivo.is_open()) {
+        throw std::runtime_error("Nao foi possivel abrir o arquivo de indice: " + caminhoArquivo);
+    }
+
+    arquivo.seekg(0, std::ios::end);
+    std::uint64_t restante = static_cast<std::uint64_t>(arquivo.tellg());
+    arquivo.seekg(0, std::ios::beg);
+
+    char assinatura[sizeof(ASSINATURA_INDICE_CH)];
+    std::uint32_t versao = 0;
+    std::int32_t n = 0;
+    std::int64_t atalhos = 0;
+    arquivo.read(assinatura, sizeof(assinatura));
+    arquivo.read(reinterpret_cast<char*>(&versao), sizeof(versao));
+    arquivo.read(reinterpret_cast<char*>(&n), sizeof(n));
+    arquivo.read(reinterpret_cast<char*>(&atalhos), sizeof(atalhos));
+    const std::uint64_t tamanhoCabecalho = sizeof(assinatura) + sizeof(versao) + sizeof(n) + sizeof(atalhos);
+    if (!arquivo || restante < tamanhoCabecalho || !std::equal(assinatura, assinatura + sizeof(assinatura), ASSINATURA_INDICE_CH)
+        || versao != VERSAO_INDICE_CH || n <= 0 || atalhos < 0) {
+        throw std::runtime_error("Arquivo de indice CH invalido: " + caminhoArquivo);
+    }
+    restante -= tamanhoCabecalho;
+
+    // Lê tudo em vetores locais: se o arquivo estiver truncado ou corrompido, o índice
+    // atual (se houver) continua intacto.
+    std::vector<int> novoNivel, novosPonteirosSubida, novosPonteirosDescida;
+    std::vector<ArestaCH> novasArestasSubida, novasArestasDescida;
+    lerVetor(arquivo, novoNivel, restante);
+    lerVetor(arquivo, novosPonteirosSubida, restante);
+    lerVetor(arquivo, novasArestasSubida, restante);
+    lerVetor(arquivo, novosPonteirosDescida, restante);
+    lerVetor(arquivo, novasArestasDescida, restante);
+
+    // Valida tudo o que a consulta e o desempacotamento usam como índice. Em particular,
+    // toda aresta sobe de nível e o vértice do meio de um atalho tem nível menor que os
+    // dois extremos, o que garante que desempacotar termina.
+    auto inconsistente = [&]() {
+        return std::runtime_error("Arquivo de indice CH inconsistente: " + caminhoArquivo);
+    };
+    if (novoNivel.size() != static_cast<size_t>(n) + 1) throw inconsistente();
+    for (int v = 1; v <= n; ++v) {
+        if (novoNivel[v] < 0 || novoNivel[v] >= n) throw inconsistente();
+    }
+    auto validarCSR = [&](const std::vector<int>& ponteiros, const std::vector<ArestaCH>& arestas) {
+        if (ponteiros.size() != static_cast<size_t>(n) + 2 || ponteiros[0] != 0 || ponteiros[1] != 0
+            || static_cast<size_t>(ponteiros[n + 1]) != arestas.size()) {
+            throw inconsistente();
+        }
+        for (int v = 1; v <= n; ++v) {
+            if (ponteiros[v + 1] < ponteiros[v]) throw inconsistente();
+            for (int i = ponteiros[v]; i < ponteiros[v + 1]; ++i) {
+                const ArestaCH& a = arestas[i];
+                if (a.alvo < 1 || a.alvo > n || novoNivel[a.alvo] <= novoNivel[v]
+                    || (i > ponteiros[v] && arestas[i - 1].alvo >= a.alvo) // buscarAresta usa busca binária
+                    || !pesoValido(a.peso)) {
+                    throw inconsistente();
+                }
+                if (a.meio != -1 && (a.meio < 1 || a.meio > n || novoNivel[a.meio] >= novoNivel[v])) throw inconsistente();
+            }
+        }
+    };
+    validarCSR(novosPonteirosSubida, novasArestasSubida);
+    validarCSR(novosPonteirosDescida, novasArestasDescida);
+
+    // As duas metades de cada atalho precisam existir nas listas do vértice do meio.
+    auto existe = [](const std::vector<int>& ponteiros, const std::vector<ArestaCH>& arestas, int dono, int alvo) {
+        auto inicio = arestas.begin() + ponteiros[dono];
+        auto fim = arestas.begin() + ponteiros[dono + 1];
+        auto it = std::lower_bound(inicio, fim, alvo, [](const ArestaCH& a, int x) { return a.alvo < x; });
+        return it != fim && it->alvo == alvo;
+    };
+    for (int v = 1; v <= n; ++v) {
+        // Subida de v: atalho v -> alvo = v -> meio -> alvo
+        for (int i = novosPonteirosSubida[v]; i < novosPonteirosSubida[v + 1]; ++i) {
+            const ArestaCH& a = novasArestasSubida[i];
+            if (a.meio != -1 && (!existe(novosPonteirosDescida, novasArestasDescida, a.meio, v)
+                                 || !existe(novosPonteirosSubida, novasArestasSubida, a.meio, a.alvo))) {
+                throw inconsistente();
+            }
+        }
+        // Descida de v: atalho alvo -> v = alvo -> meio -> v
+        for (int i = novosPonteirosDescida[v]; i < novosPonteirosDescida[v + 1]; ++i) {
+            const ArestaCH& a = novasArestasDescida[i];
+            if (a.meio != -1 && (!existe(novosPonteirosDescida, novasArestasDescida, a.meio, a.alvo)
+                                 || !existe(novosPonteirosSubida, novasArestasSubida, a.meio, v))) {
+                throw inconsistente();
+            }
+        }
+    }
+
+    nivel.swap(novoNivel);
+    ponteirosSubida.swap(novosPonteirosSubida);
+    arestasSubida.swap(novasArestasSubida);
+    ponteirosDescida.swap(novosPonteirosDescida);
+    arestasDescida.swap(novasArestasDescida);
+    numeroDeVertices = n;
+    numeroDeAtalhos = atalhos;
+    prepararBuffersConsulta();
+}
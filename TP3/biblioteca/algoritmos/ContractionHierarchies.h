@@ -0,0 +1,130 @@
+/**
+ * @file ContractionHierarchies.h
+ * @brief Declaração da classe ContractionHierarchies para consultas ponto-a-ponto rápidas.
+ * * Contraction Hierarchies (CH):
+ * - Pré-processamento: os vértices são contraídos um a um, em ordem de "importância"
+ *   (heurística de diferença de arestas). Ao contrair v, são criados atalhos u -> w
+ *   sempre que o caminho u -> v -> w for o único caminho mínimo entre u e w
+ *   (verificado por buscas de testemunha limitadas).
+ * - Consulta: Dijkstra bidirecional que só sobe na hierarquia (para vértices de nível
+ *   maior), visitando poucas centenas de vértices mesmo em grafos grandes.
+ * - Os atalhos guardam o vértice contraído do meio, permitindo desempacotar o caminho
+ *   original completo.
+ * - Requer pesos não negativos (mesma restrição do Dijkstra).
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+
+ // Forward declaration da classe principal de grafos do TP3
+class GrafoPesado;
+
+/**
+ * @brief Estrutura que armazena o resultado de uma consulta origem -> destino.
+ */
+struct ResultadoConsultaCH {
+    double distancia;            ///< Distância mínima (infinito se o destino for inalcançável)
+    std::vector<int> caminho;    ///< Vértices do caminho mínimo, de origem a destino (vazio se inalcançável)
+};
+
+/**
+ * @class ContractionHierarchies
+ * @brief Índice de Contraction Hierarchies construído a partir de um GrafoPesado.
+ * @details O índice pode ser construído (preprocessar), salvo em arquivo binário
+ * (salvarIndice) e recarregado depois (carregarIndice) sem o grafo original.
+ * As consultas reutilizam buffers internos: um mesmo objeto não deve ser
+ * consultado por várias threads ao mesmo tempo.
+ */
+class ContractionHierarchies {
+public:
+    /**
+     * @brief Constrói a hierarquia (ordenação dos vértices e criação dos atalhos).
+     * @details A contração é feita em rodadas: cada rodada contrai juntos os vértices
+     * de prioridade mínima entre os vizinhos (um conjunto independente). As buscas de
+     * testemunha desses vértices, o cálculo inicial das prioridades e a atualização das
+     * prioridades dos vizinhos rodam em paralelo; só a edição das listas é sequencial.
+     * O índice gerado é o mesmo para qualquer número de threads.
+     * @param grafo O grafo ponderado (direcionado ou não).
+     * @param numThreads Número de threads (<= 0 usa o padrão).
+     * @throws std::runtime_error se o grafo contiver pesos negativos.
+     */
+    void preprocessar(const GrafoPesado& grafo, int numThreads = 0);
+
+    /**
+     * @brief Calcula a distância e o caminho mínimo entre dois vértices.
+     * @param origem Vértice de origem (indexado a partir de 1).
+     * @param destino Vértice de destino (indexado a partir de 1).
+     * @return ResultadoConsultaCH com a distância e o caminho já desempacotado.
+     * @throws std::runtime_error se o índice não estiver pronto ou os vértices forem inválidos.
+     */
+    ResultadoConsultaCH consultar(int origem, int destino) const;
+
+    /**
+     * @brief Salva o índice em um arquivo binário.
+     * @param caminhoArquivo Caminho do arquivo de saída.
+     * @throws std::runtime_error se o índice não estiver pronto ou o arquivo não puder ser escrito.
+     */
+    void salvarIndice(const std::string& caminhoArquivo) const;
+
+    /**
+     * @brief Carrega um índice salvo anteriormente por salvarIndice.
+     * @details Todo o conteúdo é validado (ponteiros crescentes, vértices no intervalo,
+     * arestas que sobem de nível) antes de substituir o índice atual.
+     * @param caminhoArquivo Caminho do arquivo de entrada.
+     * @throws std::runtime_error se o arquivo não existir, estiver truncado ou tiver
+     * conteúdo inválido; nesse caso o índice atual não é alterado.
+     */
+    void carregarIndice(const std::string& caminhoArquivo);
+
+    /**
+     * @brief Informa se o índice já foi construído ou carregado.
+     */
+    bool estaPronto() const;
+
+    /**
+     * @brief Obtém o número de vértices do grafo indexado.
+     */
+    int obterNumeroVertices() const;
+
+    /**
+     * @brief Obtém o número de atalhos criados durante o pré-processamento.
+     */
+    long long obterNumeroAtalhos() const;
+
+private:
+    /**
+     * @brief Aresta da hierarquia (original ou atalho).
+     * @details 'meio' é o vértice contraído que o atalho substitui (-1 para aresta original).
+     */
+    struct ArestaCH {
+        int alvo;
+        double peso;
+        int meio;
+    };
+
+    const ArestaCH* buscarAresta(const std::vector<int>& ponteiros, const std::vector<ArestaCH>& arestas, int dono, int alvo) const;
+    void desempacotar(int de, int para, int meio, std::vector<int>& caminho) const;
+    void prepararBuffersConsulta() const;
+
+    int numeroDeVertices = 0;
+    long long numeroDeAtalhos = 0;
+
+    std::vector<int> nivel; ///< nivel[v]: posição de v na ordem de contração
+
+    // Grafo de subida (arestas v -> w com nivel[w] > nivel[v]) em formato CSR
+    std::vector<int> ponteirosSubida;
+    std::vector<ArestaCH> arestasSubida;
+
+    // Grafo de descida invertido: para cada v, arestas originais u -> v com nivel[u] > nivel[v],
+    // armazenadas como (alvo = u). Usado pela busca reversa a partir do destino.
+    std::vector<int> ponteirosDescida;
+    std::vector<ArestaCH> arestasDescida;
+
+    // Buffers reutilizados entre consultas (marcação por "tick", como no BFS do TP1)
+    mutable std::vector<double> distIda, distVolta;
+    mutable std::vector<int> paiIda, paiVolta;
+    mutable std::vector<int> marcaIda, marcaVolta;
+    mutable int tickConsulta = 0;
+};
@@ -6,6 +6,8 @@
 #include <queue>     // Para std::priority_queue
 #include <utility>   // Para std::pair
 
+#include "../../../comum/ContagemOperacoes.h"
+
 // Forward declaration da nossa interface de grafo pesado
 class GrafoPesado;
 
@@ -16,6 +18,18 @@ class GrafoPesado;
 struct ResultadoDijkstra {
     std::vector<double> dist; // dist[v] = distância mínima da origem até v
     std::vector<int> pai;     // pai[v] = predecessor de v no caminho mínimo
+    ContadoresOperacoes operacoes; // Preenchido só com a política ComContagem
+};
+
+/**
+ * @struct EspacoTrabalhoDijkstra
+ * @brief Buffers reutilizáveis entre execuções de Dijkstra (resultado e heap).
+ * @details Evita realocar O(V) memória a cada origem quando muitas execuções são
+ * feitas em sequência (ex: uma thread processando um lote de origens).
+ */
+struct EspacoTrabalhoDijkstra {
+    ResultadoDijkstra resultado;                 // Sobrescrito a cada execução
+    std::vector<std::pair<double, int>> heap;    // Armazenamento da fila de prioridade
 };
 
 /**
@@ -29,18 +43,40 @@ public:
      * @details Complexidade: O(E log V) com heap binário.
      * @param grafo O grafo ponderado (constante).
      * @param origem O vértice inicial da busca (indexado a partir de 1).
+     * @tparam Contagem SemContagem (padrão) ou ComContagem. Contagens: vértices finalizados,
+     * arestas examinadas, relaxamentos, inserções no heap e entradas obsoletas descartadas.
      * @return Um struct ResultadoDijkstra com as distâncias e predecessores.
      * @throws std::runtime_error se o grafo contiver pesos negativos.
      */
+    template <class Contagem = SemContagem>
     ResultadoDijkstra executarHeap(const GrafoPesado& grafo, int origem);
 
+    /**
+     * @brief Executa o Dijkstra (Heap) escrevendo o resultado no espaço de trabalho informado.
+     * @details Mesmo algoritmo de executarHeap, mas reaproveita os vetores de 'espaco'
+     * (o resultado fica em espaco.resultado até a próxima execução).
+     * @param grafo O grafo ponderado (constante).
+     * @param origem O vértice inicial da busca (indexado a partir de 1).
+     * @param espaco Buffers reutilizáveis (um por thread).
+     * @tparam Contagem SemContagem (padrão) ou ComContagem (contagens em espaco.resultado.operacoes).
+     * @throws std::runtime_error se o grafo contiver pesos negativos.
+     */
+    template <class Contagem = SemContagem>
+    void executarHeap(const GrafoPesado& grafo, int origem, EspacoTrabalhoDijkstra& espaco);
+
     /**
      * @brief Executa o algoritmo de Dijkstra usando um Vetor para busca do mínimo.
-     * @details Complexidade: O(V^2 + E) = O(V^2) em grafos densos.
+     * @details As chaves ficam em um vetor contíguo dividido em blocos de ~sqrt(V) posições,
+     * com o mínimo de cada bloco guardado à parte: cada extração varre os mínimos dos blocos
+     * e um único bloco (busca do mínimo com AVX2/AVX-512 quando disponível).
+     * Complexidade: O(V * sqrt(V) + E), sem heap; compete com o Heap em grafos densos.
      * @param grafo O grafo ponderado (constante).
      * @param origem O vértice inicial da busca (indexado a partir de 1).
+     * @tparam Contagem SemContagem (padrão) ou ComContagem. Contagens: vértices extraídos
+     * (finalizados), arestas examinadas e relaxamentos (não há heap).
      * @return Um struct ResultadoDijkstra com as distâncias e predecessores.
      * @throws std::runtime_error se o grafo contiver pesos negativos.
      */
+    template <class Contagem = SemContagem>
     ResultadoDijkstra executarVetor(const GrafoPesado& grafo, int origem);
 };
\ No newline at end of file
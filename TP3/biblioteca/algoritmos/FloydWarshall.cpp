@@ -0,0 +1,272 @@
+/**
+ * @file FloydWarshall.cpp
+ * @brief Implementação do Floyd-Warshall em blocos (com núcleo AVX2 opcional).
+ */
+
+#include "FloydWarshall.h"
+#include "../interface/GrafoPesado.h"
+#include "../../../comum/Paralelo.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+static const float INFINITO_FW = std::numeric_limits<float>::infinity();
+
+// Lado do bloco: 64 x 64 floats = 16 KB (três blocos por atualização cabem na L2)
+static const int TAMANHO_BLOCO = 64;
+
+namespace {
+
+    /**
+     * @brief C[i][j] = min(C[i][j], A[i][kk] + B[kk][j]) com kk no laço externo.
+     * @details Usado nas fases 1 e 2, em que C coincide com A ou com B: com kk externo
+     * a ordem é a mesma do Floyd-Warshall clássico, então a sobreposição é segura.
+     */
+    void atualizarBlocoDependente(float* C, const float* A, const float* B, size_t ld) {
+        for (int kk = 0; kk < TAMANHO_BLOCO; ++kk) {
+            const float* linhaB = B + kk * ld;
+            for (int i = 0; i < TAMANHO_BLOCO; ++i) {
+                const float aik = A[i * ld + kk];
+                float* linhaC = C + i * ld;
+                for (int j = 0; j < TAMANHO_BLOCO; ++j) {
+                    linhaC[j] = std::min(linhaC[j], aik + linhaB[j]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Produto min-plus C = min(C, A x B) para blocos distintos (fase 3).
+     * @details Como C não se sobrepõe a A nem a B, a linha i de C pode ficar em
+     * registradores enquanto kk percorre o bloco (8 registradores AVX2 de 8 floats).
+     */
+    void atualizarBlocoIndependente(float* C, const float* A, const float* B, size_t ld) {
+#if defined(__AVX2__)
+        const int vetoresPorLinha = TAMANHO_BLOCO / 8;
+        for (int i = 0; i < TAMANHO_BLOCO; ++i) {
+            float* linhaC = C + i * ld;
+            const float* linhaA = A + i * ld;
+            __m256 c[vetoresPorLinha];
+            for (int t = 0; t < vetoresPorLinha; ++t) c[t] = _mm256_loadu_ps(linhaC + 8 * t);
+            for (int kk = 0; kk < TAMANHO_BLOCO; ++kk) {
+                const __m256 aik = _mm256_set1_ps(linhaA[kk]);
+                const float* linhaB = B + kk * ld;
+                for (int t = 0; t < vetoresPorLinha; ++t) {
+                    c[t] = _mm256_min_ps(c[t], _mm256_add_ps(aik, _mm256_loadu_ps(linhaB + 8 * t)));
+                }
+            }
+            for (int t = 0; t < vetoresPorLinha; ++t) _mm256_storeu_ps(linhaC + 8 * t, c[t]);
+        }
+#else
+        for (int i = 0; i < TAMANHO_BLOCO; ++i) {
+            float* linhaC = C + i * ld;
+            for (int kk = 0; kk < TAMANHO_BLOCO; ++kk) {
+                const float aik = A[i * ld + kk];
+                const float* linhaB = B + kk * ld;
+                for (int j = 0; j < TAMANHO_BLOCO; ++j) {
+                    linhaC[j] = std::min(linhaC[j], aik + linhaB[j]);
+                }
+            }
+        }
+#endif
+    }
+
+    // Folga aceita, em unidades de arredondamento do float, para uma aresta ser "justa"
+    // (d(i,u) + w == d(i,v)). Com pesos inteiros as distâncias em float são exatas e a
+    // folga de uma aresta que não está em caminho mínimo é ao menos 1, bem acima do limite.
+    const double ULPS_JUSTA = 2.0;
+
+    // Testa os bits do expoente: com -ffast-math (Release) comparações com infinito
+    // podem ser eliminadas pelo compilador.
+    bool finito(float d) {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return ((bits >> 23) & 0xFF) != 0xFF;
+    }
+
+} // namespace
+
+void FloydWarshall::executar(const GrafoPesado& grafo, bool comPredecessores, int numThreads) {
+    const int n = grafo.obterNumeroVertices();
+    const int numBlocos = (n + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO;
+    const size_t ld = static_cast<size_t>(numBlocos) * TAMANHO_BLOCO;
+
+    numeroDeVertices = n;
+    dimensao = static_cast<int>(ld);
+    possuiCicloNegativo = false;
+
+    // 1. Matriz inicial: 0 na diagonal, menor peso entre arestas paralelas, infinito no resto
+    // (as linhas/colunas de preenchimento ficam em infinito e não afetam os mínimos)
+    distancias.assign(ld * ld, INFINITO_FW);
+    predecessores.clear();
+    for (int i = 0; i < n; ++i) distancias[i * ld + i] = 0.0f;
+    for (int u = 1; u <= n; ++u) {
+        grafo.paraCadaVizinhoComPeso(u, [&](int v, double peso) {
+            float& d = distancias[(u - 1) * ld + (v - 1)];
+            d = std::min(d, static_cast<float>(peso));
+        });
+    }
+
+    float* D = distancias.data();
+    auto bloco = [&](int bi, int bj) { return static_cast<size_t>(bi) * TAMANHO_BLOCO * ld + static_cast<size_t>(bj) * TAMANHO_BLOCO; };
+
+    // 2. Fases por bloco diagonal
+    for (int kb = 0; kb < numBlocos; ++kb) {
+        const size_t diag = bloco(kb, kb);
+
+        // Fase 1: fecha o bloco diagonal
+        atualizarBlocoDependente(D + diag, D + diag, D + diag, ld);
+
+        // Fase 2: linha (kb, j) e coluna (i, kb) de blocos, em paralelo
+        const int outros = numBlocos - 1;
+        executarEmParalelo(2 * outros, numThreads, [&](int tarefa, int) {
+            int indice = tarefa % outros;
+            int b = (indice < kb) ? indice : indice + 1;
+            if (tarefa < outros) {
+                const size_t alvo = bloco(kb, b);
+                atualizarBlocoDependente(D + alvo, D + diag, D + alvo, ld);
+            }
+            else {
+                const size_t alvo = bloco(b, kb);
+                atualizarBlocoDependente(D + alvo, D + alvo, D + diag, ld);
+            }
+        });
+
+        // Fase 3: todos os demais blocos (independentes entre si)
+        executarEmParalelo(outros * outros, numThreads, [&](int tarefa, int) {
+            int bi = tarefa / outros, bj = tarefa % outros;
+            if (bi >= kb) ++bi;
+            if (bj >= kb) ++bj;
+            atualizarBlocoIndependente(D + bloco(bi, bj), D + bloco(bi, kb), D + bloco(kb, bj), ld);
+        });
+    }
+
+    // 3. Ciclo negativo: algum vértice alcança a si mesmo com custo negativo
+    for (int i = 0; i < n; ++i) {
+        if (distancias[i * ld + i] < 0.0f) {
+            possuiCicloNegativo = true;
+            break;
+        }
+    }
+
+    // 4. Predecessores: para cada origem i, BFS pelas arestas justas (d(i,u) + w == d(i,v)).
+    // Copiar o predecessor durante as fases (P[i][j] = P[k][j]) pode formar laços quando
+    // há ciclos de peso zero, porque os blocos misturam a ordem dos k; a BFS sempre
+    // produz uma árvore. A folga d(i,u) + w - d(i,v) é calculada em double, com o peso
+    // original, e só tolera o arredondamento do float. Se a BFS parar antes de alcançar
+    // todos os vértices finitos (arredondamento acumulado em pesos não inteiros), o
+    // vértice pendente de menor folga entra pela sua melhor aresta e a BFS continua.
+    // Custa O(V * E): em grafos densos (E ~ V^2) é da mesma ordem das fases.
+    if (comPredecessores && !possuiCicloNegativo) {
+        std::vector<int> ponteiros(n + 1, 0), vizinhos;
+        std::vector<double> pesos;
+        for (int u = 1; u <= n; ++u) {
+            grafo.paraCadaVizinhoComPeso(u, [&](int v, double peso) {
+                vizinhos.push_back(v - 1);
+                pesos.push_back(peso);
+            });
+            ponteiros[u] = static_cast<int>(vizinhos.size());
+        }
+
+        predecessores.assign(static_cast<size_t>(n) * ld, -1);
+        const int threads = numThreads > 0 ? numThreads : obterNumeroThreadsPadrao();
+        std::vector<std::vector<double>> melhorFolgaPorThread(threads);
+        std::vector<std::vector<int>> candidatoPorThread(threads);
+        executarEmParalelo(n, threads, [&](int i, int idThread) {
+            const float* linhaD = D + static_cast<size_t>(i) * ld;
+            int* linhaP = predecessores.data() + static_cast<size_t>(i) * ld;
+            std::vector<double>& melhorFolga = melhorFolgaPorThread[idThread];
+            std::vector<int>& candidato = candidatoPorThread[idThread];
+            if (melhorFolga.empty()) {
+                melhorFolga.assign(n, std::numeric_limits<double>::max());
+                candidato.assign(n, -1);
+            }
+            std::vector<int> fila, tocados;
+            fila.reserve(64);
+            linhaP[i] = i;
+            fila.push_back(i);
+            size_t frente = 0;
+            while (true) {
+                for (; frente < fila.size(); ++frente) {
+                    int u = fila[frente];
+                    const double du = linhaD[u];
+                    for (int e = ponteiros[u]; e < ponteiros[u + 1]; ++e) {
+                        int v = vizinhos[e];
+                        if (linhaP[v] != -1 || !finito(linhaD[v])) continue;
+                        const double dv = linhaD[v];
+                        const double folga = du + pesos[e] - dv;
+                        const double limite = ULPS_JUSTA * std::numeric_limits<float>::epsilon()
+                            * (std::abs(du) + std::abs(pesos[e]) + std::abs(dv));
+                        if (folga <= limite) {
+                            linhaP[v] = u;
+                            fila.push_back(v);
+                        }
+                        else if (folga < melhorFolga[v]) {
+                            if (candidato[v] == -1) tocados.push_back(v);
+                            melhorFolga[v] = folga;
+                            candidato[v] = u;
+                        }
+                    }
+                }
+                int escolhido = -1;
+                for (int v : tocados) {
+                    if (linhaP[v] == -1 && (escolhido == -1 || melhorFolga[v] < melhorFolga[escolhido])) escolhido = v;
+                }
+                if (escolhido == -1) break;
+                linhaP[escolhido] = candidato[escolhido];
+                fila.push_back(escolhido);
+            }
+            for (int v : tocados) {
+                melhorFolga[v] = std::numeric_limits<double>::max();
+                candidato[v] = -1;
+            }
+        });
+    }
+}
+
+double FloydWarshall::obterDistancia(int u, int v) const {
+    if (distancias.empty()) {
+        throw std::runtime_error("FloydWarshall: executar() deve ser chamado antes das consultas.");
+    }
+    if (u <= 0 || u > numeroDeVertices || v <= 0 || v > numeroDeVertices) {
+        throw std::runtime_error("Vertice invalido em FloydWarshall.");
+    }
+    return distancias[static_cast<size_t>(u - 1) * dimensao + (v - 1)];
+}
+
+std::vector<int> FloydWarshall::obterCaminho(int u, int v) const {
+    if (predecessores.empty()) {
+        throw std::runtime_error("FloydWarshall: os predecessores nao foram calculados (use comPredecessores = true).");
+    }
+    if (possuiCicloNegativo) {
+        throw std::runtime_error("FloydWarshall: caminhos indefinidos, o grafo contem ciclo negativo.");
+    }
+    if (!finito(static_cast<float>(obterDistancia(u, v)))) return {};
+
+    const size_t linha = static_cast<size_t>(u - 1) * dimensao;
+    std::vector<int> caminho;
+    int x = v - 1;
+    caminho.push_back(v);
+    while (x != u - 1) {
+        x = predecessores[linha + x];
+        if (x < 0 || static_cast<int>(caminho.size()) > numeroDeVertices) return {}; // Proteção
+        caminho.push_back(x + 1);
+    }
+    std::reverse(caminho.begin(), caminho.end());
+    return caminho;
+}
+
+bool FloydWarshall::temCicloNegativo() const {
+    return possuiCicloNegativo;
+}
+
+int FloydWarshall::obterNumeroVertices() const {
+    return numeroDeVertices;
+}
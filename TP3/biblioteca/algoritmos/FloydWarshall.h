@@ -0,0 +1,71 @@
+/**
+ * @file FloydWarshall.h
+ * @brief Declaração da classe FloydWarshall (caminhos mínimos entre todos os pares, em blocos).
+ * * O algoritmo de Floyd-Warshall em blocos:
+ * - As distâncias ficam em uma matriz contígua V x V (float, preenchida até múltiplo do bloco).
+ * - Para cada bloco diagonal k: (1) fecha o bloco (k,k); (2) atualiza a linha e a coluna
+ *   de blocos k usando o bloco diagonal; (3) atualiza todos os outros blocos com o
+ *   produto min-plus (i,k) x (k,j). As fases 2 e 3 são paralelas entre blocos.
+ * - Cada bloco (64 x 64 floats = 16 KB) cabe na L1/L2; o núcleo da fase 3 usa AVX2
+ *   quando disponível (8 floats por instrução) e um laço escalar caso contrário.
+ * - Suporta pesos negativos; ciclos negativos são detectados pela diagonal.
+ * - Complexidade: O(V^3) tempo e O(V^2) memória (4 bytes por par, +4 com predecessores).
+ */
+
+#pragma once
+
+#include <vector>
+
+ // Forward declaration da classe principal de grafos do TP3
+class GrafoPesado;
+
+/**
+ * @class FloydWarshall
+ * @brief Matriz de distâncias entre todos os pares, calculada com Floyd-Warshall em blocos.
+ * @details Indicado para grafos pequenos e densos (alguns milhares de vértices), onde V
+ * execuções de Dijkstra sobre o CSR perdem para o acesso sequencial à matriz.
+ * As distâncias são armazenadas em float: metade da memória de double e o dobro de
+ * elementos por instrução SIMD (inteiros são exatos até 2^24).
+ */
+class FloydWarshall {
+public:
+    /**
+     * @brief Calcula as distâncias entre todos os pares de vértices.
+     * @param grafo O grafo ponderado (direcionado ou não; pesos negativos permitidos).
+     * @param comPredecessores Se verdadeiro, guarda também a matriz de predecessores
+     * (necessária para obterCaminho).
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     */
+    void executar(const GrafoPesado& grafo, bool comPredecessores = false, int numThreads = 0);
+
+    /**
+     * @brief Obtém a distância mínima de u até v (infinito se inalcançável).
+     * @throws std::runtime_error se executar() não foi chamado ou os vértices forem inválidos.
+     */
+    double obterDistancia(int u, int v) const;
+
+    /**
+     * @brief Reconstrói o caminho mínimo de u até v.
+     * @return Vértices de u até v (vazio se inalcançável).
+     * @throws std::runtime_error se os predecessores não foram calculados ou houver ciclo negativo.
+     */
+    std::vector<int> obterCaminho(int u, int v) const;
+
+    /**
+     * @brief Informa se o grafo contém ciclo negativo (alguma distância d(v,v) < 0).
+     * @details Nesse caso as distâncias que passam pelo ciclo não têm significado.
+     */
+    bool temCicloNegativo() const;
+
+    /**
+     * @brief Obtém o número de vértices da última execução.
+     */
+    int obterNumeroVertices() const;
+
+private:
+    int numeroDeVertices = 0;
+    int dimensao = 0;                 ///< V arredondado para múltiplo do tamanho do bloco
+    bool possuiCicloNegativo = false;
+    std::vector<float> distancias;    ///< Matriz dimensao x dimensao (linha-major, índices 0-based)
+    std::vector<int> predecessores;   ///< predecessores[i][j]: vértice anterior a j no caminho i -> j (-1 se não houver)
+};
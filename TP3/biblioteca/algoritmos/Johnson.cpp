@@ -0,0 +1,203 @@
+/**
+ * @file Johnson.cpp
+ * @brief Implementação do algoritmo de Johnson (potenciais, reponderação e Dijkstra em paralelo).
+ */
+
+#include "Johnson.h"
+#include "BellmanFord.h"
+#include "../interface/GrafoPesado.h"
+#include "../../../comum/Paralelo.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+static const double INFINITO_JOHNSON = std::numeric_limits<double>::infinity();
+
+// Identificação do arquivo binário de distâncias
+static const char ASSINATURA_ARQUIVO[4] = { 'G', 'P', 'J', 'D' };
+static const int32_t VERSAO_ARQUIVO = 1;
+
+void Johnson::preparar(const GrafoPesado& grafo) {
+    const int n = grafo.obterNumeroVertices();
+
+    // 1. Potenciais: Bellman-Ford (com fila) a partir da super-origem virtual
+    BellmanFord bf;
+    ResultadoBellmanFord resultadoBF = bf.executarSuperOrigem(grafo);
+    if (resultadoBF.temCicloNegativo) {
+        std::string ciclo;
+        for (int v : resultadoBF.cicloNegativo) ciclo += std::to_string(v) + " -> ";
+        if (!resultadoBF.cicloNegativo.empty()) ciclo += std::to_string(resultadoBF.cicloNegativo.front());
+        throw std::runtime_error("Johnson nao se aplica: o grafo contem ciclo negativo (" + ciclo + ").");
+    }
+    potencial = std::move(resultadoBF.dist);
+    numeroDeVertices = n;
+
+    // 2. Cópia CSR reponderada: w'(u,v) = w(u,v) + h(u) - h(v)
+    ponteirosInicio.assign(n + 2, 0);
+    listaVizinhos.clear();
+    listaPesos.clear();
+    // Entradas do CSR: em grafos não direcionados cada aresta aparece nos dois sentidos
+    const size_t entradas = static_cast<size_t>(grafo.obterNumeroArestas()) * (grafo.consultaDirecionado() ? 1 : 2);
+    listaVizinhos.reserve(entradas);
+    listaPesos.reserve(entradas);
+    for (int u = 1; u <= n; ++u) {
+        grafo.paraCadaVizinhoComPeso(u, [&](int v, double peso) {
+            // Em ponto flutuante a soma pode ficar levemente negativa: Dijkstra exige >= 0
+            listaVizinhos.push_back(v);
+            listaPesos.push_back(std::max(0.0, peso + potencial[u] - potencial[v]));
+        });
+        ponteirosInicio[u + 1] = static_cast<int>(listaVizinhos.size());
+    }
+}
+
+void Johnson::dijkstraReponderado(int origem, std::vector<double>& dist, std::vector<std::pair<double, int>>& heap) const {
+    const auto maisProximoPrimeiro = std::greater<std::pair<double, int>>();
+
+    dist.assign(numeroDeVertices + 1, INFINITO_JOHNSON);
+    heap.clear();
+    dist[origem] = 0.0;
+    heap.push_back({ 0.0, origem });
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), maisProximoPrimeiro);
+        auto [d, u] = heap.back();
+        heap.pop_back();
+        if (d > dist[u]) continue;
+
+        for (int i = ponteirosInicio[u]; i < ponteirosInicio[u + 1]; ++i) {
+            int v = listaVizinhos[i];
+            double nd = d + listaPesos[i];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                heap.push_back({ nd, v });
+                std::push_heap(heap.begin(), heap.end(), maisProximoPrimeiro);
+            }
+        }
+    }
+
+    // Desfaz a reponderação: d(s,v) = d'(s,v) - h(s) + h(v)
+    const double hOrigem = potencial[origem];
+    for (int v = 1; v <= numeroDeVertices; ++v) {
+        if (dist[v] != INFINITO_JOHNSON) dist[v] = dist[v] - hOrigem + potencial[v];
+    }
+}
+
+void Johnson::executar(const std::vector<int>& origens,
+    const std::function<void(int origem, const std::vector<double>& dist)>& callback,
+    int numThreads) const {
+    if (numeroDeVertices == 0) {
+        throw std::runtime_error("Johnson: preparar() deve ser chamado antes de executar().");
+    }
+    for (int origem : origens) {
+        if (origem <= 0 || origem > numeroDeVertices) {
+            throw std::runtime_error("Vertice de origem invalido em Johnson: " + std::to_string(origem));
+        }
+    }
+    if (origens.empty()) return;
+
+    // Buffers por thread: a memória não cresce com o número de origens
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    numThreads = std::max(1, std::min(numThreads, static_cast<int>(origens.size())));
+    std::vector<std::vector<double>> distPorThread(numThreads);
+    std::vector<std::vector<std::pair<double, int>>> heapPorThread(numThreads);
+
+    executarEmParalelo(static_cast<int>(origens.size()), numThreads, [&](int indice, int idThread) {
+        dijkstraReponderado(origens[indice], distPorThread[idThread], heapPorThread[idThread]);
+        callback(origens[indice], distPorThread[idThread]);
+    });
+}
+
+void Johnson::salvarDistancias(const std::vector<int>& origens, const std::string& caminhoArquivo, int numThreads) const {
+    // Valida antes de abrir o arquivo: um erro aqui não deve truncar um arquivo existente
+    if (numeroDeVertices == 0) {
+        throw std::runtime_error("Johnson: preparar() deve ser chamado antes de salvarDistancias().");
+    }
+    const int n = numeroDeVertices;
+
+    // Origens sem repetição, na ordem da primeira ocorrência; posicao[v] é a linha de v no arquivo
+    std::vector<int> unicas;
+    std::vector<int> posicao(static_cast<size_t>(n) + 1, -1);
+    unicas.reserve(origens.size());
+    for (int origem : origens) {
+        if (origem <= 0 || origem > n) {
+            throw std::runtime_error("Vertice de origem invalido em Johnson: " + std::to_string(origem));
+        }
+        if (posicao[origem] == -1) {
+            posicao[origem] = static_cast<int>(unicas.size());
+            unicas.push_back(origem);
+        }
+    }
+
+    std::ofstream arquivo(caminhoArquivo, std::ios::binary | std::ios::trunc);
+    if (!arquivo.is_open()) {
+        throw std::runtime_error("Nao foi possivel criar o arquivo de distancias: " + caminhoArquivo);
+    }
+
+    // Cabeçalho
+    const int32_t vertices = n;
+    const int32_t quantidade = static_cast<int32_t>(unicas.size());
+    arquivo.write(ASSINATURA_ARQUIVO, sizeof(ASSINATURA_ARQUIVO));
+    arquivo.write(reinterpret_cast<const char*>(&VERSAO_ARQUIVO), sizeof(VERSAO_ARQUIVO));
+    arquivo.write(reinterpret_cast<const char*>(&vertices), sizeof(vertices));
+    arquivo.write(reinterpret_cast<const char*>(&quantidade), sizeof(quantidade));
+    for (int origem : unicas) {
+        int32_t o = origem;
+        arquivo.write(reinterpret_cast<const char*>(&o), sizeof(o));
+    }
+    const std::streamoff inicioLinhas = static_cast<std::streamoff>(arquivo.tellp());
+    const std::streamoff tamanhoLinha = static_cast<std::streamoff>(n) * sizeof(double);
+
+    // As linhas chegam fora de ordem; cada uma é gravada direto na sua posição
+    std::mutex mutexArquivo;
+    executar(unicas, [&](int origem, const std::vector<double>& dist) {
+        std::lock_guard<std::mutex> trava(mutexArquivo);
+        arquivo.seekp(inicioLinhas + posicao[origem] * tamanhoLinha);
+        arquivo.write(reinterpret_cast<const char*>(dist.data() + 1), tamanhoLinha);
+    }, numThreads);
+
+    if (!arquivo) {
+        throw std::runtime_error("Erro ao gravar o arquivo de distancias: " + caminhoArquivo);
+    }
+}
+
+std::vector<double> Johnson::lerLinhaDistancias(const std::string& caminhoArquivo, int origem) {
+    std::ifstream arquivo(caminhoArquivo, std::ios::binary);
+    if (!arquivo.is_open()) {
+        throw std::runtime_error("Nao foi possivel abrir o arquivo de distancias: " + caminhoArquivo);
+    }
+
+    char assinatura[4];
+    int32_t versao = 0, n = 0, quantidade = 0;
+    arquivo.read(assinatura, sizeof(assinatura));
+    arquivo.read(reinterpret_cast<char*>(&versao), sizeof(versao));
+    arquivo.read(reinterpret_cast<char*>(&n), sizeof(n));
+    arquivo.read(reinterpret_cast<char*>(&quantidade), sizeof(quantidade));
+    if (!arquivo || std::memcmp(assinatura, ASSINATURA_ARQUIVO, sizeof(assinatura)) != 0
+        || versao != VERSAO_ARQUIVO || n <= 0 || quantidade < 0) {
+        throw std::runtime_error("Arquivo de distancias invalido: " + caminhoArquivo);
+    }
+
+    std::vector<int32_t> origens(quantidade);
+    arquivo.read(reinterpret_cast<char*>(origens.data()), static_cast<std::streamsize>(quantidade) * sizeof(int32_t));
+    auto it = std::find(origens.begin(), origens.end(), origem);
+    if (!arquivo || it == origens.end()) {
+        throw std::runtime_error("A origem " + std::to_string(origem) + " nao esta no arquivo " + caminhoArquivo);
+    }
+
+    const std::streamoff tamanhoLinha = static_cast<std::streamoff>(n) * sizeof(double);
+    std::vector<double> dist(static_cast<size_t>(n) + 1, INFINITO_JOHNSON);
+    arquivo.seekg(static_cast<std::streamoff>(it - origens.begin()) * tamanhoLinha, std::ios::cur);
+    arquivo.read(reinterpret_cast<char*>(dist.data() + 1), tamanhoLinha);
+    if (!arquivo) {
+        throw std::runtime_error("Arquivo de distancias truncado: " + caminhoArquivo);
+    }
+    return dist;
+}
+
+const std::vector<double>& Johnson::obterPotenciais() const {
+    return potencial;
+}
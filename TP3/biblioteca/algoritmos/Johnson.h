@@ -0,0 +1,94 @@
+/**
+ * @file Johnson.h
+ * @brief Declaração da classe Johnson para caminhos mínimos de várias origens com pesos negativos.
+ * * O algoritmo de Johnson:
+ * - Uma única execução de Bellman-Ford (variante com fila) a partir de uma super-origem
+ *   virtual calcula um potencial h(v) para cada vértice.
+ * - Os pesos são reponderados: w'(u,v) = w(u,v) + h(u) - h(v) >= 0, o que preserva os
+ *   caminhos mínimos e permite usar Dijkstra.
+ * - Cada origem pedida roda um Dijkstra no grafo reponderado (em paralelo) e a
+ *   distância real é recuperada com d(s,v) = d'(s,v) - h(s) + h(v).
+ * - Complexidade: O(V * E) para os potenciais + O(E log V) por origem, contra
+ *   O(V * E) por origem usando Bellman-Ford.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+
+ // Forward declaration da classe principal de grafos do TP3
+class GrafoPesado;
+
+/**
+ * @class Johnson
+ * @brief Motor de caminhos mínimos de várias origens para grafos com pesos negativos.
+ * @details Após preparar(), o objeto guarda uma cópia CSR já reponderada do grafo
+ * (o GrafoPesado original não é alterado) e pode atender vários lotes de origens.
+ */
+class Johnson {
+public:
+    /**
+     * @brief Calcula os potenciais e monta a cópia reponderada do grafo.
+     * @param grafo O grafo ponderado (direcionado ou não, pesos negativos permitidos).
+     * @throws std::runtime_error se o grafo contiver ciclo negativo (o ciclo é citado na mensagem).
+     */
+    void preparar(const GrafoPesado& grafo);
+
+    /**
+     * @brief Calcula as distâncias a partir de cada origem, entregando uma linha por vez.
+     * @details As origens são distribuídas entre as threads; cada thread reaproveita
+     * seus buffers, então a memória fica em O(threads x V).
+     * @param origens Vértices de origem (1-based).
+     * @param callback Chamado com (origem, dist), onde dist tem V+1 posições (dist[0] sem uso)
+     * e infinito para vértices inalcançáveis. Pode ser chamado por várias threads ao mesmo
+     * tempo; a referência só é válida durante a chamada.
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * @throws std::runtime_error se preparar() não foi chamado ou alguma origem for inválida.
+     */
+    void executar(const std::vector<int>& origens,
+        const std::function<void(int origem, const std::vector<double>& dist)>& callback,
+        int numThreads = 0) const;
+
+    /**
+     * @brief Calcula as distâncias das origens e grava as linhas em um arquivo binário.
+     * @details Formato: "GPJD", versão (int32), V (int32), número de origens (int32),
+     * a lista de origens (int32 cada) e, para cada origem na mesma ordem, V valores
+     * double com d(origem, 1..V). Cada linha é gravada assim que fica pronta, direto
+     * na sua posição do arquivo. Origens repetidas são calculadas e gravadas uma vez,
+     * na posição da primeira ocorrência. As origens são validadas antes de o arquivo
+     * ser aberto, então um erro não trunca um arquivo existente.
+     * @param origens Vértices de origem (1-based).
+     * @param caminhoArquivo Caminho do arquivo de saída.
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * @throws std::runtime_error se preparar() não foi chamado, alguma origem for inválida
+     * ou o arquivo não puder ser escrito.
+     */
+    void salvarDistancias(const std::vector<int>& origens, const std::string& caminhoArquivo, int numThreads = 0) const;
+
+    /**
+     * @brief Lê do arquivo gerado por salvarDistancias a linha de uma origem.
+     * @param caminhoArquivo Caminho do arquivo binário.
+     * @param origem Vértice de origem desejado.
+     * @return Vetor com V+1 posições (dist[0] sem uso).
+     * @throws std::runtime_error se o arquivo for inválido ou não contiver a origem.
+     */
+    static std::vector<double> lerLinhaDistancias(const std::string& caminhoArquivo, int origem);
+
+    /**
+     * @brief Obtém os potenciais h(v) calculados em preparar() (h[0] sem uso).
+     */
+    const std::vector<double>& obterPotenciais() const;
+
+private:
+    void dijkstraReponderado(int origem, std::vector<double>& dist, std::vector<std::pair<double, int>>& heap) const;
+
+    int numeroDeVertices = 0;
+    std::vector<double> potencial;
+
+    // Cópia CSR com os pesos já reponderados (todos >= 0)
+    std::vector<int> ponteirosInicio;
+    std::vector<int> listaVizinhos;
+    std::vector<double> listaPesos;
+};
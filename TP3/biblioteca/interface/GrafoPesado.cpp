@@ -5,15 +5,17 @@
 
 #include "GrafoPesado.h"
 #include "../representacao/VetorAdjacenciaPesada.h" 
+#include "../../../comum/Paralelo.h"
 #include <fstream>   
 #include <stdexcept> 
 #include <vector>
 #include <string>
 #include <limits>    
+#include <algorithm> 
 
-GrafoPesado::GrafoPesado(const std::string& caminhoArquivo, bool direcionado, bool transposto)
+GrafoPesado::GrafoPesado(const std::string& caminhoArquivo, bool direcionado, bool transposto, LayoutCSR layout)
     : numeroDeVertices(0), numeroDeArestas(0), possuiPesoNegativo(false),
-    ehDirecionado(direcionado), ehTransposto(transposto) {
+    ehDirecionado(direcionado), ehTransposto(transposto), layoutCSR(layout) {
 
     // Bloco: Abertura e validao do arquivo de entrada
     std::ifstream arquivo(caminhoArquivo);
@@ -28,7 +30,9 @@ GrafoPesado::GrafoPesado(const std::string& caminhoArquivo, bool direcionado, bo
     }
 
     // Bloco: Criao da representao interna (VetorAdjacenciaPesada/CSR)
-    representacaoInterna = std::make_unique<VetorAdjacenciaPesada>(this->numeroDeVertices, ehDirecionado, ehTransposto);
+    auto representacaoCSR = std::make_unique<VetorAdjacenciaPesada>(this->numeroDeVertices, ehDirecionado, ehTransposto, layoutCSR);
+    VetorAdjacenciaPesada* csr = representacaoCSR.get();
+    representacaoInterna = std::move(representacaoCSR);
 
     int u, v;
     double peso;
@@ -54,9 +58,34 @@ GrafoPesado::GrafoPesado(const std::string& caminhoArquivo, bool direcionado, bo
     this->numeroDeArestas = contadorArestasLidas;
     // Bloco: Finalizao da construo da representao interna (essencial para CSR)
     representacaoInterna->finalizarConstrucao();
+    // Visoes diretas para os algoritmos especializados por layout (validas enquanto o grafo existir)
+    visaoIntercalada = csr->obterVisaoIntercalada();
+    visaoSeparada = csr->obterVisaoSeparada();
     // O arquivo  fechado automaticamente quando 'arquivo' sai de escopo (RAII).
 }
 
+GrafoPesado::GrafoPesado(int numeroVertices, std::vector<ArestaComPeso> arestas, bool direcionado, bool transposto,
+    LayoutCSR layout)
+    : numeroDeVertices(numeroVertices), numeroDeArestas(static_cast<long long>(arestas.size())), possuiPesoNegativo(false),
+    ehDirecionado(direcionado), ehTransposto(transposto), layoutCSR(layout) {
+
+    if (numeroDeVertices <= 0) {
+        throw std::runtime_error("Numero de vertices invalido: " + std::to_string(numeroVertices));
+    }
+    possuiPesoNegativo = std::any_of(arestas.begin(), arestas.end(),
+        [](const ArestaComPeso& aresta) { return aresta.peso < 0.0; });
+
+    // Mesma sequncia do construtor por arquivo, com o lote inteiro entregue de uma vez
+    auto representacaoCSR = std::make_unique<VetorAdjacenciaPesada>(this->numeroDeVertices, ehDirecionado, ehTransposto, layoutCSR);
+    VetorAdjacenciaPesada* csr = representacaoCSR.get();
+    representacaoInterna = std::move(representacaoCSR);
+
+    csr->adicionarArestasComPeso(std::move(arestas));
+    representacaoInterna->finalizarConstrucao();
+    visaoIntercalada = csr->obterVisaoIntercalada();
+    visaoSeparada = csr->obterVisaoSeparada();
+}
+
 /**
  * @brief Destrutor da classe GrafoPesado.
  * @details A definio explcita aqui, mesmo que vazia,  necessria por causa
@@ -85,11 +114,25 @@ std::vector<VizinhoComPeso> GrafoPesado::obterVizinhosComPesos(int u) const {
     return representacaoInterna->obterVizinhosComPesos(u);
 }
 
+void GrafoPesado::paraCadaVizinhoComPeso(int u, const std::function<void(int v, double w)>& fn) const {
+    // Delega a chamada para o objeto de representacao interno.
+    representacaoInterna->paraCadaVizinhoComPeso(u, fn);
+}
+
 double GrafoPesado::obterPesoAresta(int u, int v) const {
     // Delega a chamada para o objeto de representao interno.
     return representacaoInterna->obterPesoAresta(u, v);
 }
 
+std::vector<double> GrafoPesado::obterPesosArestas(const std::vector<std::pair<int, int>>& pares) const {
+    // A representacao interna e sempre o CSR (VetorAdjacenciaPesada)
+    return static_cast<const VetorAdjacenciaPesada&>(*representacaoInterna).obterPesosArestas(pares);
+}
+
+void GrafoPesado::construirIndiceHash(int grauMinimo) {
+    static_cast<VetorAdjacenciaPesada&>(*representacaoInterna).construirIndiceHash(grauMinimo);
+}
+
 bool GrafoPesado::temPesoNegativo() const {
     return this->possuiPesoNegativo;
 }
@@ -102,6 +145,10 @@ bool GrafoPesado::consultaTransposto() const {
     return this->ehTransposto;
 }
 
+LayoutCSR GrafoPesado::obterLayout() const {
+    return this->layoutCSR;
+}
+
 // --- Implementao dos Mtodos de Dijkstra ---
 ResultadoDijkstra GrafoPesado::executarDijkstraHeap(int origem) const {
     Dijkstra dijkstraAlgo; // Cria instncia da classe especialista
@@ -111,4 +158,29 @@ ResultadoDijkstra GrafoPesado::executarDijkstraHeap(int origem) const {
 ResultadoDijkstra GrafoPesado::executarDijkstraVetor(int origem) const {
     Dijkstra dijkstraAlgo; // Cria instncia da classe especialista
     return dijkstraAlgo.executarVetor(*this, origem); // Delega a chamada
-}
\ No newline at end of file
+}
+
+void GrafoPesado::executarDijkstraLote(const std::vector<int>& origens,
+    const std::function<void(int origem, const ResultadoDijkstra& resultado)>& callback,
+    int numThreads) const {
+    if (possuiPesoNegativo) {
+        throw std::runtime_error("Algoritmo de Dijkstra nao suporta grafos com pesos negativos.");
+    }
+    for (int origem : origens) {
+        if (origem <= 0 || origem > numeroDeVertices) {
+            throw std::runtime_error("Vertice de origem invalido no lote de Dijkstra: " + std::to_string(origem));
+        }
+    }
+
+    // Um espaco de trabalho por thread: a memoria nao cresce com o tamanho do lote
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    numThreads = std::max(1, std::min(numThreads, static_cast<int>(origens.size())));
+    std::vector<EspacoTrabalhoDijkstra> espacos(numThreads);
+
+    executarEmParalelo(static_cast<int>(origens.size()), numThreads, [&](int indice, int idThread) {
+        Dijkstra dijkstraAlgo;
+        EspacoTrabalhoDijkstra& espaco = espacos[idThread];
+        dijkstraAlgo.executarHeap(*this, origens[indice], espaco);
+        callback(origens[indice], espaco.resultado);
+    });
+}
@@ -4,9 +4,11 @@
 #include <string>
 #include <memory> // Para std::unique_ptr
 #include <limits> // Para std::numeric_limits
+#include <functional> // Para std::function
 
 // Inclui a interface da representação pesada e a struct VizinhoComPeso
-#include "../representacao/RepresentacaoPesada.h" 
+#include "../representacao/representacaoPesada.h" 
+#include "../representacao/LayoutCSR.h"
 // Inclui a definição de Dijkstra e ResultadoDijkstra
 #include "../algoritmos/Dijkstra.h" 
 
@@ -28,9 +30,22 @@ public:
      * interna (VetorAdjacenciaPesada) e finaliza sua construção.
      * @param caminhoArquivo O caminho para o arquivo .txt.
      * @param direcionado Indica se o grafo deve ser tratado como direcionado.
+     * @param layout Organização das arestas no CSR (intercalado {id, peso} ou separado).
      * @throws std::runtime_error Se o arquivo não puder ser aberto ou tiver formato inválido.
      */
-    explicit GrafoPesado(const std::string& caminhoArquivo, bool direcionado = false, bool transposto = false);
+    explicit GrafoPesado(const std::string& caminhoArquivo, bool direcionado = false, bool transposto = false,
+        LayoutCSR layout = LayoutCSR::Intercalado);
+
+    /**
+     * @brief Construtor que monta o grafo a partir de arestas já em memória (ex: comum/Geradores.h).
+     * @details As arestas vão direto para o buffer de construção do CSR, sem cópia e sem
+     * passar por arquivo texto; arestas inválidas e laços são descartados como na leitura.
+     * @param numeroVertices Número de vértices (arestas usam ids 1..numeroVertices).
+     * @param arestas Arestas (u, v, peso); o vetor é consumido.
+     * @throws std::runtime_error Se numeroVertices <= 0 ou o CSR não comportar as arestas.
+     */
+    GrafoPesado(int numeroVertices, std::vector<ArestaComPeso> arestas, bool direcionado = false,
+        bool transposto = false, LayoutCSR layout = LayoutCSR::Intercalado);
 
     /**
      * @brief Destrutor padrão. Gerencia a memória da representação interna via unique_ptr.
@@ -66,6 +81,13 @@ public:
      */
     std::vector<VizinhoComPeso> obterVizinhosComPesos(int u) const;
 
+    /**
+     * @brief Itera sobre os vizinhos de um vértice (com pesos) sem criar vetor temporário.
+     * @param u O vértice (indexado a partir de 1).
+     * @param fn Função chamada para cada vizinho 'v' com peso 'w'.
+     */
+    void paraCadaVizinhoComPeso(int u, const std::function<void(int v, double w)>& fn) const;
+
     /**
      * @brief Obtém o peso da aresta entre dois vértices, se existir.
      * @param u Primeiro vértice.
@@ -74,6 +96,23 @@ public:
      */
     double obterPesoAresta(int u, int v) const;
 
+    /**
+     * @brief Obtém os pesos de vários pares (u, v) de uma vez (ex: validar o custo de caminhos).
+     * @details As consultas são agrupadas por origem e ordenadas por destino, então cada
+     * lista de vizinhos é percorrida uma vez. Mesma semântica de obterPesoAresta.
+     * @param pares Pares (u, v) consultados (1-based).
+     * @return Os pesos, na mesma ordem de 'pares'.
+     */
+    std::vector<double> obterPesosArestas(const std::vector<std::pair<int, int>>& pares) const;
+
+    /**
+     * @brief Constrói o índice hash de arestas para os vértices de grau >= grauMinimo.
+     * @details Opcional; acelera obterPesoAresta/obterPesosArestas nos vértices de grau alto.
+     * Não deve ser chamado enquanto outras threads consultam o grafo.
+     * @param grauMinimo Grau mínimo para indexar um vértice (<= 0 remove o índice).
+     */
+    void construirIndiceHash(int grauMinimo = 256);
+
     /**
     * @brief Verifica rapidamente se o grafo contém alguma aresta com peso negativo.
     * @details Útil para determinar a aplicabilidade de certos algoritmos (ex: Dijkstra).
@@ -90,6 +129,23 @@ public:
     */
     bool consultaTransposto() const;
 
+    /**
+     * @brief Informa o layout do CSR escolhido na construção.
+     */
+    LayoutCSR obterLayout() const;
+
+    /**
+     * @brief Chama fn com a visão do CSR no layout ativo (VisaoCSRIntercalada ou VisaoCSRSeparada).
+     * @details Permite que os algoritmos sejam templates sobre o layout: fn é normalmente
+     * uma lambda genérica ([&](const auto& csr) { ... }) e cada layout ganha sua própria
+     * instância, com o laço de vizinhos sem chamadas virtuais nem std::function.
+     */
+    template <class Funcao>
+    decltype(auto) visitarCSR(Funcao&& fn) const {
+        if (layoutCSR == LayoutCSR::Intercalado) return fn(visaoIntercalada);
+        return fn(visaoSeparada);
+    }
+
     // --- Métodos para Dijkstra ---
 
         /**
@@ -106,6 +162,22 @@ public:
      */
     ResultadoDijkstra executarDijkstraVetor(int origem) const;
 
+    /**
+     * @brief Executa o Dijkstra (Heap) para um lote de origens, em paralelo.
+     * @details As origens são distribuídas dinamicamente entre as threads; cada thread
+     * reaproveita o seu EspacoTrabalhoDijkstra, então a memória fica em O(threads x V)
+     * independentemente do tamanho do lote. Cada resultado é entregue ao callback e
+     * descartado logo em seguida (a referência só é válida durante a chamada).
+     * @param origens Vértices de origem (1-based).
+     * @param callback Chamado uma vez por origem com o resultado correspondente. Pode ser
+     * chamado simultaneamente por várias threads e sem ordem definida.
+     * @param numThreads Número de threads (<= 0 usa o número de núcleos).
+     * @throws std::runtime_error se o grafo contiver pesos negativos ou alguma origem for inválida.
+     */
+    void executarDijkstraLote(const std::vector<int>& origens,
+        const std::function<void(int origem, const ResultadoDijkstra& resultado)>& callback,
+        int numThreads = 0) const;
+
 
 
 private:
@@ -118,4 +190,9 @@ private:
     bool possuiPesoNegativo; // Cache para a verificação de peso negativo
 	bool ehDirecionado; // Indica se o grafo é direcionado
 	bool ehTransposto; // Indica se o grafo foi invertido
+
+    // Layout do CSR e visões diretas sobre os vetores da representação interna
+    LayoutCSR layoutCSR;
+    VisaoCSRIntercalada visaoIntercalada;
+    VisaoCSRSeparada visaoSeparada;
 };
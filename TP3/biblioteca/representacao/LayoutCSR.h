@@ -0,0 +1,82 @@
+/**
+ * @file LayoutCSR.h
+ * @brief Layouts de memória do CSR ponderado e as visões (sem posse) usadas pelos algoritmos.
+ * * Dois layouts, escolhidos na construção do grafo:
+ * - Intercalado: um vetor de registros {int32 id, float peso} (8 bytes por aresta);
+ *   vizinho e peso chegam na mesma linha de cache.
+ * - Separado (SoA): um vetor de ids (int32) e outro de pesos (float), útil quando só
+ *   os ids são percorridos (ex: BFS/grau) ou para vetorizar sobre os pesos.
+ * Os pesos são guardados em float (cerca de 7 dígitos significativos); as distâncias
+ * continuam sendo acumuladas em double pelos algoritmos.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @enum LayoutCSR
+ * @brief Organização das arestas no CSR ponderado.
+ */
+enum class LayoutCSR {
+    Intercalado, ///< Registros {id, peso} contíguos (AoS)
+    Separado     ///< Vetores paralelos de ids e pesos (SoA)
+};
+
+/**
+ * @struct ArestaCSR
+ * @brief Registro do layout intercalado: destino e peso da aresta (8 bytes).
+ */
+struct ArestaCSR {
+    int32_t id;
+    float peso;
+};
+
+/**
+ * @struct VisaoCSRIntercalada
+ * @brief Acesso direto (sem funções virtuais) ao CSR no layout intercalado.
+ * @details Os ponteiros apontam para os vetores da representação, que precisa
+ * continuar viva enquanto a visão for usada.
+ */
+struct VisaoCSRIntercalada {
+    const int* ponteirosInicio = nullptr; ///< Arestas de u: [ponteirosInicio[u], ponteirosInicio[u + 1])
+    const ArestaCSR* arestas = nullptr;
+
+    /**
+     * @brief Chama fn(v, peso) para cada vizinho de u (o compilador pode expandir fn no laço).
+     */
+    template <class Funcao>
+    void paraCadaVizinho(int u, Funcao&& fn) const {
+        const ArestaCSR* fim = arestas + ponteirosInicio[u + 1];
+        for (const ArestaCSR* a = arestas + ponteirosInicio[u]; a != fim; ++a) {
+            fn(static_cast<int>(a->id), static_cast<double>(a->peso));
+        }
+    }
+
+    int idAresta(int i) const { return arestas[i].id; }         ///< Destino da i-ésima aresta do CSR
+    double pesoAresta(int i) const { return arestas[i].peso; }  ///< Peso da i-ésima aresta do CSR
+};
+
+/**
+ * @struct VisaoCSRSeparada
+ * @brief Acesso direto (sem funções virtuais) ao CSR no layout separado (SoA).
+ */
+struct VisaoCSRSeparada {
+    const int* ponteirosInicio = nullptr;
+    const int32_t* vizinhos = nullptr;
+    const float* pesos = nullptr;
+
+    /**
+     * @brief Chama fn(v, peso) para cada vizinho de u.
+     */
+    template <class Funcao>
+    void paraCadaVizinho(int u, Funcao&& fn) const {
+        const int fim = ponteirosInicio[u + 1];
+        for (int i = ponteirosInicio[u]; i < fim; ++i) {
+            fn(static_cast<int>(vizinhos[i]), static_cast<double>(pesos[i]));
+        }
+    }
+
+    int idAresta(int i) const { return vizinhos[i]; }
+    double pesoAresta(int i) const { return pesos[i]; }
+};
@@ -8,9 +8,60 @@
 #include <algorithm> 
 #include <vector>
 #include <limits>    
+#include <cstdint>
+#include <string>
 
-VetorAdjacenciaPesada::VetorAdjacenciaPesada(int n, bool direcionado, bool transposto)
-    : numeroDeVertices(n), numeroDeArestas(0), ehDirecionado(direcionado), ehTransposto(transposto),
+namespace {
+
+    /**
+     * @brief Primeira posição em [inicio, fim) cujo destino é >= v (lower_bound sem desvios).
+     * @details A cada passo a metade é escolhida por um operador condicional, que o
+     * compilador transforma em cmov: sem previsões de desvio erradas nos vértices de grau alto.
+     */
+    template <class VisaoCSR>
+    int limiteInferior(const VisaoCSR& csr, int inicio, int fim, int v) {
+        int tamanho = fim - inicio;
+        if (tamanho <= 0) return inicio;
+        int base = inicio;
+        while (tamanho > 1) {
+            const int metade = tamanho / 2;
+            base = (csr.idAresta(base + metade - 1) < v) ? base + metade : base;
+            tamanho -= metade;
+        }
+        return base + (csr.idAresta(base) < v ? 1 : 0);
+    }
+
+    /**
+     * @brief Como limiteInferior, mas a partir de 'inicio' com passos 1, 2, 4, ... (galope).
+     * @details Usado nas consultas em lote: com os destinos ordenados, o próximo costuma
+     * estar perto do anterior, e o custo fica O(log distância) em vez de O(log grau).
+     */
+    template <class VisaoCSR>
+    int limiteInferiorGalope(const VisaoCSR& csr, int inicio, int fim, int v) {
+        int passo = 1;
+        int anterior = inicio;
+        int atual = inicio;
+        while (atual < fim && csr.idAresta(atual) < v) {
+            anterior = atual + 1;
+            atual += passo;
+            passo *= 2;
+        }
+        return limiteInferior(csr, anterior, std::min(atual + 1, fim), v);
+    }
+
+    // Hash multiplicativo (Fibonacci) da chave (u, v) para 'bits' bits
+    inline size_t hashPar(uint64_t chave, int bits) {
+        return static_cast<size_t>((chave * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+    }
+
+    inline uint64_t chavePar(int u, int v) {
+        return (static_cast<uint64_t>(u) << 32) | static_cast<uint32_t>(v);
+    }
+
+} // namespace
+
+VetorAdjacenciaPesada::VetorAdjacenciaPesada(int n, bool direcionado, bool transposto, LayoutCSR layout)
+    : numeroDeVertices(n), numeroDeArestas(0), ehDirecionado(direcionado), ehTransposto(transposto), layout(layout),
     ponteirosInicio(n + 2, 0),
     grausTemporarios(n + 1, 0) {
     if (n <= 0) {
@@ -35,8 +86,30 @@ void VetorAdjacenciaPesada::adicionarArestaComPeso(int u, int v, double w) {
     }
 }
 
+void VetorAdjacenciaPesada::adicionarArestasComPeso(std::vector<ArestaComPeso>&& arestas) {
+    const int n = numeroDeVertices;
+    arestas.erase(std::remove_if(arestas.begin(), arestas.end(), [n](const ArestaComPeso& a) {
+        return a.u <= 0 || a.u > n || a.v <= 0 || a.v > n || a.u == a.v;
+    }), arestas.end());
+    if (ehTransposto) {
+        for (auto& aresta : arestas) std::swap(aresta.u, aresta.v);
+    }
+    if (arestasTemporarias.empty()) {
+        arestasTemporarias = std::move(arestas);
+    }
+    else {
+        arestasTemporarias.insert(arestasTemporarias.end(), arestas.begin(), arestas.end());
+    }
+}
+
 void VetorAdjacenciaPesada::finalizarConstrucao() {
-    this->numeroDeArestas = arestasTemporarias.size();
+    // Os deslocamentos do CSR são int: limita o total de entradas (2 por aresta se não direcionado)
+    const long long totalEntradas = static_cast<long long>(arestasTemporarias.size()) * (ehDirecionado ? 1 : 2);
+    if (totalEntradas > std::numeric_limits<int>::max()) {
+        throw std::runtime_error("Grafo grande demais para o CSR: " + std::to_string(totalEntradas) +
+            " entradas (limite de " + std::to_string(std::numeric_limits<int>::max()) + ").");
+    }
+    this->numeroDeArestas = static_cast<int>(arestasTemporarias.size());
 
     // 1. Contagem dos graus
     std::fill(grausTemporarios.begin(), grausTemporarios.end(), 0); // Reset importante
@@ -58,49 +131,47 @@ void VetorAdjacenciaPesada::finalizarConstrucao() {
         ponteirosInicio[i + 1] = ponteirosInicio[i] + grausTemporarios[i];
     }
 
-    // 3. Alocação
+    // 3. Alocação e preenchimento (sempre em registros intercalados; separados no passo 5 se preciso)
     int tamanhoTotalVizinhos = ponteirosInicio[numeroDeVertices + 1];
-    listaVizinhos.assign(tamanhoTotalVizinhos, -1);
-    listaPesos.assign(tamanhoTotalVizinhos, std::numeric_limits<double>::infinity());
+    std::vector<ArestaCSR> arestas(tamanhoTotalVizinhos);
 
     std::vector<int> ponteirosEscrita = ponteirosInicio;
     for (const auto& aresta : arestasTemporarias) {
         int u = aresta.u;
         int v = aresta.v;
-        double peso = aresta.peso;
+        float peso = static_cast<float>(aresta.peso);
 
         // Adiciona u -> v (que pode ser v->u original se foi transposto)
-        int indiceUV = ponteirosEscrita[u]++;
-        listaVizinhos[indiceUV] = v;
-        listaPesos[indiceUV] = peso;
+        arestas[ponteirosEscrita[u]++] = { v, peso };
 
         // Adiciona volta se não for direcionado
         if (!ehDirecionado) {
-            int indiceVU = ponteirosEscrita[v]++;
-            listaVizinhos[indiceVU] = u;
-            listaPesos[indiceVU] = peso;
+            arestas[ponteirosEscrita[v]++] = { u, peso };
         }
     }
 
-    // 4. Ordenação (Opcional)
+    // 4. Ordenação dos vizinhos de cada vértice (por id e, entre paralelas, por peso)
     for (int u = 1; u <= numeroDeVertices; ++u) {
-        int inicio = ponteirosInicio[u];
-        int fim = ponteirosInicio[u + 1];
-        if (inicio < fim) {
-            std::vector<std::pair<int, double>> vizinhosComPesos;
-            vizinhosComPesos.reserve(fim - inicio);
-            for (int i = inicio; i < fim; ++i) {
-                vizinhosComPesos.emplace_back(listaVizinhos[i], listaPesos[i]);
-            }
-            std::sort(vizinhosComPesos.begin(), vizinhosComPesos.end());
-            for (int i = 0; i < vizinhosComPesos.size(); ++i) {
-                listaVizinhos[inicio + i] = vizinhosComPesos[i].first;
-                listaPesos[inicio + i] = vizinhosComPesos[i].second;
-            }
+        std::sort(arestas.begin() + ponteirosInicio[u], arestas.begin() + ponteirosInicio[u + 1],
+            [](const ArestaCSR& a, const ArestaCSR& b) {
+                return a.id < b.id || (a.id == b.id && a.peso < b.peso);
+            });
+    }
+
+    // 5. Layout final
+    if (layout == LayoutCSR::Intercalado) {
+        listaArestas = std::move(arestas);
+    }
+    else {
+        listaVizinhos.resize(tamanhoTotalVizinhos);
+        listaPesos.resize(tamanhoTotalVizinhos);
+        for (int i = 0; i < tamanhoTotalVizinhos; ++i) {
+            listaVizinhos[i] = arestas[i].id;
+            listaPesos[i] = arestas[i].peso;
         }
     }
 
-    // 5. Limpeza
+    // 6. Limpeza
     arestasTemporarias.clear();
     arestasTemporarias.shrink_to_fit();
     grausTemporarios.clear();
@@ -126,10 +197,11 @@ std::vector<int> VetorAdjacenciaPesada::obterVizinhos(int vertice) const {
     if (vertice <= 0 || vertice > numeroDeVertices) {
         throw std::out_of_range("Vertice invalido ao obter vizinhos.");
     }
-    // Copia a fatia correspondente do vetor listaVizinhos
-    auto inicio = listaVizinhos.begin() + ponteirosInicio[vertice];
-    auto fim = listaVizinhos.begin() + ponteirosInicio[vertice + 1];
-    return std::vector<int>(inicio, fim);
+    // Copia os ids da fatia correspondente do CSR
+    std::vector<int> resultado;
+    resultado.reserve(ponteirosInicio[vertice + 1] - ponteirosInicio[vertice]);
+    paraCadaVizinhoInterno(vertice, [&](int v, double) { resultado.push_back(v); });
+    return resultado;
 }
 
 /**
@@ -140,13 +212,8 @@ std::vector<VizinhoComPeso> VetorAdjacenciaPesada::obterVizinhosComPesos(int ver
         throw std::out_of_range("Vertice invalido ao obter vizinhos com pesos.");
     }
     std::vector<VizinhoComPeso> resultado;
-    int inicio = ponteirosInicio[vertice];
-    int fim = ponteirosInicio[vertice + 1];
-    resultado.reserve(fim - inicio);
-
-    for (int i = inicio; i < fim; ++i) {
-        resultado.push_back({ listaVizinhos[i], listaPesos[i] });
-    }
+    resultado.reserve(ponteirosInicio[vertice + 1] - ponteirosInicio[vertice]);
+    paraCadaVizinhoInterno(vertice, [&](int v, double peso) { resultado.push_back({ v, peso }); });
     return resultado;
 }
 
@@ -157,16 +224,14 @@ void VetorAdjacenciaPesada::paraCadaVizinhoComPeso(int u, const std::function<vo
     if (u <= 0 || u > numeroDeVertices) {
         throw std::out_of_range("Vertice invalido em paraCadaVizinhoComPeso.");
     }
-    int inicio = ponteirosInicio[u];
-    int fim = ponteirosInicio[u + 1];
-    for (int i = inicio; i < fim; ++i) {
-        fn(listaVizinhos[i], listaPesos[i]);
-    }
+    paraCadaVizinhoInterno(u, fn);
 }
 
 
 /**
- * @brief Obtém o peso da aresta entre u e v (O(grau(u)) se ordenado, O(grau(u)) pior caso se não).
+ * @brief Obtém o peso da aresta entre u e v.
+ * @details Os vizinhos estão ordenados por id (e as paralelas por peso), então a busca
+ * binária encontra a de menor peso. Vértices cobertos pelo índice hash usam o índice.
  */
 double VetorAdjacenciaPesada::obterPesoAresta(int u, int v) const {
     if (u <= 0 || u > numeroDeVertices || v <= 0 || v > numeroDeVertices) {
@@ -174,14 +239,135 @@ double VetorAdjacenciaPesada::obterPesoAresta(int u, int v) const {
     }
     if (u == v) return 0.0;
 
-    int inicio = ponteirosInicio[u];
-    int fim = ponteirosInicio[u + 1];
+    const int inicio = ponteirosInicio[u];
+    const int fim = ponteirosInicio[u + 1];
+    if (grauMinimoIndice > 0 && fim - inicio >= grauMinimoIndice) {
+        const int posicao = buscarNoIndiceHash(u, v);
+        if (posicao < 0) return std::numeric_limits<double>::infinity();
+        return (layout == LayoutCSR::Intercalado) ? obterVisaoIntercalada().pesoAresta(posicao)
+            : obterVisaoSeparada().pesoAresta(posicao);
+    }
+
+    auto buscar = [&](const auto& csr) {
+        const int posicao = limiteInferior(csr, inicio, fim, v);
+        return (posicao < fim && csr.idAresta(posicao) == v) ? csr.pesoAresta(posicao)
+            : std::numeric_limits<double>::infinity();
+    };
+    return (layout == LayoutCSR::Intercalado) ? buscar(obterVisaoIntercalada()) : buscar(obterVisaoSeparada());
+}
+
+std::vector<double> VetorAdjacenciaPesada::obterPesosArestas(const std::vector<std::pair<int, int>>& pares) const {
+    const size_t total = pares.size();
+    std::vector<double> pesos(total, std::numeric_limits<double>::infinity());
+
+    // 1. Agrupa as consultas por origem (ordenação por contagem, O(consultas + V))
+    std::vector<int> inicioGrupo(numeroDeVertices + 2, 0);
+    for (const auto& [u, v] : pares) {
+        if (u <= 0 || u > numeroDeVertices || v <= 0 || v > numeroDeVertices) {
+            throw std::out_of_range("Vertices invalidos ao obter pesos das arestas.");
+        }
+        inicioGrupo[u + 1]++;
+    }
+    for (int u = 1; u <= numeroDeVertices; ++u) inicioGrupo[u + 1] += inicioGrupo[u];
+
+    std::vector<uint32_t> ordem(total);
+    {
+        std::vector<int> escrita(inicioGrupo.begin(), inicioGrupo.end() - 1);
+        for (size_t q = 0; q < total; ++q) ordem[escrita[pares[q].first]++] = static_cast<uint32_t>(q);
+    }
+
+    // 2. Cada grupo: destinos em ordem crescente, com um cursor que só avança na lista de vizinhos
+    auto responder = [&](const auto& csr) {
+        for (int u = 1; u <= numeroDeVertices; ++u) {
+            const int primeiro = inicioGrupo[u];
+            const int ultimo = inicioGrupo[u + 1];
+            if (primeiro == ultimo) continue;
+
+            auto grupoInicio = ordem.begin() + primeiro;
+            auto grupoFim = ordem.begin() + ultimo;
+            std::sort(grupoInicio, grupoFim, [&](uint32_t a, uint32_t b) { return pares[a].second < pares[b].second; });
+
+            // Com os destinos ordenados, o galope sequencial é mais barato que o índice hash
+            const int fim = ponteirosInicio[u + 1];
+            int cursor = ponteirosInicio[u];
+            for (auto it = grupoInicio; it != grupoFim; ++it) {
+                const int v = pares[*it].second;
+                if (v == u) {
+                    pesos[*it] = 0.0;
+                    continue;
+                }
+                cursor = limiteInferiorGalope(csr, cursor, fim, v);
+                if (cursor < fim && csr.idAresta(cursor) == v) pesos[*it] = csr.pesoAresta(cursor);
+            }
+        }
+    };
+    if (layout == LayoutCSR::Intercalado) responder(obterVisaoIntercalada());
+    else responder(obterVisaoSeparada());
+
+    return pesos;
+}
+
+void VetorAdjacenciaPesada::construirIndiceHash(int grauMinimo) {
+    chavesIndice.clear();
+    posicoesIndice.clear();
+    grauMinimoIndice = 0;
+    bitsIndice = 0;
+    if (grauMinimo <= 0) return;
 
-    // Busca linear (ou binária se os vizinhos estiverem ordenados)
-    for (int i = inicio; i < fim; ++i) {
-        if (listaVizinhos[i] == v) {
-            return listaPesos[i];
+    // Capacidade: potência de 2 com fator de carga <= 1/2
+    size_t arestasIndexadas = 0;
+    for (int u = 1; u <= numeroDeVertices; ++u) {
+        const int grau = ponteirosInicio[u + 1] - ponteirosInicio[u];
+        if (grau >= grauMinimo) arestasIndexadas += grau;
+    }
+    if (arestasIndexadas == 0) return;
+    int bits = 1;
+    while ((size_t{ 1 } << bits) < 2 * arestasIndexadas) ++bits;
+
+    chavesIndice.assign(size_t{ 1 } << bits, 0);
+    posicoesIndice.assign(size_t{ 1 } << bits, -1);
+    const size_t mascara = (size_t{ 1 } << bits) - 1;
+
+    auto inserir = [&](const auto& csr) {
+        for (int u = 1; u <= numeroDeVertices; ++u) {
+            const int inicio = ponteirosInicio[u];
+            const int fim = ponteirosInicio[u + 1];
+            if (fim - inicio < grauMinimo) continue;
+            for (int i = inicio; i < fim; ++i) {
+                // Entre arestas paralelas, fica a primeira (a de menor peso)
+                if (i > inicio && csr.idAresta(i) == csr.idAresta(i - 1)) continue;
+                const uint64_t chave = chavePar(u, csr.idAresta(i));
+                size_t pos = hashPar(chave, bits);
+                while (chavesIndice[pos] != 0) pos = (pos + 1) & mascara;
+                chavesIndice[pos] = chave;
+                posicoesIndice[pos] = i;
+            }
         }
+    };
+    if (layout == LayoutCSR::Intercalado) inserir(obterVisaoIntercalada());
+    else inserir(obterVisaoSeparada());
+
+    grauMinimoIndice = grauMinimo;
+    bitsIndice = bits;
+}
+
+int VetorAdjacenciaPesada::buscarNoIndiceHash(int u, int v) const {
+    const uint64_t chave = chavePar(u, v);
+    const size_t mascara = chavesIndice.size() - 1;
+    for (size_t pos = hashPar(chave, bitsIndice); chavesIndice[pos] != 0; pos = (pos + 1) & mascara) {
+        if (chavesIndice[pos] == chave) return posicoesIndice[pos];
     }
-    return std::numeric_limits<double>::infinity();
+    return -1;
+}
+
+LayoutCSR VetorAdjacenciaPesada::obterLayout() const {
+    return layout;
+}
+
+VisaoCSRIntercalada VetorAdjacenciaPesada::obterVisaoIntercalada() const {
+    return { ponteirosInicio.data(), listaArestas.data() };
+}
+
+VisaoCSRSeparada VetorAdjacenciaPesada::obterVisaoSeparada() const {
+    return { ponteirosInicio.data(), listaVizinhos.data(), listaPesos.data() };
 }
\ No newline at end of file
@@ -1,14 +1,10 @@
 #pragma once
 
 #include "representacaoPesada.h" 
+#include "LayoutCSR.h"
 #include <vector>
 #include <utility> // Para std::pair
 
-struct ArestaComPeso {
-    int u, v;
-    double peso;
-};
-
 /**
  * @class VetorAdjacenciaPesada
  * @brief Implementação CSR otimizada para grafos COM PESOS, direcionados ou não.
@@ -20,13 +16,23 @@ public:
      * @param numeroDeVertices O número total de vértices que o grafo terá.
      * @param direcionado Indica se o grafo é direcionado (default false).
      * @param transposto Indica se as arestas devem ser invertidas na carga (default false).
+     * @param layout Organização das arestas em memória (default: registros intercalados).
      */
-    explicit VetorAdjacenciaPesada(int numeroDeVertices, bool direcionado = false, bool transposto = false);
+    explicit VetorAdjacenciaPesada(int numeroDeVertices, bool direcionado = false, bool transposto = false,
+        LayoutCSR layout = LayoutCSR::Intercalado);
 
     ~VetorAdjacenciaPesada() override = default;
 
     // --- Implementação dos Métodos Virtuais ---
     void adicionarArestaComPeso(int u, int v, double w) override;
+
+    /**
+     * @brief Adiciona um lote de arestas de uma vez, assumindo o vetor.
+     * @details Mesma validação e inversão de adicionarArestaComPeso, feitas no próprio
+     * vetor; se ainda não houver arestas, ele passa a ser o buffer de construção sem cópia.
+     * Usado na construção direta a partir dos geradores sintéticos.
+     */
+    void adicionarArestasComPeso(std::vector<ArestaComPeso>&& arestas);
     std::vector<VizinhoComPeso> obterVizinhosComPesos(int vertice) const override;
     double obterPesoAresta(int u, int v) const override;
     void paraCadaVizinhoComPeso(int u, const std::function<void(int v, double w)>& fn) const override;
@@ -35,16 +41,78 @@ public:
     std::vector<int> obterVizinhos(int vertice) const override;
     void finalizarConstrucao() override;
 
+    // --- Acesso direto ao CSR (para algoritmos especializados por layout) ---
+
+    /**
+     * @brief Informa o layout escolhido na construção.
+     */
+    LayoutCSR obterLayout() const;
+
+    /**
+     * @brief Visão do CSR intercalado (válida após finalizarConstrucao e só nesse layout).
+     */
+    VisaoCSRIntercalada obterVisaoIntercalada() const;
+
+    /**
+     * @brief Visão do CSR separado (válida após finalizarConstrucao e só nesse layout).
+     */
+    VisaoCSRSeparada obterVisaoSeparada() const;
+
+    // --- Consultas de peso ---
+
+    /**
+     * @brief Obtém os pesos de vários pares (u, v) de uma vez.
+     * @details As consultas são agrupadas por origem (ordenação por contagem) e, dentro de
+     * cada origem, ordenadas por destino; cada grupo percorre a lista de vizinhos uma única
+     * vez, avançando por galope a partir da última posição encontrada.
+     * Mesma semântica de obterPesoAresta para cada par.
+     * @param pares Pares (u, v) consultados (1-based).
+     * @return Os pesos, na mesma ordem de 'pares'.
+     * @throws std::out_of_range se algum vértice for inválido.
+     */
+    std::vector<double> obterPesosArestas(const std::vector<std::pair<int, int>>& pares) const;
+
+    /**
+     * @brief Constrói um índice hash (u, v) -> aresta para os vértices de grau >= grauMinimo.
+     * @details Opcional: sem ele, obterPesoAresta já faz busca binária (O(log grau)); o índice
+     * troca ~12 bytes por aresta indexada por O(1) esperado nos vértices de grau alto.
+     * Chamar após finalizarConstrucao e fora de consultas concorrentes.
+     * @param grauMinimo Grau a partir do qual o vértice entra no índice (<= 0 remove o índice).
+     */
+    void construirIndiceHash(int grauMinimo = 256);
+
 private:
+    /**
+     * @brief Posição da aresta (u, v) no CSR pelo índice hash, ou -1 se não estiver lá.
+     */
+    int buscarNoIndiceHash(int u, int v) const;
+
+    /**
+     * @brief Despacha para a visão do layout ativo (usado pelos métodos virtuais).
+     */
+    template <class Funcao>
+    void paraCadaVizinhoInterno(int u, Funcao&& fn) const {
+        if (layout == LayoutCSR::Intercalado) obterVisaoIntercalada().paraCadaVizinho(u, fn);
+        else obterVisaoSeparada().paraCadaVizinho(u, fn);
+    }
+
     int numeroDeVertices;
     int numeroDeArestas;
     bool ehDirecionado;
     bool ehTransposto; // Novo campo para controlar a inversão
+    LayoutCSR layout;
 
-    // Estrutura principal do CSR
+    // Estrutura principal do CSR (apenas os vetores do layout escolhido são preenchidos)
     std::vector<int> ponteirosInicio;
-    std::vector<int> listaVizinhos;
-    std::vector<double> listaPesos;
+    std::vector<ArestaCSR> listaArestas;   // Layout intercalado
+    std::vector<int32_t> listaVizinhos;    // Layout separado
+    std::vector<float> listaPesos;         // Layout separado
+
+    // Índice hash opcional dos vértices de grau alto (endereçamento aberto, sondagem linear)
+    int grauMinimoIndice = 0;              // 0 => índice desligado
+    int bitsIndice = 0;                    // Capacidade = 2^bitsIndice
+    std::vector<uint64_t> chavesIndice;    // (u << 32) | v; 0 marca posição vazia
+    std::vector<int> posicoesIndice;       // Posição da aresta correspondente no CSR
 
     // Buffers temporários
     std::vector<int> grausTemporarios;
@@ -3,6 +3,7 @@
 #include "representacao.h" // Inclui a interface base do TP1
 #include <vector>
 #include <functional> // Para std::function
+#include "../../../comum/ArestaComPeso.h"
 
 // Estrutura para retornar vizinhos com pesos (pode vir de um .h comum depois)
 struct VizinhoComPeso {
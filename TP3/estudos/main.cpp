@@ -22,32 +22,36 @@
 #include "../biblioteca/interface/GrafoPesado.h"
 #include "../biblioteca/algoritmos/BellmanFord.h"
 #include "../biblioteca/algoritmos/Dijkstra.h"
+#include "../biblioteca/algoritmos/ContractionHierarchies.h"
+#include "../biblioteca/algoritmos/BuscaALT.h"
+#include "../biblioteca/algoritmos/Johnson.h"
+#include "../biblioteca/algoritmos/FloydWarshall.h"
+#include "../../comum/Benchmark.h"
 
 // --- Constantes ---
 const int NUM_RODADAS_BELLMAN = 10; // Conforme especificado no estudo de caso 2
+const int NUM_RODADAS_AQUECIMENTO = 1;          // Execuções descartadas antes da medição
+const unsigned long long SEMENTE_ORIGENS = 42;  // Origens aleatórias reprodutíveis
 const double infinity = std::numeric_limits<double>::infinity();
 
-// Estrutura para métricas de tempo
-struct MetricasTempo {
-    double tempoTotal = 0.0;
-    double tempoMedio = 0.0;
-    double tempoMin = infinity;
-    double tempoMax = 0.0;
-    double desvioPadrao = 0.0;
-};
-
 // --- Protótipos ---
 void executarEstudoCaso1_DistanciasEspecificas();
 void executarEstudoCaso2_BenchmarkBellmanFord();
 void executarEstudoCaso3_GrafoTransposto(); // <-- NOVO
 void executarModoInterativo();
 void menuAnaliseGrafo(GrafoPesado& grafo, const std::string& nomeGrafo);
+void executarConsultasCH(const GrafoPesado& grafo, const std::string& nomeGrafo);
+void executarConsultasALT(const GrafoPesado& grafo);
+void executarJohnson(const GrafoPesado& grafo, const std::string& nomeGrafo);
+void executarFloydWarshall(const GrafoPesado& grafo);
 
 // Auxiliares
 std::string caminhoEstudos(const std::string& nomeArquivo);
 std::vector<int> reconstruirCaminho(const std::vector<int>& pai, int origem, int destino);
 std::string formatarCaminho(const std::vector<int>& caminho);
+std::string formatarCiclo(const std::vector<int>& ciclo);
 void pausar();
+EstatisticasTempo estatisticasEmSegundos(const std::vector<double>& temposMs);
 
 // --- MAIN ---
 int main() {
@@ -140,7 +144,7 @@ void executarEstudoCaso1_DistanciasEspecificas() {
                 }
 
                 if (resultado.temCicloNegativo) {
-                    distStr += " (Ciclo Negativo)";
+                    distStr += " (Ciclo Negativo: " + formatarCiclo(resultado.cicloNegativo) + ")";
                 }
 
                 arquivoCSV << nomeGrafo << "," << origem << "," << destino << "," << distStr << ",\"" << caminhoStr << "\"\n";
@@ -171,7 +175,7 @@ void executarEstudoCaso2_BenchmarkBellmanFord() {
         std::cerr << "Erro ao criar arquivo CSV.\n";
         return;
     }
-    arquivoCSV << "Grafo,Algoritmo,Direcionado,NumRodadas,TempoTotal_s,TempoMedio_s,TempoMin_s,TempoMax_s,DesvioPadrao_s\n";
+    arquivoCSV << "Grafo,Algoritmo,Direcionado,NumRodadas,TempoTotal_s,TempoMedio_s,TempoMin_s,TempoMax_s,DesvioPadrao_s,TempoMediana_s,TempoP90_s,TempoP99_s,Outliers\n";
     arquivoCSV << std::fixed << std::setprecision(6);
 
     std::vector<std::string> grafos = {
@@ -181,44 +185,33 @@ void executarEstudoCaso2_BenchmarkBellmanFord() {
     bool ehDirecionado = true; // Assumindo direcionado para o teste
     int origemFixa = 10; // Vértice fixo para o teste de tempo (ou poderia ser aleatório)
 
+    // Versão clássica (V-1 passagens), versão com fila (SPFA + SLF/LLL) e versão paralela por arestas
+    const std::vector<std::string> algoritmos = { "BellmanFord", "SPFA", "BellmanFordParalelo" };
+
     for (const auto& nomeGrafo : grafos) {
-        std::cout << "Benchmarking " << nomeGrafo << "..." << std::flush;
         try {
             std::string caminho = caminhoEstudos(nomeGrafo);
             GrafoPesado grafo(caminho, ehDirecionado);
             BellmanFord bf;
 
-            std::vector<double> tempos;
-            tempos.reserve(NUM_RODADAS_BELLMAN);
+            for (const auto& algoritmo : algoritmos) {
+                std::cout << "Benchmarking " << nomeGrafo << " (" << algoritmo << ")..." << std::flush;
 
-            for (int i = 0; i < NUM_RODADAS_BELLMAN; ++i) {
-                auto inicio = std::chrono::high_resolution_clock::now();
+                std::vector<double> temposMs = medirExecucoes(NUM_RODADAS_AQUECIMENTO, NUM_RODADAS_BELLMAN, [&](int) {
+                    if (algoritmo == "SPFA") bf.executarFila(grafo, origemFixa);
+                    else if (algoritmo == "BellmanFordParalelo") bf.executarParalelo(grafo, origemFixa);
+                    else bf.executar(grafo, origemFixa);
+                });
+                EstatisticasTempo e = estatisticasEmSegundos(temposMs);
 
-                // Executa o algoritmo
-                bf.executar(grafo, origemFixa);
+                // Salvar no CSV
+                arquivoCSV << nomeGrafo << "," << algoritmo << "," << (ehDirecionado ? "Sim" : "Nao") << ","
+                    << NUM_RODADAS_BELLMAN << "," << e.total << "," << e.media << ","
+                    << e.minimo << "," << e.maximo << "," << e.desvioPadrao << ","
+                    << e.mediana << "," << e.p90 << "," << e.p99 << "," << e.outliers << "\n";
 
-                auto fim = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<double> duracao = fim - inicio; // em segundos
-                tempos.push_back(duracao.count());
+                std::cout << " OK (Media: " << e.media << "s)\n";
             }
-
-            // Cálculos Estatísticos
-            double soma = std::accumulate(tempos.begin(), tempos.end(), 0.0);
-            double media = soma / NUM_RODADAS_BELLMAN;
-            double min = *std::min_element(tempos.begin(), tempos.end());
-            double max = *std::max_element(tempos.begin(), tempos.end());
-
-            double somaQuad = 0.0;
-            for (double t : tempos) somaQuad += (t - media) * (t - media);
-            double desvio = std::sqrt(somaQuad / NUM_RODADAS_BELLMAN);
-
-            // Salvar no CSV
-            arquivoCSV << nomeGrafo << ",BellmanFord," << (ehDirecionado ? "Sim" : "Nao") << ","
-                << NUM_RODADAS_BELLMAN << "," << soma << "," << media << ","
-                << min << "," << max << "," << desvio << "\n";
-
-            std::cout << " OK (Media: " << media << "s)\n";
-
         }
         catch (const std::exception& e) {
             std::cerr << " Erro: " << e.what() << "\n";
@@ -253,7 +246,7 @@ void executarEstudoCaso3_GrafoTransposto() {
         std::cerr << "Erro ao criar CSV de tempo.\n";
         return;
     }
-    csvTempo << "Grafo,Algoritmo,NumExecucoes,TempoTotal_s,TempoMedio_s,TempoMin_s,TempoMax_s,DesvioPadrao_s\n";
+    csvTempo << "Grafo,Algoritmo,NumExecucoes,TempoTotal_s,TempoMedio_s,TempoMin_s,TempoMax_s,DesvioPadrao_s,TempoMediana_s,TempoP90_s,TempoP99_s,Outliers\n";
     csvTempo << std::fixed << std::setprecision(6);
 
     // Grafos a serem analisados
@@ -309,39 +302,19 @@ void executarEstudoCaso3_GrafoTransposto() {
             // --- PARTE 2: Benchmark de Tempo ---
             std::cout << "  [2/2] Executando benchmark (" << numExecucoesBenchmark << " rodadas)..." << std::flush;
 
-            // Gerador de números aleatórios
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_int_distribution<> distrib(1, grafo.obterNumeroVertices());
-
-            std::vector<double> tempos;
-            tempos.reserve(numExecucoesBenchmark);
-
-            for (int i = 0; i < numExecucoesBenchmark; ++i) {
-                int origemAleatoria = distrib(gen);
-
-                auto inicio = std::chrono::high_resolution_clock::now();
-                dij.executarHeap(grafo, origemAleatoria);
-                auto fim = std::chrono::high_resolution_clock::now();
-
-                std::chrono::duration<double> duracao = fim - inicio; // Segundos
-                tempos.push_back(duracao.count());
-            }
-
-            // Cálculos Estatísticos
-            double soma = std::accumulate(tempos.begin(), tempos.end(), 0.0);
-            double media = soma / numExecucoesBenchmark;
-            double min = *std::min_element(tempos.begin(), tempos.end());
-            double max = *std::max_element(tempos.begin(), tempos.end());
-
-            double somaQuad = 0.0;
-            for (double t : tempos) somaQuad += (t - media) * (t - media);
-            double desvio = (numExecucoesBenchmark > 1) ? std::sqrt(somaQuad / (numExecucoesBenchmark - 1)) : 0.0;
+            // Origens aleatórias com semente fixa (reprodutíveis entre execuções do estudo)
+            std::vector<int> origens = sortearOrigens(grafo.obterNumeroVertices(),
+                NUM_RODADAS_AQUECIMENTO + numExecucoesBenchmark, SEMENTE_ORIGENS);
+            std::vector<double> temposMs = medirExecucoes(NUM_RODADAS_AQUECIMENTO, numExecucoesBenchmark, [&](int k) {
+                dij.executarHeap(grafo, origens[k]);
+            });
+            EstatisticasTempo e = estatisticasEmSegundos(temposMs);
 
             csvTempo << nomeGrafo << ",DijkstraHeap_Transposto," << numExecucoesBenchmark << ","
-                << soma << "," << media << "," << min << "," << max << "," << desvio << "\n";
+                << e.total << "," << e.media << "," << e.minimo << "," << e.maximo << "," << e.desvioPadrao << ","
+                << e.mediana << "," << e.p90 << "," << e.p99 << "," << e.outliers << "\n";
 
-            std::cout << " OK (Media: " << media << "s)\n";
+            std::cout << " OK (Media: " << e.media << "s)\n";
 
         }
         catch (const std::exception& e) {
@@ -385,13 +358,19 @@ void executarModoInterativo() {
         }
         bool transposto = (transpOpt == 1);
 
+        // Layout das arestas no CSR
+        int layoutOpt;
+        std::cout << "Layout do CSR (1-Intercalado {id, peso} / 2-Separado): ";
+        std::cin >> layoutOpt;
+        LayoutCSR layout = (layoutOpt == 2) ? LayoutCSR::Separado : LayoutCSR::Intercalado;
+
 
         try {
             std::cout << "Carregando " << nomeGrafo << (transposto ? " [TRANSPOSTO]" : "") << "..." << std::endl;
             std::string caminho = caminhoEstudos(nomeGrafo);
 
-            // Usa o novo construtor com parâmetro 'direcionado' e 'transposto'
-            GrafoPesado grafo(caminho, direcionado, transposto);
+            // Usa o novo construtor com parâmetro 'direcionado', 'transposto' e o layout do CSR
+            GrafoPesado grafo(caminho, direcionado, transposto, layout);
 
             std::cout << "Grafo carregado com sucesso!\n";
             if (grafo.temPesoNegativo()) std::cout << "AVISO: Grafo contem pesos negativos.\n";
@@ -414,6 +393,11 @@ void menuAnaliseGrafo(GrafoPesado& grafo, const std::string& nomeGrafo) {
         std::cout << "1. Exibir Informacoes Basicas\n";
         std::cout << "2. Executar Bellman-Ford\n";
         std::cout << "3. Executar Dijkstra (Se possivel)\n";
+        std::cout << "4. Consultas Ponto-a-Ponto (Contraction Hierarchies)\n";
+        std::cout << "5. Consultas Ponto-a-Ponto (A* com Landmarks - ALT)\n";
+        std::cout << "6. Encontrar Ciclos Negativos (todo o grafo)\n";
+        std::cout << "7. Distancias de Varias Origens (Johnson, aceita pesos negativos)\n";
+        std::cout << "8. Distancias entre Todos os Pares (Floyd-Warshall, grafos pequenos)\n";
         std::cout << "0. Voltar\n";
         std::cout << "Escolha: ";
         std::cin >> opc;
@@ -428,15 +412,22 @@ void menuAnaliseGrafo(GrafoPesado& grafo, const std::string& nomeGrafo) {
             std::cout << "Vertice de origem: ";
             std::cin >> origem;
             try {
+                std::cout << "Variante (1 = Classica, 2 = Fila/SPFA, 3 = Paralela): ";
+                int variante; std::cin >> variante;
                 BellmanFord bf;
                 auto inicio = std::chrono::high_resolution_clock::now();
-                auto res = bf.executar(grafo, origem);
+                auto res = (variante == 2) ? bf.executarFila(grafo, origem)
+                    : (variante == 3) ? bf.executarParalelo(grafo, origem)
+                    : bf.executar(grafo, origem);
                 auto fim = std::chrono::high_resolution_clock::now();
 
                 std::cout << "Bellman-Ford concluido em "
                     << std::chrono::duration<double, std::milli>(fim - inicio).count() << " ms.\n";
 
-                if (res.temCicloNegativo) std::cout << "ALERTA: Ciclo negativo detectado!\n";
+                if (res.temCicloNegativo) {
+                    std::cout << "ALERTA: Ciclo negativo detectado!\n";
+                    std::cout << "Ciclo: " << formatarCiclo(res.cicloNegativo) << "\n";
+                }
 
                 std::cout << "Mostrar distancia para um destino (0 para nenhum): ";
                 int dest; std::cin >> dest;
@@ -472,11 +463,251 @@ void menuAnaliseGrafo(GrafoPesado& grafo, const std::string& nomeGrafo) {
                 }
             }
         }
+        else if (opc == 4) {
+            try {
+                executarConsultasCH(grafo, nomeGrafo);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Erro: " << e.what() << "\n";
+            }
+        }
+        else if (opc == 5) {
+            try {
+                executarConsultasALT(grafo);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Erro: " << e.what() << "\n";
+            }
+        }
+        else if (opc == 6) {
+            BellmanFord bf;
+            auto inicio = std::chrono::high_resolution_clock::now();
+            auto ciclos = bf.encontrarCiclosNegativos(grafo);
+            auto fim = std::chrono::high_resolution_clock::now();
+
+            std::cout << ciclos.size() << " ciclo(s) negativo(s) disjunto(s) encontrado(s) em "
+                << std::chrono::duration<double, std::milli>(fim - inicio).count() << " ms.\n";
+            for (size_t i = 0; i < ciclos.size() && i < 20; ++i) {
+                std::cout << "  " << formatarCiclo(ciclos[i]) << "\n";
+            }
+            if (ciclos.size() > 20) std::cout << "  ... (" << ciclos.size() - 20 << " omitidos)\n";
+        }
+        else if (opc == 7) {
+            try {
+                executarJohnson(grafo, nomeGrafo);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Erro: " << e.what() << "\n";
+            }
+        }
+        else if (opc == 8) {
+            try {
+                executarFloydWarshall(grafo);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Erro: " << e.what() << "\n";
+            }
+        }
 
         if (opc != 0) pausar();
     }
 }
 
+/**
+ * @brief Constrói (ou carrega do disco) o índice CH do grafo e responde consultas origem -> destino.
+ * @details O índice é salvo ao lado do executável com o nome do grafo, então a partir da
+ * segunda vez o pré-processamento é pulado. Cada consulta é comparada com o Dijkstra (Heap).
+ */
+void executarConsultasCH(const GrafoPesado& grafo, const std::string& nomeGrafo) {
+    if (grafo.temPesoNegativo()) {
+        std::cout << "Erro: Grafo tem pesos negativos. Contraction Hierarchies nao aplicavel.\n";
+        return;
+    }
+
+    std::string arquivoIndice = "indice_ch_" + nomeGrafo
+        + (grafo.consultaDirecionado() ? "_dir" : "") + (grafo.consultaTransposto() ? "_transp" : "") + ".bin";
+
+    ContractionHierarchies ch;
+    auto inicio = std::chrono::high_resolution_clock::now();
+    if (std::filesystem::exists(arquivoIndice)) {
+        ch.carregarIndice(arquivoIndice);
+    }
+    if (!ch.estaPronto() || ch.obterNumeroVertices() != grafo.obterNumeroVertices()) {
+        std::cout << "Pre-processando Contraction Hierarchies..." << std::flush;
+        ch.preprocessar(grafo);
+        ch.salvarIndice(arquivoIndice);
+        std::cout << " OK (" << ch.obterNumeroAtalhos() << " atalhos, salvo em '" << arquivoIndice << "').\n";
+    }
+    auto fim = std::chrono::high_resolution_clock::now();
+    std::cout << "Indice pronto em " << std::chrono::duration<double>(fim - inicio).count() << " s.\n";
+
+    while (true) {
+        int origem, destino;
+        std::cout << "Origem e destino (0 0 para sair): ";
+        std::cin >> origem >> destino;
+        if (std::cin.fail() || origem == 0 || destino == 0) {
+            std::cin.clear();
+            break;
+        }
+        if (origem < 1 || destino < 1 || origem > grafo.obterNumeroVertices() || destino > grafo.obterNumeroVertices()) {
+            std::cout << "Vertice invalido.\n";
+            continue;
+        }
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        ResultadoConsultaCH res = ch.consultar(origem, destino);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        Dijkstra dij;
+        auto resDij = dij.executarHeap(grafo, origem);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Distancia (CH): " << res.distancia << " | Distancia (Dijkstra): " << resDij.dist[destino] << "\n";
+        std::cout << "Caminho: " << formatarCaminho(res.caminho) << "\n";
+        std::cout << "Tempo CH: " << std::chrono::duration<double, std::micro>(t1 - t0).count() << " us | "
+            << "Tempo Dijkstra: " << std::chrono::duration<double, std::micro>(t2 - t1).count() << " us\n";
+    }
+}
+
+/**
+ * @brief Escolhe os landmarks do ALT e responde consultas origem -> destino.
+ * @details Cada consulta é comparada com o Dijkstra (Heap), mostrando também quantos
+ * vértices cada busca precisou finalizar.
+ */
+void executarConsultasALT(const GrafoPesado& grafo) {
+    if (grafo.temPesoNegativo()) {
+        std::cout << "Erro: Grafo tem pesos negativos. ALT nao aplicavel.\n";
+        return;
+    }
+
+    int numLandmarks;
+    std::cout << "Numero de landmarks (ex: 8): ";
+    std::cin >> numLandmarks;
+
+    BuscaALT alt;
+    auto inicio = std::chrono::high_resolution_clock::now();
+    alt.preprocessar(grafo, numLandmarks);
+    auto fim = std::chrono::high_resolution_clock::now();
+    std::cout << "Landmarks escolhidos em " << std::chrono::duration<double>(fim - inicio).count() << " s:";
+    for (int l : alt.obterLandmarks()) std::cout << " " << l;
+    std::cout << "\n";
+
+    while (true) {
+        int origem, destino;
+        std::cout << "Origem e destino (0 0 para sair): ";
+        std::cin >> origem >> destino;
+        if (std::cin.fail() || origem == 0 || destino == 0) {
+            std::cin.clear();
+            break;
+        }
+        if (origem < 1 || destino < 1 || origem > grafo.obterNumeroVertices() || destino > grafo.obterNumeroVertices()) {
+            std::cout << "Vertice invalido.\n";
+            continue;
+        }
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        ResultadoALT res = alt.consultar(origem, destino);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        Dijkstra dij;
+        auto resDij = dij.executarHeap(grafo, origem);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Distancia (ALT): " << res.distancia << " | Distancia (Dijkstra): " << resDij.dist[destino] << "\n";
+        std::cout << "Caminho: " << formatarCaminho(res.caminho) << "\n";
+        std::cout << "Vertices finalizados (ALT): " << res.verticesFinalizados << " de " << grafo.obterNumeroVertices() << "\n";
+        std::cout << "Tempo ALT: " << std::chrono::duration<double, std::micro>(t1 - t0).count() << " us | "
+            << "Tempo Dijkstra: " << std::chrono::duration<double, std::micro>(t2 - t1).count() << " us\n";
+    }
+}
+
+/**
+ * @brief Calcula com Johnson as distâncias de várias origens e grava a matriz em arquivo binário.
+ * @details As origens são 1..k (ou todas). Depois da gravação, permite consultar
+ * pares origem/destino lendo as linhas direto do arquivo.
+ */
+void executarJohnson(const GrafoPesado& grafo, const std::string& nomeGrafo) {
+    const int n = grafo.obterNumeroVertices();
+    int quantidade;
+    std::cout << "Quantidade de origens (1..k; 0 para todas as " << n << "): ";
+    std::cin >> quantidade;
+    if (quantidade <= 0 || quantidade > n) quantidade = n;
+
+    std::vector<int> origens(quantidade);
+    std::iota(origens.begin(), origens.end(), 1);
+    std::string arquivoDistancias = "distancias_johnson_" + nomeGrafo
+        + (grafo.consultaDirecionado() ? "_dir" : "") + (grafo.consultaTransposto() ? "_transp" : "") + ".bin";
+
+    Johnson johnson;
+    auto inicio = std::chrono::high_resolution_clock::now();
+    johnson.preparar(grafo);
+    auto meio = std::chrono::high_resolution_clock::now();
+    johnson.salvarDistancias(origens, arquivoDistancias);
+    auto fim = std::chrono::high_resolution_clock::now();
+
+    std::cout << "Potenciais (Bellman-Ford): " << std::chrono::duration<double>(meio - inicio).count() << " s | "
+        << "Dijkstra de " << quantidade << " origens: " << std::chrono::duration<double>(fim - meio).count() << " s\n";
+    std::cout << "Distancias salvas em '" << arquivoDistancias << "'.\n";
+
+    while (true) {
+        int origem, destino;
+        std::cout << "Origem (1.." << quantidade << ") e destino (0 0 para sair): ";
+        std::cin >> origem >> destino;
+        if (std::cin.fail() || origem == 0 || destino == 0) {
+            std::cin.clear();
+            break;
+        }
+        if (origem < 1 || origem > quantidade || destino < 1 || destino > n) {
+            std::cout << "Vertice invalido.\n";
+            continue;
+        }
+        auto linha = Johnson::lerLinhaDistancias(arquivoDistancias, origem);
+        std::cout << "Distancia: " << linha[destino] << "\n";
+    }
+}
+
+/**
+ * @brief Calcula com Floyd-Warshall (em blocos) a matriz de distâncias de todos os pares.
+ * @details A matriz ocupa 4 bytes por par (8 com predecessores), então o grafo é
+ * recusado acima de 20000 vértices. Depois do cálculo, responde consultas de pares.
+ */
+void executarFloydWarshall(const GrafoPesado& grafo) {
+    const int n = grafo.obterNumeroVertices();
+    if (n > 20000) {
+        std::cout << "Grafo grande demais para a matriz V x V (" << n << " vertices). Use Johnson (opcao 7).\n";
+        return;
+    }
+    char resposta;
+    std::cout << "Guardar predecessores para reconstruir caminhos? (s/n): ";
+    std::cin >> resposta;
+    const bool comPredecessores = (resposta == 's' || resposta == 'S');
+
+    FloydWarshall fw;
+    auto inicio = std::chrono::high_resolution_clock::now();
+    fw.executar(grafo, comPredecessores);
+    auto fim = std::chrono::high_resolution_clock::now();
+    std::cout << "Floyd-Warshall: " << std::chrono::duration<double>(fim - inicio).count() << " s\n";
+
+    if (fw.temCicloNegativo()) {
+        std::cout << "O grafo contem ciclo negativo: as distancias nao sao validas.\n";
+        return;
+    }
+
+    while (true) {
+        int origem, destino;
+        std::cout << "Origem e destino (0 0 para sair): ";
+        std::cin >> origem >> destino;
+        if (std::cin.fail() || origem == 0 || destino == 0) {
+            std::cin.clear();
+            break;
+        }
+        if (origem < 1 || origem > n || destino < 1 || destino > n) {
+            std::cout << "Vertice invalido.\n";
+            continue;
+        }
+        std::cout << "Distancia: " << fw.obterDistancia(origem, destino) << "\n";
+        if (comPredecessores) std::cout << "Caminho: " << formatarCaminho(fw.obterCaminho(origem, destino)) << "\n";
+    }
+}
+
 // --- Funções Auxiliares ---
 
 // --- Função Utilitária para Caminhos ---
@@ -505,6 +736,15 @@ void pausar() {
     std::cin.get();
 }
 
+/**
+ * @brief Estatísticas de uma amostra medida em ms, convertidas para segundos (unidade dos CSV do TP3).
+ */
+EstatisticasTempo estatisticasEmSegundos(const std::vector<double>& temposMs) {
+    std::vector<double> temposS(temposMs.size());
+    std::transform(temposMs.begin(), temposMs.end(), temposS.begin(), [](double t) { return t / 1000.0; });
+    return calcularEstatisticasTempo(std::move(temposS));
+}
+
 std::vector<int> reconstruirCaminho(const std::vector<int>& pai, int origem, int destino) {
     std::vector<int> caminho;
     if (destino == -1 || pai[destino] == -1) return caminho; // Inalcançável
@@ -528,4 +768,12 @@ std::string formatarCaminho(const std::vector<int>& caminho) {
         if (i < caminho.size() - 1) s += " -> ";
     }
     return s;
+}
+
+// Formata um ciclo repetindo o primeiro vértice no final (ex: 3 -> 7 -> 5 -> 3)
+std::string formatarCiclo(const std::vector<int>& ciclo) {
+    if (ciclo.empty()) return "Nao identificado";
+    std::vector<int> fechado(ciclo);
+    fechado.push_back(ciclo.front());
+    return formatarCaminho(fechado);
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+/**
+ * @file ArestaComPeso.h
+ * @brief Aresta (u, v) com peso, comum às representações pesadas do TP2 e do TP3.
+ * @details É o formato em que as arestas ficam entre a leitura do arquivo (ou a geração,
+ * em Geradores.h) e a montagem da representação.
+ */
+
+struct ArestaComPeso {
+    int u, v;
+    double peso;
+};
@@ -0,0 +1,374 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementação das estatísticas, do sorteio de origens e da comparação com a base.
+ */
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+    /**
+     * @brief Valor crítico bicaudal de 95% da distribuição t de Student.
+     */
+    double valorCriticoT95(int grausLiberdade) {
+        static const double TABELA[] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        if (grausLiberdade <= 0) return 0.0;
+        if (grausLiberdade <= 30) return TABELA[grausLiberdade - 1];
+        if (grausLiberdade <= 40) return 2.021;
+        if (grausLiberdade <= 60) return 2.000;
+        if (grausLiberdade <= 120) return 1.980;
+        return 1.960;
+    }
+
+    /**
+     * @brief Valor p bicaudal do teste U de Mann-Whitney (aproximação normal).
+     * @details Postos médios para empates, correção de empates na variância e
+     * correção de continuidade. Retorna 1 quando a variância é nula (amostras iguais).
+     */
+    double valorPMannWhitney(const std::vector<double>& a, const std::vector<double>& b) {
+        const size_t n1 = a.size(), n2 = b.size(), n = n1 + n2;
+        std::vector<std::pair<double, int>> todos;
+        todos.reserve(n);
+        for (double x : a) todos.push_back({ x, 0 });
+        for (double x : b) todos.push_back({ x, 1 });
+        std::sort(todos.begin(), todos.end());
+
+        double somaPostosA = 0.0, somaEmpates = 0.0;
+        for (size_t i = 0; i < n;) {
+            size_t j = i;
+            while (j < n && todos[j].first == todos[i].first) ++j;
+            const double postoMedio = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+            const double t = static_cast<double>(j - i);
+            somaEmpates += t * t * t - t;
+            for (size_t k = i; k < j; ++k) {
+                if (todos[k].second == 0) somaPostosA += postoMedio;
+            }
+            i = j;
+        }
+
+        const double dn1 = static_cast<double>(n1), dn2 = static_cast<double>(n2), dn = static_cast<double>(n);
+        const double u = somaPostosA - dn1 * (dn1 + 1.0) / 2.0;
+        const double media = dn1 * dn2 / 2.0;
+        const double variancia = dn1 * dn2 / 12.0 * ((dn + 1.0) - somaEmpates / (dn * (dn - 1.0)));
+        if (variancia <= 0.0) return 1.0;
+        const double z = std::max(0.0, std::abs(u - media) - 0.5) / std::sqrt(variancia);
+        return std::erfc(z / std::sqrt(2.0));
+    }
+
+    /**
+     * @brief Leitor JSON mínimo (objetos, vetores, textos, números, true/false/null).
+     * @details Suficiente para os arquivos gerados pelo executor de benchmarks; não
+     * valida escapes \u além de pular os quatro dígitos.
+     */
+    struct ValorJSON {
+        enum class Tipo { Nulo, Booleano, Numero, Texto, Vetor, Objeto } tipo = Tipo::Nulo;
+        double numero = 0.0;
+        std::string texto;
+        std::vector<ValorJSON> itens;
+        std::vector<std::pair<std::string, ValorJSON>> membros;
+
+        const ValorJSON* membro(const std::string& nome) const {
+            for (const auto& [chave, valor] : membros) {
+                if (chave == nome) return &valor;
+            }
+            return nullptr;
+        }
+    };
+
+    class LeitorJSON {
+    public:
+        explicit LeitorJSON(const std::string& texto) : fonte(texto) {}
+
+        ValorJSON lerDocumento() {
+            ValorJSON valor = lerValor();
+            pularEspacos();
+            if (posicao != fonte.size()) falhar("conteudo apos o fim do documento");
+            return valor;
+        }
+
+    private:
+        const std::string& fonte;
+        size_t posicao = 0;
+
+        [[noreturn]] void falhar(const std::string& motivo) const {
+            throw std::runtime_error("JSON invalido (posicao " + std::to_string(posicao) + "): " + motivo);
+        }
+
+        void pularEspacos() {
+            while (posicao < fonte.size() && std::isspace(static_cast<unsigned char>(fonte[posicao]))) ++posicao;
+        }
+
+        void esperar(char c) {
+            pularEspacos();
+            if (posicao >= fonte.size() || fonte[posicao] != c) falhar(std::string("esperado '") + c + "'");
+            ++posicao;
+        }
+
+        bool consumir(char c) {
+            pularEspacos();
+            if (posicao < fonte.size() && fonte[posicao] == c) {
+                ++posicao;
+                return true;
+            }
+            return false;
+        }
+
+        std::string lerTexto() {
+            esperar('"');
+            std::string saida;
+            while (posicao < fonte.size() && fonte[posicao] != '"') {
+                char c = fonte[posicao++];
+                if (c == '\\') {
+                    if (posicao >= fonte.size()) break;
+                    char e = fonte[posicao++];
+                    switch (e) {
+                    case 'n': saida += '\n'; break;
+                    case 't': saida += '\t'; break;
+                    case 'r': saida += '\r'; break;
+                    case 'b': saida += '\b'; break;
+                    case 'f': saida += '\f'; break;
+                    case 'u': posicao = std::min(fonte.size(), posicao + 4); saida += '?'; break;
+                    default: saida += e;
+                    }
+                }
+                else saida += c;
+            }
+            if (posicao >= fonte.size()) falhar("texto sem fim");
+            ++posicao;
+            return saida;
+        }
+
+        ValorJSON lerValor() {
+            pularEspacos();
+            if (posicao >= fonte.size()) falhar("fim inesperado");
+            ValorJSON valor;
+            const char c = fonte[posicao];
+            if (c == '{') {
+                ++posicao;
+                valor.tipo = ValorJSON::Tipo::Objeto;
+                if (consumir('}')) return valor;
+                do {
+                    std::string chave = lerTexto();
+                    esperar(':');
+                    valor.membros.emplace_back(std::move(chave), lerValor());
+                } while (consumir(','));
+                esperar('}');
+            }
+            else if (c == '[') {
+                ++posicao;
+                valor.tipo = ValorJSON::Tipo::Vetor;
+                if (consumir(']')) return valor;
+                do {
+                    valor.itens.push_back(lerValor());
+                } while (consumir(','));
+                esperar(']');
+            }
+            else if (c == '"') {
+                valor.tipo = ValorJSON::Tipo::Texto;
+                valor.texto = lerTexto();
+            }
+            else if (fonte.compare(posicao, 4, "true") == 0 || fonte.compare(posicao, 5, "false") == 0) {
+                valor.tipo = ValorJSON::Tipo::Booleano;
+                valor.numero = (c == 't') ? 1.0 : 0.0;
+                posicao += (c == 't') ? 4 : 5;
+            }
+            else if (fonte.compare(posicao, 4, "null") == 0) {
+                posicao += 4;
+            }
+            else {
+                const char* inicio = fonte.c_str() + posicao;
+                char* fim = nullptr;
+                valor.tipo = ValorJSON::Tipo::Numero;
+                valor.numero = std::strtod(inicio, &fim);
+                if (fim == inicio) falhar("valor inesperado");
+                posicao += static_cast<size_t>(fim - inicio);
+            }
+            return valor;
+        }
+    };
+
+} // namespace
+
+double percentilOrdenado(const std::vector<double>& ordenados, double p) {
+    if (ordenados.empty()) return 0.0;
+    const double posicao = std::clamp(p, 0.0, 100.0) / 100.0 * static_cast<double>(ordenados.size() - 1);
+    const size_t abaixo = static_cast<size_t>(posicao);
+    const size_t acima = std::min(abaixo + 1, ordenados.size() - 1);
+    const double fracao = posicao - static_cast<double>(abaixo);
+    return ordenados[abaixo] + fracao * (ordenados[acima] - ordenados[abaixo]);
+}
+
+EstatisticasTempo calcularEstatisticasTempo(std::vector<double> tempos) {
+    EstatisticasTempo estatisticas;
+    if (tempos.empty()) return estatisticas;
+
+    std::sort(tempos.begin(), tempos.end());
+    const int n = static_cast<int>(tempos.size());
+    estatisticas.amostras = n;
+    estatisticas.total = std::accumulate(tempos.begin(), tempos.end(), 0.0);
+    estatisticas.media = estatisticas.total / n;
+    estatisticas.minimo = tempos.front();
+    estatisticas.maximo = tempos.back();
+    estatisticas.mediana = percentilOrdenado(tempos, 50.0);
+    estatisticas.p90 = percentilOrdenado(tempos, 90.0);
+    estatisticas.p99 = percentilOrdenado(tempos, 99.0);
+
+    double somaQuadrados = 0.0;
+    for (double t : tempos) somaQuadrados += (t - estatisticas.media) * (t - estatisticas.media);
+    estatisticas.desvioPadrao = (n > 1) ? std::sqrt(somaQuadrados / (n - 1)) : 0.0;
+
+    const double margem = valorCriticoT95(n - 1) * estatisticas.desvioPadrao / std::sqrt(static_cast<double>(n));
+    estatisticas.icInferior = estatisticas.media - margem;
+    estatisticas.icSuperior = estatisticas.media + margem;
+
+    const double q1 = percentilOrdenado(tempos, 25.0), q3 = percentilOrdenado(tempos, 75.0);
+    const double iqr = q3 - q1;
+    const double cercaInferior = q1 - 1.5 * iqr, cercaSuperior = q3 + 1.5 * iqr;
+    estatisticas.outliers = static_cast<int>(std::count_if(tempos.begin(), tempos.end(),
+        [&](double t) { return t < cercaInferior || t > cercaSuperior; }));
+    return estatisticas;
+}
+
+std::vector<int> sortearOrigens(int numVertices, size_t quantidade, unsigned long long semente) {
+    if (numVertices <= 0) throw std::runtime_error("Nao ha vertices para sortear origens.");
+    std::mt19937_64 gerador(semente);
+    std::vector<int> origens(quantidade);
+    for (auto& origem : origens) {
+        origem = 1 + static_cast<int>(gerador() % static_cast<uint64_t>(numVertices));
+    }
+    return origens;
+}
+
+std::string chaveResultado(const std::string& grafo, const std::string& representacao, const std::string& algoritmo) {
+    return grafo + "|" + representacao + "|" + algoritmo;
+}
+
+std::map<std::string, std::vector<double>> lerTemposBase(const std::string& caminhoArquivo) {
+    std::ifstream arquivo(caminhoArquivo);
+    if (!arquivo.is_open()) {
+        throw std::runtime_error("Nao foi possivel abrir o resultado base: " + caminhoArquivo);
+    }
+    std::stringstream conteudo;
+    conteudo << arquivo.rdbuf();
+    const std::string texto = conteudo.str();
+    const ValorJSON documento = LeitorJSON(texto).lerDocumento();
+
+    const ValorJSON* resultados = documento.membro("resultados");
+    if (!resultados || resultados->tipo != ValorJSON::Tipo::Vetor) {
+        throw std::runtime_error("Resultado base sem a lista \"resultados\": " + caminhoArquivo);
+    }
+
+    auto textoDe = [](const ValorJSON& item, const char* nome) {
+        const ValorJSON* v = item.membro(nome);
+        return (v && v->tipo == ValorJSON::Tipo::Texto) ? v->texto : std::string();
+    };
+
+    std::map<std::string, std::vector<double>> base;
+    for (const auto& item : resultados->itens) {
+        if (textoDe(item, "status") != "OK") continue;
+        std::vector<double> tempos;
+        if (const ValorJSON* lista = item.membro("tempos_ms"); lista && lista->tipo == ValorJSON::Tipo::Vetor) {
+            for (const auto& t : lista->itens) {
+                if (t.tipo == ValorJSON::Tipo::Numero) tempos.push_back(t.numero);
+            }
+        }
+        if (tempos.empty()) {
+            if (const ValorJSON* mediana = item.membro("tempo_mediana_ms"); mediana && mediana->tipo == ValorJSON::Tipo::Numero) {
+                tempos.push_back(mediana->numero);
+            }
+        }
+        if (!tempos.empty()) {
+            base[chaveResultado(textoDe(item, "grafo"), textoDe(item, "representacao"), textoDe(item, "algoritmo"))] = std::move(tempos);
+        }
+    }
+    return base;
+}
+
+ComparacaoBase compararComBase(const std::vector<double>& base, const std::vector<double>& atual, double limiar, double alfa) {
+    ComparacaoBase comparacao;
+    if (base.empty() || atual.empty()) return comparacao;
+
+    comparacao.disponivel = true;
+    comparacao.medianaBase = calcularEstatisticasTempo(base).mediana;
+    const double medianaAtual = calcularEstatisticasTempo(atual).mediana;
+    comparacao.variacao = (comparacao.medianaBase > 0.0) ? medianaAtual / comparacao.medianaBase - 1.0 : 0.0;
+
+    // Com um único valor na base não há distribuição para testar: vale só o limiar
+    bool significativo = true;
+    if (base.size() > 1 && atual.size() > 1) {
+        comparacao.valorP = valorPMannWhitney(base, atual);
+        significativo = comparacao.valorP < alfa;
+    }
+
+    if (significativo && comparacao.variacao > limiar) comparacao.veredito = "regressao";
+    else if (significativo && comparacao.variacao < -limiar) comparacao.veredito = "melhoria";
+    else comparacao.veredito = "estavel";
+    return comparacao;
+}
+
+const char* const COLUNAS_ESTATISTICAS_CSV =
+    "TempoTotal_ms,TempoMedio_ms,TempoMin_ms,TempoMax_ms,DesvioPadrao_ms,TempoMediana_ms,TempoP90_ms,TempoP99_ms,"
+    "IC95Inferior_ms,IC95Superior_ms,Outliers,MedianaBase_ms,Variacao,ValorP,Veredito";
+
+void escreverEstatisticasCSV(std::ostream& saida, const EstatisticasTempo& e, const ComparacaoBase& comparacao) {
+    saida << e.total << "," << e.media << "," << e.minimo << "," << e.maximo << "," << e.desvioPadrao << ","
+        << e.mediana << "," << e.p90 << "," << e.p99 << "," << e.icInferior << "," << e.icSuperior << "," << e.outliers << ",";
+    if (comparacao.disponivel) {
+        saida << comparacao.medianaBase << "," << comparacao.variacao << ",";
+        if (comparacao.valorP >= 0.0) saida << comparacao.valorP;
+        saida << "," << comparacao.veredito;
+    }
+    else saida << ",,,";
+}
+
+void escreverEstatisticasJSON(std::ostream& saida, const EstatisticasTempo& e, const ComparacaoBase& comparacao) {
+    saida << "\"tempo_total_ms\": " << e.total << ", \"tempo_medio_ms\": " << e.media
+        << ", \"tempo_min_ms\": " << e.minimo << ", \"tempo_max_ms\": " << e.maximo
+        << ", \"desvio_padrao_ms\": " << e.desvioPadrao << ", \"tempo_mediana_ms\": " << e.mediana
+        << ", \"tempo_p90_ms\": " << e.p90 << ", \"tempo_p99_ms\": " << e.p99
+        << ", \"ic95_ms\": [" << e.icInferior << ", " << e.icSuperior << "], \"outliers\": " << e.outliers;
+    if (comparacao.disponivel) {
+        saida << ", \"comparacao\": {\"mediana_base_ms\": " << comparacao.medianaBase
+            << ", \"variacao\": " << comparacao.variacao << ", \"valor_p\": ";
+        if (comparacao.valorP >= 0.0) saida << comparacao.valorP;
+        else saida << "null";
+        saida << ", \"veredito\": \"" << comparacao.veredito << "\"}";
+    }
+}
+
+std::string escaparJSON(const std::string& texto) {
+    std::string saida;
+    saida.reserve(texto.size() + 2);
+    for (char c : texto) {
+        switch (c) {
+        case '"': saida += "\\\""; break;
+        case '\\': saida += "\\\\"; break;
+        case '\n': saida += "\\n"; break;
+        case '\t': saida += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char codigo[8];
+                std::snprintf(codigo, sizeof(codigo), "\\u%04x", c);
+                saida += codigo;
+            }
+            else saida += c;
+        }
+    }
+    return saida;
+}
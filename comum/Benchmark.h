@@ -0,0 +1,130 @@
+#pragma once
+/**
+ * @file Benchmark.h
+ * @brief Utilitários de medição de tempo compartilhados pelos estudos e pelo executor de benchmarks.
+ * @details Centraliza o que antes cada estudo reimplementava: aquecimento, sorteio
+ * reprodutível das origens, estatísticas robustas (mediana, percentis, intervalo de
+ * confiança, outliers) e a comparação com um resultado anterior salvo em JSON.
+ */
+
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @struct EstatisticasTempo
+ * @brief Resumo de uma amostra de tempos (todos os valores na unidade das amostras).
+ * @details O desvio padrão é o amostral (n - 1). O intervalo de confiança é o de 95%
+ * para a média (t de Student). Outliers são contados pelas cercas de Tukey
+ * [Q1 - 1.5 IQR, Q3 + 1.5 IQR], mas continuam incluídos nas demais estatísticas.
+ */
+struct EstatisticasTempo {
+    int amostras = 0;
+    double total = 0.0, media = 0.0, desvioPadrao = 0.0, minimo = 0.0, maximo = 0.0;
+    double mediana = 0.0, p90 = 0.0, p99 = 0.0;
+    double icInferior = 0.0, icSuperior = 0.0;
+    int outliers = 0;
+};
+
+/**
+ * @struct ComparacaoBase
+ * @brief Resultado da comparação de uma amostra com a mesma medição de um resultado anterior.
+ * @details A significância vem do teste U de Mann-Whitney (aproximação normal, com
+ * correção de empates); valorP < 0 indica que a base não tinha os tempos individuais.
+ */
+struct ComparacaoBase {
+    bool disponivel = false;
+    double medianaBase = 0.0;
+    double variacao = 0.0;      ///< mediana atual / mediana base - 1 (positivo = mais lento)
+    double valorP = -1.0;
+    std::string veredito;       ///< "regressao", "melhoria" ou "estavel"
+};
+
+/**
+ * @brief Calcula as estatísticas de uma amostra de tempos.
+ * @param tempos Amostra (qualquer ordem). Vazia resulta em tudo zero.
+ */
+EstatisticasTempo calcularEstatisticasTempo(std::vector<double> tempos);
+
+/**
+ * @brief Percentil p (0..100) de uma amostra já ordenada, com interpolação linear entre postos.
+ */
+double percentilOrdenado(const std::vector<double>& ordenados, double p);
+
+/**
+ * @brief Sorteia origens 1-based com mt19937_64 e resto da divisão.
+ * @details Não usa uniform_int_distribution, cuja saída muda entre bibliotecas
+ * padrão: a mesma semente gera as mesmas origens no GCC, Clang e MSVC, e todos os
+ * algoritmos medidos com a mesma semente usam exatamente as mesmas origens.
+ */
+std::vector<int> sortearOrigens(int numVertices, size_t quantidade, unsigned long long semente);
+
+/**
+ * @brief Executa 'aquecimento' execuções descartadas e mede 'repeticoes' execuções.
+ * @param executar Chamada como executar(indice), com indice em [0, aquecimento + repeticoes);
+ * as medidas correspondem aos índices a partir de 'aquecimento'.
+ * @return Tempo de cada execução medida, em milissegundos (relógio monotônico).
+ */
+template <class Funcao>
+std::vector<double> medirExecucoes(int aquecimento, int repeticoes, Funcao&& executar) {
+    for (int k = 0; k < aquecimento; ++k) executar(k);
+
+    std::vector<double> temposMs;
+    temposMs.reserve(repeticoes > 0 ? repeticoes : 0);
+    for (int k = 0; k < repeticoes; ++k) {
+        auto inicio = std::chrono::steady_clock::now();
+        executar(aquecimento + k);
+        auto fim = std::chrono::steady_clock::now();
+        temposMs.push_back(std::chrono::duration<double, std::milli>(fim - inicio).count());
+    }
+    return temposMs;
+}
+
+/**
+ * @brief Lê os tempos individuais de um resultado anterior do executor de benchmarks.
+ * @details Cada item de "resultados" é identificado pelos campos "grafo",
+ * "representacao" (se houver) e "algoritmo" (ver chaveResultado). Itens sem
+ * "tempos_ms" usam apenas "tempo_mediana_ms" (sem teste de significância).
+ * @throws std::runtime_error se o arquivo não puder ser lido ou não for JSON válido.
+ */
+std::map<std::string, std::vector<double>> lerTemposBase(const std::string& caminhoArquivo);
+
+/**
+ * @brief Chave que identifica uma medição entre execuções do executor de benchmarks.
+ */
+std::string chaveResultado(const std::string& grafo, const std::string& representacao, const std::string& algoritmo);
+
+/**
+ * @brief Compara a amostra atual com a da base.
+ * @param base Tempos da base (um único valor = só a mediana era conhecida).
+ * @param atual Tempos atuais.
+ * @param limiar Variação relativa mínima da mediana para acusar regressão/melhoria.
+ * @param alfa Nível de significância do teste de Mann-Whitney.
+ */
+ComparacaoBase compararComBase(const std::vector<double>& base, const std::vector<double>& atual,
+    double limiar = 0.05, double alfa = 0.05);
+
+/**
+ * @brief Escapa um texto para uso dentro de aspas em JSON.
+ */
+std::string escaparJSON(const std::string& texto);
+
+/**
+ * @brief Colunas de estatísticas (em ms) e de comparação com a base, na ordem escrita
+ * por escreverEstatisticasCSV: "TempoTotal_ms,...,Outliers,MedianaBase_ms,Variacao,ValorP,Veredito".
+ */
+extern const char* const COLUNAS_ESTATISTICAS_CSV;
+
+/**
+ * @brief Escreve os valores de COLUNAS_ESTATISTICAS_CSV (sem vírgula inicial nem final).
+ * @details A comparação fica vazia quando não há base; usa a formatação atual do fluxo.
+ */
+void escreverEstatisticasCSV(std::ostream& saida, const EstatisticasTempo& estatisticas, const ComparacaoBase& comparacao);
+
+/**
+ * @brief Escreve os membros JSON das estatísticas (em ms) e, se houver, o objeto "comparacao".
+ * @details Saída no formato "\"tempo_total_ms\": ..., ..." sem chaves externas nem vírgula final.
+ */
+void escreverEstatisticasJSON(std::ostream& saida, const EstatisticasTempo& estatisticas, const ComparacaoBase& comparacao);
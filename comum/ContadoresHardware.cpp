@@ -0,0 +1,186 @@
+/**
+ * @file ContadoresHardware.cpp
+ * @brief Implementação dos contadores de desempenho com perf_event_open (somente Linux).
+ */
+
+#include "ContadoresHardware.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ostream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char* const NOMES_EVENTOS[NUM_EVENTOS_HARDWARE] = {
+    "ciclos", "instrucoes", "faltas_llc", "erros_desvio", "faltas_dtlb"
+};
+
+#if defined(__linux__)
+// Configuração (tipo, config) de cada evento, na ordem de NOMES_EVENTOS
+struct EventoPerf {
+    unsigned int tipo;
+    unsigned long long configuracao;
+};
+
+constexpr unsigned long long cacheLeituraFalta(unsigned long long cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+const EventoPerf EVENTOS_PERF[NUM_EVENTOS_HARDWARE] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, cacheLeituraFalta(PERF_COUNT_HW_CACHE_LL) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, cacheLeituraFalta(PERF_COUNT_HW_CACHE_DTLB) },
+};
+
+int abrirEvento(const EventoPerf& evento) {
+    perf_event_attr atributos;
+    std::memset(&atributos, 0, sizeof(atributos));
+    atributos.size = sizeof(atributos);
+    atributos.type = evento.tipo;
+    atributos.config = evento.configuracao;
+    atributos.disabled = 1;
+    atributos.inherit = 1;        // Soma as threads criadas durante a execução (ex: Bellman-Ford paralelo)
+    atributos.exclude_kernel = 1; // Permitido com perf_event_paranoid <= 2
+    atributos.exclude_hv = 1;
+    atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0));
+}
+#endif
+
+long long mediana(std::vector<long long> valores) {
+    if (valores.empty()) return -1;
+    const size_t meio = valores.size() / 2;
+    std::nth_element(valores.begin(), valores.begin() + meio, valores.end());
+    long long superior = valores[meio];
+    if (valores.size() % 2 == 1) return superior;
+    long long inferior = *std::max_element(valores.begin(), valores.begin() + meio);
+    return inferior + (superior - inferior + 1) / 2;
+}
+
+} // namespace
+
+const char* nomeEventoHardware(int indice) {
+    return NOMES_EVENTOS[indice];
+}
+
+ContadoresHardware::ContadoresHardware() {
+    descritores.fill(-1);
+#if defined(__linux__)
+    for (int i = 0; i < NUM_EVENTOS_HARDWARE; ++i) {
+        descritores[i] = abrirEvento(EVENTOS_PERF[i]);
+        if (descritores[i] < 0 && motivoIndisponivel.empty()) {
+            motivoIndisponivel = std::string(NOMES_EVENTOS[i]) + ": " + std::strerror(errno);
+        }
+    }
+#else
+    motivoIndisponivel = "perf_event_open so existe no Linux";
+#endif
+}
+
+ContadoresHardware::~ContadoresHardware() {
+#if defined(__linux__)
+    for (int descritor : descritores) {
+        if (descritor >= 0) close(descritor);
+    }
+#endif
+}
+
+bool ContadoresHardware::disponivel() const {
+    return std::any_of(descritores.begin(), descritores.end(), [](int d) { return d >= 0; });
+}
+
+const std::string& ContadoresHardware::obterMotivoIndisponivel() const {
+    return motivoIndisponivel;
+}
+
+void ContadoresHardware::iniciar() {
+#if defined(__linux__)
+    for (int descritor : descritores) {
+        if (descritor < 0) continue;
+        ioctl(descritor, PERF_EVENT_IOC_RESET, 0);
+        ioctl(descritor, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+LeituraContadores ContadoresHardware::parar() {
+    LeituraContadores leitura;
+#if defined(__linux__)
+    for (int descritor : descritores) {
+        if (descritor >= 0) ioctl(descritor, PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (int i = 0; i < NUM_EVENTOS_HARDWARE; ++i) {
+        if (descritores[i] < 0) continue;
+        unsigned long long dados[3] = { 0, 0, 0 }; // valor, tempo habilitado, tempo rodando
+        if (read(descritores[i], dados, sizeof(dados)) != static_cast<ssize_t>(sizeof(dados))) continue;
+        if (dados[2] == 0) continue; // Nunca chegou a ser agendado no processador
+        double escala = dados[2] < dados[1] ? static_cast<double>(dados[1]) / static_cast<double>(dados[2]) : 1.0;
+        leitura.valores[i] = static_cast<long long>(static_cast<double>(dados[0]) * escala + 0.5);
+    }
+#endif
+    return leitura;
+}
+
+std::array<long long, NUM_EVENTOS_HARDWARE> medianasContadores(const std::vector<LeituraContadores>& leituras) {
+    std::array<long long, NUM_EVENTOS_HARDWARE> medianas;
+    for (int i = 0; i < NUM_EVENTOS_HARDWARE; ++i) {
+        std::vector<long long> valores;
+        valores.reserve(leituras.size());
+        for (const auto& leitura : leituras) {
+            if (leitura.valores[i] >= 0) valores.push_back(leitura.valores[i]);
+        }
+        medianas[i] = mediana(std::move(valores));
+    }
+    return medianas;
+}
+
+const char* const COLUNAS_CONTADORES_CSV = "Ciclos,Instrucoes,IPC,FaltasLLC,ErrosDesvio,FaltasDTLB";
+
+void escreverContadoresCSV(std::ostream& saida, const std::vector<LeituraContadores>& leituras) {
+    const auto medianas = medianasContadores(leituras);
+    auto escreverValor = [&](long long valor) {
+        if (valor >= 0) saida << valor;
+    };
+    escreverValor(medianas[0]);
+    saida << ",";
+    escreverValor(medianas[1]);
+    saida << ",";
+    if (medianas[0] > 0 && medianas[1] >= 0) saida << static_cast<double>(medianas[1]) / static_cast<double>(medianas[0]);
+    for (int i = 2; i < NUM_EVENTOS_HARDWARE; ++i) {
+        saida << ",";
+        escreverValor(medianas[i]);
+    }
+}
+
+void escreverContadoresJSON(std::ostream& saida, const std::vector<LeituraContadores>& leituras) {
+    if (leituras.empty()) {
+        saida << "\"contadores\": null";
+        return;
+    }
+    const auto medianas = medianasContadores(leituras);
+    saida << "\"contadores\": {";
+    for (int i = 0; i < NUM_EVENTOS_HARDWARE; ++i) {
+        saida << (i ? ", " : "") << "\"" << NOMES_EVENTOS[i] << "\": ";
+        if (medianas[i] < 0) {
+            saida << "null";
+            continue;
+        }
+        saida << "{\"mediana\": " << medianas[i] << ", \"execucoes\": [";
+        for (size_t k = 0; k < leituras.size(); ++k) saida << (k ? ", " : "") << leituras[k].valores[i];
+        saida << "]}";
+    }
+    saida << ", \"ipc\": ";
+    if (medianas[0] > 0 && medianas[1] >= 0) saida << static_cast<double>(medianas[1]) / static_cast<double>(medianas[0]);
+    else saida << "null";
+    saida << "}";
+}
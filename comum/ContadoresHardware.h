@@ -0,0 +1,124 @@
+#pragma once
+/**
+ * @file ContadoresHardware.h
+ * @brief Contadores de desempenho do processador (Linux perf_event_open) em volta de cada execução medida.
+ * @details Ciclos, instruções, faltas na cache de último nível (LLC), desvios mal
+ * previstos e faltas na dTLB, contados só no espaço de usuário e somados sobre as
+ * threads criadas durante a execução. Ajuda a atribuir uma mudança de tempo a uma
+ * causa (ex: o efeito de reordenar ou comprimir o CSR sobre as faltas de cache).
+ * Fora do Linux, em máquinas virtuais sem PMU ou com perf_event_paranoid restritivo,
+ * os contadores ficam indisponíveis (-1) e a medição de tempo continua normalmente.
+ */
+
+#include <array>
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Número de eventos medidos (ver nomeEventoHardware).
+ */
+constexpr int NUM_EVENTOS_HARDWARE = 5;
+
+/**
+ * @brief Nome do i-ésimo evento: "ciclos", "instrucoes", "faltas_llc", "erros_desvio" ou "faltas_dtlb".
+ */
+const char* nomeEventoHardware(int indice);
+
+/**
+ * @struct LeituraContadores
+ * @brief Valores dos eventos em uma execução, na ordem de nomeEventoHardware (-1 = indisponível).
+ * @details Se o kernel multiplexou os contadores, os valores já vêm escalados pela fração
+ * do tempo em que cada um esteve ativo.
+ */
+struct LeituraContadores {
+    std::array<long long, NUM_EVENTOS_HARDWARE> valores{ -1, -1, -1, -1, -1 };
+};
+
+/**
+ * @class ContadoresHardware
+ * @brief Abre os contadores uma vez e os lê em volta de cada execução.
+ * @details Cada evento é aberto separadamente, então um evento que o processador não
+ * suporta (ex: dTLB em algumas máquinas virtuais) não impede a leitura dos outros.
+ */
+class ContadoresHardware {
+public:
+    ContadoresHardware();
+    ~ContadoresHardware();
+    ContadoresHardware(const ContadoresHardware&) = delete;
+    ContadoresHardware& operator=(const ContadoresHardware&) = delete;
+
+    /**
+     * @brief Indica se ao menos um evento pôde ser aberto.
+     */
+    bool disponivel() const;
+
+    /**
+     * @brief Motivo da indisponibilidade do primeiro evento que falhou (vazio se todos abriram).
+     */
+    const std::string& obterMotivoIndisponivel() const;
+
+    /**
+     * @brief Zera e liga os contadores.
+     */
+    void iniciar();
+
+    /**
+     * @brief Desliga os contadores e devolve os valores desde iniciar().
+     */
+    LeituraContadores parar();
+
+private:
+    std::array<int, NUM_EVENTOS_HARDWARE> descritores;
+    std::string motivoIndisponivel;
+};
+
+/**
+ * @brief Como medirExecucoes (Benchmark.h), mas também lê os contadores de cada execução medida.
+ * @details Os contadores são ligados antes e desligados depois do relógio, então o tempo
+ * não inclui as chamadas de sistema; o aquecimento não é contado.
+ * @param leituras Recebe uma leitura por repetição (na mesma ordem dos tempos).
+ * @return Tempo de cada execução medida, em milissegundos.
+ */
+template <class Funcao>
+std::vector<double> medirExecucoesComContadores(int aquecimento, int repeticoes, Funcao&& executar,
+    ContadoresHardware& contadores, std::vector<LeituraContadores>& leituras) {
+    for (int k = 0; k < aquecimento; ++k) executar(k);
+
+    std::vector<double> temposMs;
+    temposMs.reserve(repeticoes > 0 ? repeticoes : 0);
+    leituras.clear();
+    leituras.reserve(temposMs.capacity());
+    for (int k = 0; k < repeticoes; ++k) {
+        contadores.iniciar();
+        auto inicio = std::chrono::steady_clock::now();
+        executar(aquecimento + k);
+        auto fim = std::chrono::steady_clock::now();
+        leituras.push_back(contadores.parar());
+        temposMs.push_back(std::chrono::duration<double, std::milli>(fim - inicio).count());
+    }
+    return temposMs;
+}
+
+/**
+ * @brief Mediana de cada evento sobre as leituras, arredondada (-1 para eventos indisponíveis ou sem leituras).
+ */
+std::array<long long, NUM_EVENTOS_HARDWARE> medianasContadores(const std::vector<LeituraContadores>& leituras);
+
+/**
+ * @brief Colunas escritas por escreverContadoresCSV:
+ * "Ciclos,Instrucoes,IPC,FaltasLLC,ErrosDesvio,FaltasDTLB" (medianas por execução).
+ */
+extern const char* const COLUNAS_CONTADORES_CSV;
+
+/**
+ * @brief Escreve as medianas dos contadores e o IPC (sem vírgula inicial nem final; vazio se indisponível).
+ */
+void escreverContadoresCSV(std::ostream& saida, const std::vector<LeituraContadores>& leituras);
+
+/**
+ * @brief Escreve o membro JSON "contadores" com as medianas e os valores de cada execução,
+ * ou "contadores": null se não houver leituras (sem vírgula inicial nem final).
+ */
+void escreverContadoresJSON(std::ostream& saida, const std::vector<LeituraContadores>& leituras);
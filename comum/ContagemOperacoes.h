@@ -0,0 +1,56 @@
+#pragma once
+/**
+ * @file ContagemOperacoes.h
+ * @brief Políticas de contagem de operações dos algoritmos, escolhidas em tempo de compilação.
+ * @details Os algoritmos recebem a política como parâmetro de template (ex:
+ * bfs.executar<ComContagem>(grafo, origem)). Com SemContagem, o padrão, todos os
+ * métodos são vazios e o compilador gera o mesmo código da versão sem contadores;
+ * com ComContagem, o resultado traz as contagens no campo 'operacoes'. Não há
+ * desvio em tempo de execução em nenhum dos dois casos.
+ */
+
+/**
+ * @struct ContadoresOperacoes
+ * @brief Contagens de uma execução (tudo zero quando a política é SemContagem).
+ * @details O significado exato de cada campo em cada algoritmo está na documentação
+ * do próprio algoritmo; campos que não se aplicam ficam em zero.
+ */
+struct ContadoresOperacoes {
+    long long verticesFinalizados = 0; // Vértices processados de vez (retirados da fila/pilha/heap e expandidos)
+    long long arestasExaminadas = 0;   // Arestas (u, v) percorridas
+    long long relaxamentos = 0;        // Relaxamentos que melhoraram dist[v] (nas buscas: vértices descobertos)
+    long long insercoesHeap = 0;       // Inserções na fila de prioridade (ou na pilha, na DFS)
+    long long remocoesObsoletas = 0;   // Entradas retiradas e descartadas por já estarem desatualizadas
+    long long rodadas = 0;             // Passagens sobre todas as arestas (Bellman-Ford)
+};
+
+/**
+ * @struct SemContagem
+ * @brief Política padrão: não conta nada (custo zero).
+ */
+struct SemContagem {
+    static constexpr bool ATIVA = false;
+    void verticeFinalizado() {}
+    void arestaExaminada() {}
+    void relaxamento() {}
+    void insercaoHeap() {}
+    void remocaoObsoleta() {}
+    void rodada() {}
+    ContadoresOperacoes obter() const { return {}; }
+};
+
+/**
+ * @struct ComContagem
+ * @brief Política que acumula as contagens em ContadoresOperacoes.
+ */
+struct ComContagem {
+    static constexpr bool ATIVA = true;
+    ContadoresOperacoes contadores;
+    void verticeFinalizado() { ++contadores.verticesFinalizados; }
+    void arestaExaminada() { ++contadores.arestasExaminadas; }
+    void relaxamento() { ++contadores.relaxamentos; }
+    void insercaoHeap() { ++contadores.insercoesHeap; }
+    void remocaoObsoleta() { ++contadores.remocoesObsoletas; }
+    void rodada() { ++contadores.rodadas; }
+    ContadoresOperacoes obter() const { return contadores; }
+};
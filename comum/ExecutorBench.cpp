@@ -0,0 +1,353 @@
+/**
+ * @file ExecutorBench.cpp
+ * @brief Implementação das partes comuns dos executores de benchmarks.
+ */
+
+#include "ExecutorBench.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+const char* const COLUNAS_OPERACOES_CSV =
+    "VerticesFinalizados,ArestasExaminadas,Relaxamentos,InsercoesHeap,RemocoesObsoletas,Rodadas";
+const char* const CAMPOS_OPERACOES_JSON[] = {
+    "vertices_finalizados", "arestas_examinadas", "relaxamentos", "insercoes_heap", "remocoes_obsoletas", "rodadas"
+};
+
+// Média por execução de cada contagem, na ordem de COLUNAS_OPERACOES_CSV
+std::array<double, 6> mediasOperacoes(const ResultadoMedicao& r) {
+    const ContadoresOperacoes& s = r.somaOperacoes;
+    const double n = r.execucoesContadas;
+    return { s.verticesFinalizados / n, s.arestasExaminadas / n, s.relaxamentos / n,
+             s.insercoesHeap / n, s.remocoesObsoletas / n, s.rodadas / n };
+}
+
+// Expande um intervalo "chave=A..B" da especificação em A, 10A, 100A, ... <= B
+std::vector<std::string> expandirVarredura(const std::string& especificacao) {
+    const size_t pontos = especificacao.find("..");
+    if (pontos == std::string::npos) return { especificacao };
+    const size_t inicio = especificacao.rfind('=', pontos);
+    size_t fim = especificacao.find(':', pontos);
+    if (fim == std::string::npos) fim = especificacao.size();
+    if (inicio == std::string::npos) throw std::runtime_error("Intervalo invalido em --gerar: " + especificacao);
+
+    const std::string chave = "--gerar " + especificacao.substr(0, inicio);
+    const long long primeiro = static_cast<long long>(lerReal(chave, especificacao.substr(inicio + 1, pontos - inicio - 1), 1.0));
+    const long long ultimo = static_cast<long long>(lerReal(chave, especificacao.substr(pontos + 2, fim - pontos - 2), 1.0));
+    std::vector<std::string> especificacoes;
+    for (long long valor = primeiro; valor <= ultimo; valor *= 10) {
+        especificacoes.push_back(especificacao.substr(0, inicio + 1) + std::to_string(valor) + especificacao.substr(fim));
+    }
+    return especificacoes;
+}
+
+// 1, 2, 4, ... até o número de processadores disponíveis, mais o próprio número
+std::vector<int> threadsPadrao() {
+    const int maximo = static_cast<int>(obterProcessadoresDisponiveis().size());
+    std::vector<int> threads;
+    for (int t = 1; t < maximo; t *= 2) threads.push_back(t);
+    threads.push_back(maximo);
+    return threads;
+}
+
+// Processadores e nós NUMA das threads 0..numThreads-1 (vazios sem fixação)
+void escreverPosicionamento(std::ostream& saida, int numThreads, bool fixar) {
+    if (!fixar) {
+        saida << ",";
+        return;
+    }
+    const std::vector<int>& processadores = obterProcessadoresDisponiveis();
+    std::set<int> usados, nos;
+    for (int t = 0; t < numThreads; ++t) usados.insert(processadores[t % processadores.size()]);
+    for (int p : usados) {
+        const int no = obterNoNUMA(p);
+        if (no >= 0) nos.insert(no);
+    }
+    const char* separador = "";
+    for (int p : usados) {
+        saida << separador << p;
+        separador = ";";
+    }
+    saida << ",";
+    separador = "";
+    for (int no : nos) {
+        saida << separador << no;
+        separador = ";";
+    }
+}
+
+} // namespace
+
+std::vector<std::string> separarLista(const std::string& texto) {
+    std::vector<std::string> itens;
+    std::stringstream fluxo(texto);
+    std::string item;
+    while (std::getline(fluxo, item, ',')) {
+        if (!item.empty()) itens.push_back(item);
+    }
+    return itens;
+}
+
+long long lerInteiro(const std::string& opcao, const std::string& valor, long long minimo) {
+    size_t lidos = 0;
+    long long numero = 0;
+    try {
+        numero = std::stoll(valor, &lidos);
+    }
+    catch (const std::exception&) {
+        lidos = 0;
+    }
+    if (lidos != valor.size() || numero < minimo) {
+        throw std::runtime_error("Valor invalido para " + opcao + ": " + valor);
+    }
+    return numero;
+}
+
+double lerReal(const std::string& opcao, const std::string& valor, double minimo) {
+    size_t lidos = 0;
+    double numero = 0.0;
+    try {
+        numero = std::stod(valor, &lidos);
+    }
+    catch (const std::exception&) {
+        lidos = 0;
+    }
+    if (lidos != valor.size() || !(numero >= minimo)) {
+        throw std::runtime_error("Valor invalido para " + opcao + ": " + valor);
+    }
+    return numero;
+}
+
+bool lerSimNao(const std::string& opcao, const std::string& valor) {
+    if (valor != "sim" && valor != "nao") throw std::runtime_error("Valor invalido para " + opcao + ": " + valor);
+    return valor == "sim";
+}
+
+void percorrerArgumentos(int argc, char** argv, void (*imprimirUso)(std::ostream&),
+    const std::function<bool(const std::string& opcao, const std::string& valor)>& tratarOpcao) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string opcao = argv[i];
+        if (opcao == "--ajuda" || opcao == "-h") {
+            imprimirUso(std::cout);
+            std::exit(0);
+        }
+        if (opcao.rfind("--", 0) != 0) throw std::runtime_error("Opcao desconhecida: " + opcao);
+        if (i + 1 >= argc) throw std::runtime_error("Falta o valor de " + opcao);
+        const std::string valor = argv[++i];
+        if (!tratarOpcao(opcao, valor)) throw std::runtime_error("Opcao desconhecida: " + opcao);
+    }
+}
+
+std::string resolverCaminhoGrafo(const std::string& caminho, const std::string& alternativo) {
+    if (std::filesystem::exists(caminho)) return caminho;
+    if (std::filesystem::exists(alternativo)) return alternativo;
+    throw std::runtime_error("Arquivo de grafo nao encontrado: " + caminho);
+}
+
+std::vector<FonteGrafo> lerFontesGeradas(const std::string& especificacao, bool comPesos) {
+    std::vector<FonteGrafo> fontes;
+    for (const auto& item : expandirVarredura(especificacao)) {
+        FonteGrafo fonte;
+        fonte.gerado = true;
+        fonte.parametros = lerEspecificacaoGerador(item, comPesos);
+        fonte.nome = descreverGerador(fonte.parametros, comPesos);
+        fontes.push_back(std::move(fonte));
+    }
+    return fontes;
+}
+
+bool lerOpcaoBench(OpcoesBench& opcoes, const std::string& opcao, const std::string& valor) {
+    if (opcao == "--repeticoes") opcoes.repeticoes = static_cast<int>(lerInteiro(opcao, valor, 1));
+    else if (opcao == "--aquecimento") opcoes.aquecimento = static_cast<int>(lerInteiro(opcao, valor, 0));
+    else if (opcao == "--semente") opcoes.semente = static_cast<unsigned long long>(lerInteiro(opcao, valor, 0));
+    else if (opcao == "--threads") opcoes.numThreads = static_cast<int>(lerInteiro(opcao, valor, 0));
+    else if (opcao == "--saida") opcoes.saida = valor;
+    else if (opcao == "--base") opcoes.base = valor;
+    else if (opcao == "--limiar") opcoes.limiar = lerReal(opcao, valor, 0.0);
+    else if (opcao == "--operacoes") opcoes.operacoes = lerSimNao(opcao, valor);
+    else if (opcao == "--contadores") opcoes.contadores = lerSimNao(opcao, valor);
+    else if (opcao == "--formato") {
+        if (valor != "json" && valor != "csv") throw std::runtime_error("Formato desconhecido: " + valor);
+        opcoes.formatoCSV = (valor == "csv");
+    }
+    else return false;
+    return true;
+}
+
+std::unique_ptr<ContadoresHardware> abrirContadores(const OpcoesBench& opcoes) {
+    if (!opcoes.contadores) return nullptr;
+    auto contadores = std::make_unique<ContadoresHardware>();
+    if (!contadores->obterMotivoIndisponivel().empty()) {
+        std::cerr << "Aviso: contador indisponivel (" << contadores->obterMotivoIndisponivel() << ")" << std::endl;
+    }
+    if (!contadores->disponivel()) contadores.reset();
+    return contadores;
+}
+
+void somarOperacoes(ContadoresOperacoes& soma, const ContadoresOperacoes& parcela) {
+    soma.verticesFinalizados += parcela.verticesFinalizados;
+    soma.arestasExaminadas += parcela.arestasExaminadas;
+    soma.relaxamentos += parcela.relaxamentos;
+    soma.insercoesHeap += parcela.insercoesHeap;
+    soma.remocoesObsoletas += parcela.remocoesObsoletas;
+    soma.rodadas += parcela.rodadas;
+}
+
+void registrarFalha(ResultadoMedicao& resultado, const std::string& motivo) {
+    resultado.temposMs.clear();
+    resultado.contadores.clear();
+    resultado.execucoesContadas = 0;
+    resultado.status = motivo;
+}
+
+bool compararResultadoComBase(ResultadoMedicao& r, const std::map<std::string, std::vector<double>>& temposBase, double limiar) {
+    if (r.status != "OK") return false;
+    auto it = temposBase.find(chaveResultado(r.grafo, r.representacao, r.algoritmo));
+    if (it == temposBase.end()) return false;
+    r.comparacao = compararComBase(it->second, r.temposMs, limiar);
+    if (r.comparacao.veredito != "regressao") return false;
+    std::cerr << "REGRESSAO: " << r.grafo << " / " << r.algoritmo << " (" << (r.comparacao.variacao * 100.0)
+        << "% na mediana)" << std::endl;
+    return true;
+}
+
+void escreverColunasMedicaoCSV(std::ostream& saida) {
+    saida << COLUNAS_ESTATISTICAS_CSV << "," << COLUNAS_CONTADORES_CSV << "," << COLUNAS_OPERACOES_CSV << ",Status";
+}
+
+void escreverMedicaoCSV(std::ostream& saida, const ResultadoMedicao& r) {
+    escreverEstatisticasCSV(saida, r.estatisticas, r.comparacao);
+    saida << ",";
+    escreverContadoresCSV(saida, r.contadores);
+    const auto medias = mediasOperacoes(r);
+    for (double media : medias) {
+        saida << ",";
+        if (r.execucoesContadas > 0) saida << media;
+    }
+    saida << "," << (r.status == "OK" ? "OK" : "FALHA");
+}
+
+void escreverCabecalhoJSON(std::ostream& saida, const std::string& projeto, const OpcoesBench& opcoes,
+    const std::string& camposExtras) {
+    saida.precision(6);
+    saida << std::fixed;
+    saida << "{\n  \"projeto\": \"" << escaparJSON(projeto) << "\",\n";
+    if (!camposExtras.empty()) saida << "  " << camposExtras << ",\n";
+    saida << "  \"repeticoes\": " << opcoes.repeticoes << ",\n"
+        << "  \"aquecimento\": " << opcoes.aquecimento << ",\n"
+        << "  \"semente\": " << opcoes.semente << ",\n"
+        << "  \"threads\": " << opcoes.numThreads << ",\n"
+        << "  \"base\": \"" << escaparJSON(opcoes.base) << "\",\n"
+        << "  \"contadores\": " << (opcoes.contadores ? "true" : "false") << ",\n"
+        << "  \"operacoes\": " << (opcoes.operacoes ? "true" : "false") << ",\n"
+        << "  \"resultados\": [";
+}
+
+void escreverResultadoJSON(std::ostream& saida, const ResultadoMedicao& r, const std::string& camposCarga) {
+    saida << "    {\"grafo\": \"" << escaparJSON(r.grafo) << "\"";
+    if (!r.representacao.empty()) saida << ", \"representacao\": \"" << escaparJSON(r.representacao) << "\"";
+    saida << ", \"algoritmo\": \"" << escaparJSON(r.algoritmo) << "\", \"vertices\": " << r.vertices << ", \"arestas\": " << r.arestas
+        << ", \"status\": \"" << escaparJSON(r.status) << "\",\n"
+        << "     \"tempo_carga_ms\": " << r.tempoCargaMs << camposCarga << ", ";
+    escreverEstatisticasJSON(saida, r.estatisticas, r.comparacao);
+    saida << ",\n     ";
+    escreverContadoresJSON(saida, r.contadores);
+    saida << ", \"operacoes\": ";
+    if (r.execucoesContadas == 0) saida << "null";
+    else {
+        const auto medias = mediasOperacoes(r);
+        saida << "{";
+        for (size_t k = 0; k < medias.size(); ++k) {
+            saida << (k ? ", " : "") << "\"" << CAMPOS_OPERACOES_JSON[k] << "\": " << medias[k];
+        }
+        saida << "}";
+    }
+    saida << ",\n     \"tempos_ms\": [";
+    for (size_t k = 0; k < r.temposMs.size(); ++k) saida << (k ? ", " : "") << r.temposMs[k];
+    saida << "]}";
+}
+
+bool lerOpcaoEscalabilidade(OpcoesEscalabilidade& opcoes, const std::string& opcao, const std::string& valor) {
+    if (opcao == "--threads") {
+        opcoes.threads.clear();
+        for (const auto& item : separarLista(valor)) opcoes.threads.push_back(static_cast<int>(lerInteiro(opcao, item, 1)));
+    }
+    else if (opcao == "--escala") opcoes.escalas = separarLista(valor);
+    else if (opcao == "--fixar") opcoes.fixar = lerSimNao(opcao, valor);
+    else if (opcao == "--repeticoes") opcoes.repeticoes = static_cast<int>(lerInteiro(opcao, valor, 1));
+    else if (opcao == "--aquecimento") opcoes.aquecimento = static_cast<int>(lerInteiro(opcao, valor, 0));
+    else if (opcao == "--semente") opcoes.semente = static_cast<unsigned long long>(lerInteiro(opcao, valor, 0));
+    else if (opcao == "--saida") opcoes.saida = valor;
+    else return false;
+    return true;
+}
+
+void completarOpcoesEscalabilidade(OpcoesEscalabilidade& opcoes) {
+    for (const auto& escala : opcoes.escalas) {
+        if (escala != "forte" && escala != "fraca") throw std::runtime_error("Escala desconhecida: " + escala);
+    }
+    // 1 thread é a base do speedup
+    if (opcoes.threads.empty()) opcoes.threads = threadsPadrao();
+    opcoes.threads.push_back(1);
+    std::sort(opcoes.threads.begin(), opcoes.threads.end());
+    opcoes.threads.erase(std::unique(opcoes.threads.begin(), opcoes.threads.end()), opcoes.threads.end());
+}
+
+void informarProcessadores(int maiorNumeroThreads) {
+    const std::vector<int>& processadores = obterProcessadoresDisponiveis();
+    std::cerr << "Processadores disponiveis (processador:no NUMA):";
+    for (int p : processadores) std::cerr << " " << p << ":" << obterNoNUMA(p);
+    std::cerr << std::endl;
+    if (maiorNumeroThreads > static_cast<int>(processadores.size())) {
+        std::cerr << "Aviso: mais threads do que processadores; as medicoes acima de "
+            << processadores.size() << " threads tem sobreposicao." << std::endl;
+    }
+}
+
+ParametrosGerador escalarParametros(ParametrosGerador parametros, int fator) {
+    if (parametros.numeroVertices > 0) {
+        const long long vertices = static_cast<long long>(parametros.numeroVertices) * fator;
+        if (vertices > std::numeric_limits<int>::max()) throw std::runtime_error("Grafo da escala fraca grande demais para o CSR.");
+        parametros.numeroVertices = static_cast<int>(vertices);
+    }
+    parametros.numeroArestas *= fator;
+    return parametros;
+}
+
+void calcularSpeedup(std::vector<ResultadoEscalabilidade>& resultados) {
+    for (auto& r : resultados) {
+        if (r.status != "OK") continue;
+        auto base = std::find_if(resultados.begin(), resultados.end(), [&](const ResultadoEscalabilidade& b) {
+            return b.threads == 1 && b.status == "OK" && b.grafo == r.grafo && b.representacao == r.representacao
+                && b.algoritmo == r.algoritmo && b.escala == r.escala;
+        });
+        if (base == resultados.end() || r.estatisticas.mediana <= 0.0) continue;
+        r.razaoTamanho = static_cast<double>(r.vertices + r.arestas) / static_cast<double>(base->vertices + base->arestas);
+        r.speedup = r.razaoTamanho * base->estatisticas.mediana / r.estatisticas.mediana;
+        r.eficiencia = r.speedup / r.threads;
+    }
+}
+
+void escreverColunasEscalabilidadeCSV(std::ostream& saida) {
+    saida << "Escala,Speedup,Eficiencia,RazaoTamanho,Fixacao,Processadores,NosNUMA";
+}
+
+void escreverEscalabilidadeCSV(std::ostream& saida, const ResultadoEscalabilidade& r, bool fixar) {
+    saida << (r.escala == "forte" ? "Forte" : "Fraca") << ",";
+    if (r.speedup >= 0.0) saida << r.speedup;
+    saida << ",";
+    if (r.eficiencia >= 0.0) saida << r.eficiencia;
+    saida << ",";
+    if (r.razaoTamanho >= 0.0) saida << r.razaoTamanho;
+    saida << "," << (fixar ? "Sim" : "Nao") << ",";
+    escreverPosicionamento(saida, r.threads, fixar);
+}
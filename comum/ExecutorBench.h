@@ -0,0 +1,283 @@
+#pragma once
+/**
+ * @file ExecutorBench.h
+ * @brief Partes comuns dos executores de benchmarks não interativos dos TPs
+ * (bench/bench.cpp e bench/escalabilidade.cpp).
+ * @details Leitura das opções de linha de comando e dos grafos gerados, medição de um
+ * algoritmo com contadores do processador e contagem de operações opcionais, comparação
+ * com um resultado anterior e escrita dos resultados em CSV e JSON; nos estudos de
+ * escalabilidade, as opções de threads e escala, o speedup e as colunas próprias do CSV.
+ * Cada TP define só o que é dele: os grafos, os algoritmos, as representações e as
+ * colunas da carga.
+ */
+
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Benchmark.h"
+#include "ContadoresHardware.h"
+#include "ContagemOperacoes.h"
+#include "Geradores.h"
+
+/**
+ * @brief Separa uma lista "a,b,c" (itens vazios são ignorados).
+ */
+std::vector<std::string> separarLista(const std::string& texto);
+
+/**
+ * @brief Converte o valor inteiro de uma opção.
+ * @throws std::runtime_error se o valor não for um inteiro >= minimo.
+ */
+long long lerInteiro(const std::string& opcao, const std::string& valor, long long minimo);
+
+/**
+ * @brief Converte o valor real de uma opção.
+ * @throws std::runtime_error se o valor não for um número >= minimo.
+ */
+double lerReal(const std::string& opcao, const std::string& valor, double minimo);
+
+/**
+ * @brief Converte "sim" ou "nao".
+ * @throws std::runtime_error para qualquer outro valor.
+ */
+bool lerSimNao(const std::string& opcao, const std::string& valor);
+
+/**
+ * @brief Percorre os argumentos aos pares "--opcao valor".
+ * @details --ajuda e -h imprimem o uso na saída padrão e encerram o programa.
+ * @param tratarOpcao Chamada com cada par; devolve false se não conhecer a opção.
+ * @throws std::runtime_error para opção desconhecida ou sem valor.
+ */
+void percorrerArgumentos(int argc, char** argv, void (*imprimirUso)(std::ostream&),
+    const std::function<bool(const std::string& opcao, const std::string& valor)>& tratarOpcao);
+
+/**
+ * @brief Devolve 'caminho' se o arquivo existir, senão 'alternativo' (em geral, o mesmo nome
+ * em estudos/grafos_em_txt).
+ * @throws std::runtime_error se nenhum dos dois existir.
+ */
+std::string resolverCaminhoGrafo(const std::string& caminho, const std::string& alternativo);
+
+/**
+ * @struct FonteGrafo
+ * @brief Grafo de um arquivo ou de um gerador sintético (Geradores.h).
+ */
+struct FonteGrafo {
+    std::string nome;
+    bool gerado = false;
+    ParametrosGerador parametros;
+};
+
+/**
+ * @brief Lê o valor de --gerar: uma especificação de lerEspecificacaoGerador em que um
+ * intervalo "chave=A..B" varre A, 10A, 100A, ... <= B.
+ * @return Uma fonte por grafo, com o nome canônico de descreverGerador.
+ * @throws std::runtime_error se a especificação for inválida.
+ */
+std::vector<FonteGrafo> lerFontesGeradas(const std::string& especificacao, bool comPesos);
+
+/**
+ * @struct OpcoesBench
+ * @brief Opções comuns a todos os executores de benchmarks.
+ * @details A configuração de cada TP herda desta estrutura e pode mudar os padrões no construtor.
+ */
+struct OpcoesBench {
+    int repeticoes = 10;
+    int aquecimento = 1;
+    unsigned long long semente = 42;
+    int numThreads = 0;
+    std::string base;
+    double limiar = 0.05;
+    bool contadores = false;
+    bool operacoes = false;
+    bool formatoCSV = false;
+    std::string saida;
+};
+
+/**
+ * @brief Lê uma opção comum: --repeticoes, --aquecimento, --semente, --threads, --base,
+ * --limiar, --operacoes, --contadores, --formato ou --saida.
+ * @return false se 'opcao' não for uma delas.
+ * @throws std::runtime_error se o valor for inválido.
+ */
+bool lerOpcaoBench(OpcoesBench& opcoes, const std::string& opcao, const std::string& valor);
+
+/**
+ * @struct ResultadoMedicao
+ * @brief Medição de um algoritmo em um grafo (os resultados de cada TP herdam desta estrutura).
+ */
+struct ResultadoMedicao {
+    std::string grafo, representacao, algoritmo; // Representação vazia quando o TP só tem uma
+    int vertices = -1;
+    long long arestas = -1;
+    double tempoCargaMs = -1.0;
+    std::vector<double> temposMs;
+    std::vector<LeituraContadores> contadores; // Uma leitura por execução medida (vazio sem --contadores)
+    ContadoresOperacoes somaOperacoes;         // Soma sobre as execuções contadas (--operacoes)
+    int execucoesContadas = 0;
+    EstatisticasTempo estatisticas;
+    ComparacaoBase comparacao;
+    std::string status = "OK";
+};
+
+/**
+ * @brief Abre os contadores do processador se --contadores estiver ligado.
+ * @details Avisa em std::cerr quando algum evento não estiver disponível.
+ * @return nullptr se a opção estiver desligada ou se nenhum contador puder ser lido.
+ */
+std::unique_ptr<ContadoresHardware> abrirContadores(const OpcoesBench& opcoes);
+
+/**
+ * @brief Executa aquecimento + repetições e guarda o tempo (e, com 'contadores', as leituras)
+ * de cada repetição, além das estatísticas.
+ * @param executar Chamada como executar(indice), como em medirExecucoes.
+ */
+template <class Funcao>
+void medirTempos(const OpcoesBench& opcoes, ContadoresHardware* contadores, Funcao&& executar, ResultadoMedicao& resultado) {
+    resultado.temposMs = contadores
+        ? medirExecucoesComContadores(opcoes.aquecimento, opcoes.repeticoes, executar, *contadores, resultado.contadores)
+        : medirExecucoes(opcoes.aquecimento, opcoes.repeticoes, executar);
+    resultado.estatisticas = calcularEstatisticasTempo(resultado.temposMs);
+}
+
+/**
+ * @brief Acumula as contagens de uma execução em 'soma'.
+ */
+void somarOperacoes(ContadoresOperacoes& soma, const ContadoresOperacoes& parcela);
+
+/**
+ * @brief Descarta as medições parciais e registra 'motivo' como status.
+ */
+void registrarFalha(ResultadoMedicao& resultado, const std::string& motivo);
+
+/**
+ * @brief Compara o resultado com a medição de mesmo grafo, representação e algoritmo da base.
+ * @return true se houver regressão (também avisada em std::cerr).
+ */
+bool compararResultadoComBase(ResultadoMedicao& resultado, const std::map<std::string, std::vector<double>>& temposBase, double limiar);
+
+/**
+ * @brief Escreve os nomes das colunas de escreverMedicaoCSV: estatísticas, contadores,
+ * operações e Status (sem vírgula inicial nem final).
+ */
+void escreverColunasMedicaoCSV(std::ostream& saida);
+
+/**
+ * @brief Escreve as estatísticas, os contadores, as médias das operações e o status
+ * (sem vírgula inicial nem final).
+ */
+void escreverMedicaoCSV(std::ostream& saida, const ResultadoMedicao& resultado);
+
+/**
+ * @brief Abre o objeto JSON e escreve as opções comuns e 'camposExtras' (ex: "\"direcionado\": true").
+ * @details Deixa a lista "resultados" aberta para escreverResultadoJSON.
+ */
+void escreverCabecalhoJSON(std::ostream& saida, const std::string& projeto, const OpcoesBench& opcoes,
+    const std::string& camposExtras);
+
+/**
+ * @brief Escreve um objeto da lista "resultados".
+ * @param camposCarga Campos escritos logo depois de "tempo_carga_ms" (vazio ou ", \"chave\": valor...").
+ */
+void escreverResultadoJSON(std::ostream& saida, const ResultadoMedicao& resultado, const std::string& camposCarga);
+
+/**
+ * @brief Escreve o JSON completo dos resultados.
+ * @param camposCarga Se não for vazio, dá os campos extras da carga de cada resultado.
+ */
+template <class Resultado>
+void escreverJSONBench(std::ostream& saida, const std::string& projeto, const OpcoesBench& opcoes,
+    const std::vector<Resultado>& resultados, const std::string& camposExtras = std::string(),
+    const std::function<std::string(const std::type_identity_t<Resultado>&)>& camposCarga = nullptr) {
+    escreverCabecalhoJSON(saida, projeto, opcoes, camposExtras);
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        saida << (i ? ",\n" : "\n");
+        escreverResultadoJSON(saida, resultados[i], camposCarga ? camposCarga(resultados[i]) : std::string());
+    }
+    saida << "\n  ]\n}\n";
+}
+
+/**
+ * @struct OpcoesEscalabilidade
+ * @brief Opções comuns aos estudos de escalabilidade (bench/escalabilidade.cpp).
+ * @details A configuração de cada TP herda desta estrutura e dá o arquivo de saída padrão.
+ */
+struct OpcoesEscalabilidade {
+    std::vector<int> threads; // Depois de completarOpcoesEscalabilidade: crescente, começando em 1
+    std::vector<std::string> escalas{ "forte" };
+    bool fixar = true;
+    int repeticoes = 5;
+    int aquecimento = 1;
+    unsigned long long semente = 42;
+    std::string saida;
+};
+
+/**
+ * @brief Lê uma opção comum dos estudos de escalabilidade: --threads, --escala, --fixar,
+ * --repeticoes, --aquecimento, --semente ou --saida.
+ * @return false se 'opcao' não for uma delas.
+ * @throws std::runtime_error se o valor for inválido.
+ */
+bool lerOpcaoEscalabilidade(OpcoesEscalabilidade& opcoes, const std::string& opcao, const std::string& valor);
+
+/**
+ * @brief Valida as escalas e completa a lista de threads: sem --threads, 1, 2, 4, ... até o
+ * número de processadores disponíveis; 1 thread (a base do speedup) sempre entra.
+ * @throws std::runtime_error para escala desconhecida.
+ */
+void completarOpcoesEscalabilidade(OpcoesEscalabilidade& opcoes);
+
+/**
+ * @brief Lista em std::cerr os processadores disponíveis e os seus nós NUMA, e avisa se
+ * 'maiorNumeroThreads' passar do número de processadores.
+ */
+void informarProcessadores(int maiorNumeroThreads);
+
+/**
+ * @brief Grafo gerado com 'fator' vezes os vértices e as arestas pedidos (escala fraca).
+ * @throws std::runtime_error se os vértices não couberem em int.
+ */
+ParametrosGerador escalarParametros(ParametrosGerador parametros, int fator);
+
+/**
+ * @struct ResultadoEscalabilidade
+ * @brief Medição de um algoritmo com um número de threads.
+ */
+struct ResultadoEscalabilidade {
+    std::string grafo, representacao, algoritmo, escala;
+    int threads = 1;
+    int vertices = -1;
+    long long arestas = -1;
+    double tempoCargaMs = -1.0;
+    std::vector<double> temposMs;
+    EstatisticasTempo estatisticas;
+    double speedup = -1.0, eficiencia = -1.0; // -1: sem base com 1 thread
+    double razaoTamanho = -1.0;               // (V + M) deste grafo / (V + M) do grafo da base
+    std::string status = "OK";
+};
+
+/**
+ * @brief Speedup e eficiência de cada medição em relação à de 1 thread da mesma série
+ * (grafo, representação, algoritmo e escala).
+ * @details O trabalho de cada execução é tomado como proporcional a V + M: o speedup é
+ * RazaoTamanho x mediana(T1) / mediana(Tt), o que na escala forte (RazaoTamanho = 1) é o
+ * speedup usual, e a eficiência é speedup / t.
+ */
+void calcularSpeedup(std::vector<ResultadoEscalabilidade>& resultados);
+
+/**
+ * @brief Escreve os nomes das colunas de escreverEscalabilidadeCSV (sem vírgula inicial nem final).
+ */
+void escreverColunasEscalabilidadeCSV(std::ostream& saida);
+
+/**
+ * @brief Escreve a escala, o speedup, a eficiência, a razão de tamanho, a fixação e os
+ * processadores e nós NUMA usados (vazios sem fixação), sem vírgula inicial nem final.
+ * @details Nenhuma dessas colunas tem unidade: os tempos ficam nas colunas de cada TP.
+ */
+void escreverEscalabilidadeCSV(std::ostream& saida, const ResultadoEscalabilidade& resultado, bool fixar);
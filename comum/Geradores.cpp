@@ -0,0 +1,504 @@
+/**
+ * @file Geradores.cpp
+ * @brief Implementação dos geradores de grafos sintéticos.
+ */
+
+#include "Geradores.h"
+#include "Paralelo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+    constexpr long long TAMANHO_BLOCO = 1 << 16; // Arestas por bloco (e por gerador pseudoaleatório)
+    constexpr int FATOR_ARESTAS = 16;            // m = 16 V no R-MAT e no G(n,m), como no Graph500
+
+    // Fluxos independentes derivados da mesma semente
+    constexpr uint64_t FLUXO_ESTRUTURA = 0x243F6A8885A308D3ULL;
+    constexpr uint64_t FLUXO_ROTULOS = 0x13198A2E03707344ULL;
+    constexpr uint64_t FLUXO_POTENCIAIS = 0xA4093822299F31D0ULL;
+    constexpr uint64_t FLUXO_LIGACAO = 0x082EFA98EC4E6C89ULL;
+    constexpr uint64_t FLUXO_PESOS = 0xEC4E6C89452821E6ULL;
+
+    // Finalizador do splitmix64: espalha bem índices consecutivos
+    inline uint64_t misturar(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    inline uint64_t hashIndice(uint64_t semente, uint64_t fluxo, uint64_t indice) {
+        return misturar(semente ^ fluxo ^ misturar(indice));
+    }
+
+    // Real uniforme em [0, 1) com 53 bits
+    inline double uniforme01(uint64_t bits) {
+        return static_cast<double>(bits >> 11) * 0x1.0p-53;
+    }
+
+    std::mt19937_64 geradorDoBloco(uint64_t semente, long long bloco, uint64_t fluxo = FLUXO_ESTRUTURA) {
+        return std::mt19937_64(hashIndice(semente, fluxo, static_cast<uint64_t>(bloco)));
+    }
+
+    /**
+     * @brief Sorteia o peso de cada aresta conforme a distribuição e o tratamento de negativos.
+     */
+    class SorteioPesos {
+    public:
+        explicit SorteioPesos(const ParametrosGerador& p) : parametros(p) {
+            if (!(p.pesoMinimo <= p.pesoMaximo)) throw std::runtime_error("Gerador: peso minimo maior que o maximo.");
+            if (p.distribuicao == DistribuicaoPesos::Inteira) {
+                minimoInteiro = static_cast<long long>(std::ceil(p.pesoMinimo));
+                const long long maximoInteiro = static_cast<long long>(std::floor(p.pesoMaximo));
+                if (minimoInteiro > maximoInteiro) throw std::runtime_error("Gerador: nao ha inteiros entre os pesos minimo e maximo.");
+                quantidadeInteiros = static_cast<uint64_t>(maximoInteiro - minimoInteiro) + 1;
+            }
+            if (p.distribuicao == DistribuicaoPesos::LogUniforme) {
+                if (!(p.pesoMinimo > 0.0)) throw std::runtime_error("Gerador: pesos log-uniformes exigem minimo > 0.");
+                logMinimo = std::log(p.pesoMinimo);
+                logAmplitude = std::log(p.pesoMaximo) - logMinimo;
+            }
+            if (p.negativos == PesosNegativos::Aleatorios && !(p.fracaoNegativos >= 0.0 && p.fracaoNegativos <= 1.0)) {
+                throw std::runtime_error("Gerador: fracao de negativos fora de [0, 1].");
+            }
+        }
+
+        double sortear(std::mt19937_64& rng, int u, int v) const {
+            double peso;
+            switch (parametros.distribuicao) {
+            case DistribuicaoPesos::Inteira:
+                peso = static_cast<double>(minimoInteiro + static_cast<long long>(rng() % quantidadeInteiros));
+                break;
+            case DistribuicaoPesos::LogUniforme:
+                peso = std::exp(logMinimo + logAmplitude * uniforme01(rng()));
+                break;
+            default:
+                peso = parametros.pesoMinimo + (parametros.pesoMaximo - parametros.pesoMinimo) * uniforme01(rng());
+                break;
+            }
+            if (parametros.negativos == PesosNegativos::Potenciais) {
+                peso += potencial(u) - potencial(v);
+            }
+            else if (parametros.negativos == PesosNegativos::Aleatorios && uniforme01(rng()) < parametros.fracaoNegativos) {
+                peso = -peso;
+            }
+            return peso;
+        }
+
+    private:
+        // p(v) depende só de v (e da semente), então é o mesmo em todas as arestas de v
+        double potencial(int vertice) const {
+            return parametros.pesoMaximo * uniforme01(hashIndice(parametros.semente, FLUXO_POTENCIAIS, static_cast<uint64_t>(vertice)));
+        }
+
+        const ParametrosGerador& parametros;
+        long long minimoInteiro = 0;
+        uint64_t quantidadeInteiros = 1;
+        double logMinimo = 0.0, logAmplitude = 0.0;
+    };
+
+    /**
+     * @brief Monta as arestas de um bloco (ou linha da grade) a partir dos extremos sorteados.
+     * @details Com ArestaComPeso, os pesos saem de um gerador próprio do bloco, separado do
+     * que sorteia os extremos: a estrutura é a mesma com ou sem pesos. Sem pesos, não há
+     * gerador nem sorteio nenhum a mais.
+     */
+    template <class Aresta>
+    class MontagemArestas {
+    public:
+        static constexpr bool COM_PESOS = std::is_same_v<Aresta, ArestaComPeso>;
+
+        MontagemArestas(const SorteioPesos& pesos, uint64_t semente, long long bloco) : pesos(pesos) {
+            if constexpr (COM_PESOS) rng = geradorDoBloco(semente, bloco, FLUXO_PESOS);
+        }
+
+        Aresta operator()(int u, int v) {
+            if constexpr (COM_PESOS) return { u, v, pesos.sortear(rng, u, v) };
+            else return { u, v };
+        }
+
+    private:
+        struct SemGerador {};
+
+        const SorteioPesos& pesos;
+        std::conditional_t<COM_PESOS, std::mt19937_64, SemGerador> rng;
+    };
+
+    // Probabilidades do R-MAT acumuladas com 16 bits: cada número sorteado decide 4 níveis
+    uint32_t quantizarProbabilidade(double x) {
+        return static_cast<uint32_t>(std::llround(x * 65536.0));
+    }
+
+    int menorExpoenteDois(long long n) {
+        int escala = 0;
+        while ((1LL << escala) < n) ++escala;
+        return escala;
+    }
+
+    int verticesParaInt(long long vertices) {
+        if (vertices > std::numeric_limits<int>::max()) {
+            throw std::runtime_error("Gerador: " + std::to_string(vertices) + " vertices nao cabem em int.");
+        }
+        return static_cast<int>(vertices);
+    }
+
+    /**
+     * @brief Preenche numeroVertices e numeroArestas com os valores efetivos do modelo.
+     */
+    ParametrosGerador resolverTamanhos(ParametrosGerador p) {
+        if (p.numeroVertices < 0 || p.numeroArestas < 0) throw std::runtime_error("Gerador: tamanho negativo.");
+        if (p.numeroVertices == 0 && p.numeroArestas == 0) throw std::runtime_error("Gerador: informe o numero de vertices ou de arestas.");
+        const long long m = p.numeroArestas;
+
+        switch (p.modelo) {
+        case ModeloGerador::RMAT: {
+            const long long alvo = p.numeroVertices > 0 ? p.numeroVertices : std::max(2LL, m / FATOR_ARESTAS);
+            const int escala = std::max(1, menorExpoenteDois(alvo));
+            if (escala > 30) throw std::runtime_error("Gerador: R-MAT com mais de 2^30 vertices.");
+            p.numeroVertices = 1 << escala;
+            if (m == 0) p.numeroArestas = static_cast<long long>(FATOR_ARESTAS) * p.numeroVertices;
+            if (!(p.a >= 0.0 && p.b >= 0.0 && p.c >= 0.0 && p.a + p.b + p.c <= 1.0)) {
+                throw std::runtime_error("Gerador: probabilidades do R-MAT invalidas (a, b, c >= 0 e a + b + c <= 1).");
+            }
+            // Sem os quadrantes b e c (depois da quantização), toda aresta seria um laço
+            // e o sorteio, que descarta laços, nunca terminaria
+            if (quantizarProbabilidade(p.a + p.b + p.c) == quantizarProbabilidade(p.a)) {
+                throw std::runtime_error("Gerador: R-MAT exige b + c > 0 (com b = c = 0 so ha lacos).");
+            }
+            break;
+        }
+        case ModeloGerador::ErdosRenyi:
+            if (p.numeroVertices == 0) p.numeroVertices = verticesParaInt(std::max(2LL, m / FATOR_ARESTAS));
+            if (m == 0) p.numeroArestas = static_cast<long long>(FATOR_ARESTAS) * p.numeroVertices;
+            if (p.numeroVertices < 2) throw std::runtime_error("Gerador: G(n,m) exige ao menos 2 vertices.");
+            break;
+        case ModeloGerador::Grade2D:
+        case ModeloGerador::Grade3D: {
+            const int dimensoes = (p.modelo == ModeloGerador::Grade2D) ? 2 : 3;
+            const double lado = p.numeroVertices > 0 ? std::pow(static_cast<double>(p.numeroVertices), 1.0 / dimensoes)
+                : std::pow(static_cast<double>(m) / dimensoes, 1.0 / dimensoes);
+            const long long L = std::max(2LL, std::llround(lado));
+            const long long vertices = (dimensoes == 2) ? L * L : L * L * L;
+            p.numeroVertices = verticesParaInt(vertices);
+            p.numeroArestas = dimensoes * (vertices / L) * (L - 1); // L - 1 arestas por linha, em cada direção
+            break;
+        }
+        case ModeloGerador::BarabasiAlbert:
+            if (p.arestasPorVertice < 1) throw std::runtime_error("Gerador: Barabasi-Albert exige k >= 1.");
+            if (p.numeroVertices == 0) p.numeroVertices = verticesParaInt(std::max(2LL, m / p.arestasPorVertice + 1));
+            if (p.numeroVertices < 2) throw std::runtime_error("Gerador: Barabasi-Albert exige ao menos 2 vertices.");
+            p.numeroArestas = static_cast<long long>(p.numeroVertices - 1) * p.arestasPorVertice;
+            break;
+        }
+        return p;
+    }
+
+    int totalBlocos(long long numeroArestas) {
+        return static_cast<int>((numeroArestas + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO);
+    }
+
+    /**
+     * @brief Bijeção em [0, 2^escala) usada para embaralhar os rótulos do R-MAT.
+     */
+    class PermutacaoRotulos {
+    public:
+        PermutacaoRotulos(int escala, uint64_t semente)
+            : mascara((1ULL << escala) - 1), deslocamento((escala + 1) / 2),
+            chave(hashIndice(semente, FLUXO_ROTULOS, 0) & mascara) {}
+
+        int operator()(int x) const {
+            uint64_t y = static_cast<uint64_t>(x) ^ chave;
+            y = (y * 0x9E3779B97F4A7C15ULL) & mascara; // Multiplicação por ímpar: bijeção módulo 2^escala
+            y ^= y >> deslocamento;
+            y = (y * 0xBF58476D1CE4E5B9ULL) & mascara;
+            y ^= y >> deslocamento;
+            return static_cast<int>(y);
+        }
+
+    private:
+        uint64_t mascara;
+        int deslocamento;
+        uint64_t chave;
+    };
+
+    template <class Aresta>
+    void gerarRMAT(const ParametrosGerador& p, const SorteioPesos& pesos, std::vector<Aresta>& arestas, int numThreads) {
+        const int escala = menorExpoenteDois(p.numeroVertices);
+        const uint32_t limiteA = quantizarProbabilidade(p.a);
+        const uint32_t limiteAB = quantizarProbabilidade(p.a + p.b);
+        const uint32_t limiteABC = quantizarProbabilidade(p.a + p.b + p.c);
+        const PermutacaoRotulos permutar(escala, p.semente);
+        const long long m = p.numeroArestas;
+
+        executarEmParalelo(totalBlocos(m), numThreads, [&](int bloco, int) {
+            std::mt19937_64 rng = geradorDoBloco(p.semente, bloco);
+            MontagemArestas<Aresta> montar(pesos, p.semente, bloco);
+            const long long fim = std::min(m, (bloco + 1) * TAMANHO_BLOCO);
+            for (long long i = bloco * TAMANHO_BLOCO; i < fim; ++i) {
+                int u, v;
+                do {
+                    // Desce 'escala' níveis da matriz de adjacência escolhendo um quadrante por nível
+                    u = 0;
+                    v = 0;
+                    uint64_t bits = 0;
+                    for (int nivel = 0; nivel < escala; ++nivel) {
+                        if (nivel % 4 == 0) bits = rng();
+                        const uint32_t r = static_cast<uint32_t>(bits & 0xFFFF);
+                        bits >>= 16;
+                        // Quadrantes a, b, c, d = (0,0), (0,1), (1,0), (1,1), sem desvios
+                        const int linha = static_cast<int>(r >= limiteAB);
+                        const int coluna = static_cast<int>(r >= limiteA) ^ linha ^ static_cast<int>(r >= limiteABC);
+                        u = (u << 1) | linha;
+                        v = (v << 1) | coluna;
+                    }
+                    if (p.embaralharRotulos) {
+                        u = permutar(u);
+                        v = permutar(v);
+                    }
+                } while (u == v);
+                arestas[i] = montar(u + 1, v + 1);
+            }
+        });
+    }
+
+    template <class Aresta>
+    void gerarErdosRenyi(const ParametrosGerador& p, const SorteioPesos& pesos, std::vector<Aresta>& arestas, int numThreads) {
+        const uint64_t n = static_cast<uint64_t>(p.numeroVertices);
+        const long long m = p.numeroArestas;
+
+        executarEmParalelo(totalBlocos(m), numThreads, [&](int bloco, int) {
+            std::mt19937_64 rng = geradorDoBloco(p.semente, bloco);
+            MontagemArestas<Aresta> montar(pesos, p.semente, bloco);
+            const long long fim = std::min(m, (bloco + 1) * TAMANHO_BLOCO);
+            for (long long i = bloco * TAMANHO_BLOCO; i < fim; ++i) {
+                int u, v;
+                do {
+                    u = 1 + static_cast<int>(rng() % n);
+                    v = 1 + static_cast<int>(rng() % n);
+                } while (u == v);
+                arestas[i] = montar(u, v);
+            }
+        });
+    }
+
+    /**
+     * @details Cada tarefa é uma linha da grade ao longo de x (y e z fixos); o deslocamento
+     * de cada linha no vetor é conhecido de antemão, então as linhas são independentes.
+     */
+    template <class Aresta>
+    void gerarGrade(const ParametrosGerador& p, int dimensoes, const SorteioPesos& pesos,
+        std::vector<Aresta>& arestas, int numThreads) {
+        const long long V = p.numeroVertices;
+        const int L = static_cast<int>(std::llround(std::pow(static_cast<double>(V), 1.0 / dimensoes)));
+        const int linhas = static_cast<int>(V / L);
+
+        auto arestasDaLinha = [&](int linha) {
+            const int y = linha % L, z = linha / L;
+            return static_cast<long long>(L - 1) + (y < L - 1 ? L : 0) + (dimensoes == 3 && z < L - 1 ? L : 0);
+        };
+        std::vector<long long> inicioLinha(static_cast<size_t>(linhas) + 1, 0);
+        for (int linha = 0; linha < linhas; ++linha) inicioLinha[linha + 1] = inicioLinha[linha] + arestasDaLinha(linha);
+
+        executarEmParalelo(linhas, numThreads, [&](int linha, int) {
+            MontagemArestas<Aresta> montar(pesos, p.semente, linha);
+            const int y = linha % L, z = linha / L;
+            long long i = inicioLinha[linha];
+            const int primeiro = linha * L + 1;
+            for (int x = 0; x < L; ++x) {
+                const int u = primeiro + x;
+                if (x < L - 1) arestas[i++] = montar(u, u + 1);
+                if (y < L - 1) arestas[i++] = montar(u, u + L);
+                if (dimensoes == 3 && z < L - 1) arestas[i++] = montar(u, u + L * L);
+            }
+        });
+    }
+
+    /**
+     * @details Versão paralela do algoritmo de Batagelj e Brandes: a lista com os extremos
+     * de todas as arestas (M[2e] = origem, M[2e+1] = destino) nunca é materializada. O
+     * destino da aresta e de um vértice u é M[r], com r uniforme entre as posições das
+     * arestas de vértices anteriores a u; se r cai em um destino, repete-se a escolha
+     * para aquela aresta. O sorteio de cada posição vem de um hash dela, então o
+     * resultado não depende da ordem em que as arestas são resolvidas.
+     */
+    template <class Aresta>
+    void gerarBarabasiAlbert(const ParametrosGerador& p, const SorteioPesos& pesos, std::vector<Aresta>& arestas, int numThreads) {
+        const long long k = p.arestasPorVertice;
+        const long long m = p.numeroArestas;
+        auto origemDaAresta = [k](long long e) { return static_cast<int>(2 + e / k); };
+
+        auto destinoDaAresta = [&](long long e) {
+            long long posicao = 2 * e + 1;
+            while (true) {
+                const int origem = origemDaAresta(posicao / 2);
+                if (origem == 2) return 1; // O vértice 2 só pode ligar-se ao 1
+                const uint64_t anteriores = 2 * static_cast<uint64_t>(origem - 2) * static_cast<uint64_t>(k);
+                const uint64_t r = hashIndice(p.semente, FLUXO_LIGACAO, static_cast<uint64_t>(posicao)) % anteriores;
+                if (r % 2 == 0) return origemDaAresta(static_cast<long long>(r / 2));
+                posicao = static_cast<long long>(r);
+            }
+        };
+
+        executarEmParalelo(totalBlocos(m), numThreads, [&](int bloco, int) {
+            MontagemArestas<Aresta> montar(pesos, p.semente, bloco);
+            const long long fim = std::min(m, (bloco + 1) * TAMANHO_BLOCO);
+            for (long long e = bloco * TAMANHO_BLOCO; e < fim; ++e) {
+                const int u = origemDaAresta(e);
+                const int v = destinoDaAresta(e);
+                arestas[e] = montar(u, v);
+            }
+        });
+    }
+
+    struct NomeModelo {
+        const char* chave;
+        ModeloGerador modelo;
+    };
+
+    const NomeModelo MODELOS[] = {
+        { "rmat", ModeloGerador::RMAT },
+        { "gnm", ModeloGerador::ErdosRenyi },
+        { "grade2d", ModeloGerador::Grade2D },
+        { "grade3d", ModeloGerador::Grade3D },
+        { "ba", ModeloGerador::BarabasiAlbert },
+    };
+
+    const char* const NOMES_DISTRIBUICAO[] = { "uniforme", "inteiro", "log" };
+    const char* const NOMES_NEGATIVOS[] = { "nenhum", "potenciais", "aleatorios" };
+
+    double lerNumeroEspecificacao(const std::string& chave, const std::string& valor) {
+        size_t lidos = 0;
+        double numero = 0.0;
+        try {
+            numero = std::stod(valor, &lidos);
+        }
+        catch (const std::exception&) {
+            lidos = 0;
+        }
+        if (lidos != valor.size() || !std::isfinite(numero)) {
+            throw std::runtime_error("Gerador: valor invalido para " + chave + ": " + valor);
+        }
+        return numero;
+    }
+
+    long long lerInteiroEspecificacao(const std::string& chave, const std::string& valor, long long maximo) {
+        const double numero = lerNumeroEspecificacao(chave, valor);
+        if (numero < 0.0 || numero != std::floor(numero) || numero > static_cast<double>(maximo)) {
+            throw std::runtime_error("Gerador: valor invalido para " + chave + ": " + valor);
+        }
+        return static_cast<long long>(numero);
+    }
+
+    template <size_t N>
+    int lerOpcaoEspecificacao(const std::string& chave, const std::string& valor, const char* const (&nomes)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            if (valor == nomes[i]) return static_cast<int>(i);
+        }
+        throw std::runtime_error("Gerador: valor invalido para " + chave + ": " + valor);
+    }
+
+} // namespace
+
+template <class Aresta>
+GrafoGerado<Aresta> gerarArestas(const ParametrosGerador& parametros, int numThreads) {
+    const ParametrosGerador p = resolverTamanhos(parametros);
+    const SorteioPesos pesos(p);
+
+    GrafoGerado<Aresta> gerado;
+    gerado.numeroVertices = p.numeroVertices;
+    gerado.arestas.resize(static_cast<size_t>(p.numeroArestas));
+
+    switch (p.modelo) {
+    case ModeloGerador::RMAT: gerarRMAT(p, pesos, gerado.arestas, numThreads); break;
+    case ModeloGerador::ErdosRenyi: gerarErdosRenyi(p, pesos, gerado.arestas, numThreads); break;
+    case ModeloGerador::Grade2D: gerarGrade(p, 2, pesos, gerado.arestas, numThreads); break;
+    case ModeloGerador::Grade3D: gerarGrade(p, 3, pesos, gerado.arestas, numThreads); break;
+    case ModeloGerador::BarabasiAlbert: gerarBarabasiAlbert(p, pesos, gerado.arestas, numThreads); break;
+    }
+    return gerado;
+}
+
+template GrafoGerado<std::pair<int, int>> gerarArestas<std::pair<int, int>>(const ParametrosGerador&, int);
+template GrafoGerado<ArestaComPeso> gerarArestas<ArestaComPeso>(const ParametrosGerador&, int);
+
+void verificarDirecaoGerador(const ParametrosGerador& parametros, bool direcionado) {
+    if (parametros.negativos == PesosNegativos::Potenciais && !direcionado) {
+        throw std::runtime_error("Gerador: negativos=potenciais exige grafo direcionado "
+            "(sem direcao, toda aresta negativa forma um ciclo negativo com a sua volta).");
+    }
+}
+
+ParametrosGerador lerEspecificacaoGerador(const std::string& especificacao, bool comPesos) {
+    std::vector<std::string> partes;
+    std::stringstream fluxo(especificacao);
+    std::string parte;
+    while (std::getline(fluxo, parte, ':')) partes.push_back(parte);
+    if (partes.empty()) throw std::runtime_error("Gerador: especificacao vazia.");
+
+    ParametrosGerador p;
+    const auto modelo = std::find_if(std::begin(MODELOS), std::end(MODELOS),
+        [&](const NomeModelo& nome) { return partes[0] == nome.chave; });
+    if (modelo == std::end(MODELOS)) throw std::runtime_error("Gerador: modelo desconhecido: " + partes[0]);
+    p.modelo = modelo->modelo;
+
+    for (size_t i = 1; i < partes.size(); ++i) {
+        const size_t igual = partes[i].find('=');
+        if (igual == std::string::npos) throw std::runtime_error("Gerador: esperado chave=valor em: " + partes[i]);
+        const std::string chave = partes[i].substr(0, igual);
+        const std::string valor = partes[i].substr(igual + 1);
+        const bool chaveDePeso = (chave == "pesos" || chave == "min" || chave == "max" || chave == "negativos" || chave == "fracao");
+        if (chaveDePeso && !comPesos) throw std::runtime_error("Gerador: chave desconhecida em grafo sem pesos: " + chave);
+
+        if (chave == "v") p.numeroVertices = static_cast<int>(lerInteiroEspecificacao(chave, valor, std::numeric_limits<int>::max()));
+        else if (chave == "m") p.numeroArestas = lerInteiroEspecificacao(chave, valor, std::numeric_limits<long long>::max() / 2);
+        else if (chave == "k") p.arestasPorVertice = static_cast<int>(lerInteiroEspecificacao(chave, valor, std::numeric_limits<int>::max()));
+        else if (chave == "a") p.a = lerNumeroEspecificacao(chave, valor);
+        else if (chave == "b") p.b = lerNumeroEspecificacao(chave, valor);
+        else if (chave == "c") p.c = lerNumeroEspecificacao(chave, valor);
+        else if (chave == "rotulos") {
+            if (valor != "sim" && valor != "nao") throw std::runtime_error("Gerador: valor invalido para rotulos: " + valor);
+            p.embaralharRotulos = (valor == "sim");
+        }
+        else if (chave == "pesos") p.distribuicao = static_cast<DistribuicaoPesos>(lerOpcaoEspecificacao(chave, valor, NOMES_DISTRIBUICAO));
+        else if (chave == "min") p.pesoMinimo = lerNumeroEspecificacao(chave, valor);
+        else if (chave == "max") p.pesoMaximo = lerNumeroEspecificacao(chave, valor);
+        else if (chave == "negativos") p.negativos = static_cast<PesosNegativos>(lerOpcaoEspecificacao(chave, valor, NOMES_NEGATIVOS));
+        else if (chave == "fracao") p.fracaoNegativos = lerNumeroEspecificacao(chave, valor);
+        else if (chave == "semente") p.semente = static_cast<unsigned long long>(
+            lerInteiroEspecificacao(chave, valor, std::numeric_limits<long long>::max()));
+        else throw std::runtime_error("Gerador: chave desconhecida: " + chave);
+    }
+    return p;
+}
+
+std::string descreverGerador(const ParametrosGerador& parametros, bool comPesos) {
+    const ParametrosGerador p = resolverTamanhos(parametros);
+    const ParametrosGerador padrao;
+    std::ostringstream texto;
+
+    for (const auto& nome : MODELOS) {
+        if (nome.modelo == p.modelo) texto << nome.chave;
+    }
+    texto << ":v=" << p.numeroVertices << ":m=" << p.numeroArestas;
+    if (p.modelo == ModeloGerador::BarabasiAlbert) texto << ":k=" << p.arestasPorVertice;
+    if (p.modelo == ModeloGerador::RMAT) {
+        if (p.a != padrao.a || p.b != padrao.b || p.c != padrao.c) texto << ":a=" << p.a << ":b=" << p.b << ":c=" << p.c;
+        if (!p.embaralharRotulos) texto << ":rotulos=nao";
+    }
+    if (comPesos) {
+        texto << ":pesos=" << NOMES_DISTRIBUICAO[static_cast<int>(p.distribuicao)]
+            << ":min=" << p.pesoMinimo << ":max=" << p.pesoMaximo;
+        if (p.negativos != PesosNegativos::Nenhum) texto << ":negativos=" << NOMES_NEGATIVOS[static_cast<int>(p.negativos)];
+        if (p.negativos == PesosNegativos::Aleatorios) texto << ":fracao=" << p.fracaoNegativos;
+    }
+    texto << ":semente=" << p.semente;
+    return texto.str();
+}
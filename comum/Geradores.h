@@ -0,0 +1,126 @@
+#pragma once
+/**
+ * @file Geradores.h
+ * @brief Geradores de grafos sintéticos para estudos de escala (R-MAT, G(n,m), grades e Barabási–Albert).
+ * @details Os grafos são gerados em paralelo, em memória, e entregues direto ao
+ * construtor que recebe arestas (Grafo no TP1, GrafoPesado no TP3), sem arquivo texto
+ * no meio. O gerador é o mesmo nos dois TPs: só o tipo da aresta muda (ver gerarArestas),
+ * e a mesma especificação produz a mesma estrutura com ou sem pesos. Cada bloco
+ * de arestas tem o seu próprio gerador pseudoaleatório, derivado da semente e do índice
+ * do bloco, então o mesmo ParametrosGerador produz exatamente as mesmas arestas com
+ * qualquer número de threads.
+ *
+ * Tamanho: basta informar numeroVertices ou numeroArestas; o outro é derivado pelo
+ * modelo (fator de arestas 16 no R-MAT e no G(n,m), como no Graph500). O teto prático
+ * é o do CSR, com deslocamentos int: até 2^31 - 1 entradas (metade disso em arestas
+ * se o grafo não for direcionado), além de 8 bytes por aresta durante a construção
+ * (16 com pesos). As matrizes do TP1 continuam limitadas pelos V^2 bits.
+ */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ArestaComPeso.h"
+
+/**
+ * @brief Modelo de grafo gerado.
+ */
+enum class ModeloGerador {
+    RMAT,           ///< Recursivo (Kronecker), graus com cauda pesada; V é arredondado para potência de 2
+    ErdosRenyi,     ///< G(n, m): m arestas com extremos sorteados uniformemente
+    Grade2D,        ///< Grade L x L, vizinhança de 4 (diâmetro alto, graus constantes)
+    Grade3D,        ///< Grade L x L x L, vizinhança de 6
+    BarabasiAlbert  ///< Ligação preferencial: cada vértice novo liga-se a k vértices anteriores
+};
+
+/**
+ * @brief Distribuição dos pesos (antes dos pesos negativos, se houver). Só vale com ArestaComPeso.
+ */
+enum class DistribuicaoPesos {
+    Uniforme,    ///< Real uniforme em [pesoMinimo, pesoMaximo]
+    Inteira,     ///< Inteiro uniforme em [pesoMinimo, pesoMaximo]
+    LogUniforme  ///< exp(uniforme(log mínimo, log máximo)); várias ordens de grandeza (mínimo > 0)
+};
+
+/**
+ * @brief Como introduzir pesos negativos (para o Bellman-Ford).
+ */
+enum class PesosNegativos {
+    Nenhum,     ///< Todos os pesos seguem a distribuição
+    Potenciais, ///< w(u, v) + p(u) - p(v), p sorteado em [0, pesoMaximo]: há arestas negativas, mas nenhum
+                ///< ciclo negativo (a soma de um ciclo não muda). Só em grafos direcionados
+                ///< (ver verificarDirecaoGerador)
+    Aleatorios  ///< Cada peso é negado com probabilidade fracaoNegativos (ciclos negativos são prováveis)
+};
+
+/**
+ * @struct ParametrosGerador
+ * @brief Descrição completa de um grafo sintético (ver lerEspecificacaoGerador).
+ */
+struct ParametrosGerador {
+    ModeloGerador modelo = ModeloGerador::RMAT;
+    int numeroVertices = 0;       // 0 => derivado de numeroArestas
+    long long numeroArestas = 0;  // 0 => derivado de numeroVertices (nas grades e no B-A é sempre derivado)
+    int arestasPorVertice = 8;    // k do Barabási–Albert
+    double a = 0.57, b = 0.19, c = 0.19; // Probabilidades dos quadrantes do R-MAT (d = 1 - a - b - c)
+    bool embaralharRotulos = true;       // R-MAT: permuta os ids, como no Graph500 (evita localidade artificial)
+
+    DistribuicaoPesos distribuicao = DistribuicaoPesos::Uniforme;
+    double pesoMinimo = 1.0;
+    double pesoMaximo = 100.0;
+    PesosNegativos negativos = PesosNegativos::Nenhum;
+    double fracaoNegativos = 0.1; // Só em PesosNegativos::Aleatorios
+
+    unsigned long long semente = 1;
+};
+
+/**
+ * @struct GrafoGerado
+ * @brief Arestas geradas e o número efetivo de vértices (ids 1..numeroVertices).
+ */
+template <class Aresta>
+struct GrafoGerado {
+    int numeroVertices = 0;
+    std::vector<Aresta> arestas;
+};
+
+/**
+ * @brief Gera as arestas descritas por 'parametros'.
+ * @details Não gera laços; arestas repetidas são possíveis no R-MAT, no G(n,m) e no
+ * Barabási–Albert (o CSR as mantém, como faria com um arquivo). Cada aresta aparece
+ * uma vez; se o grafo não for direcionado, a representação cria a volta.
+ * @tparam Aresta std::pair<int, int> (sem pesos, TP1) ou ArestaComPeso (TP3). Os pesos são
+ * sorteados de um fluxo pseudoaleatório próprio, então não mudam a estrutura.
+ * @param numThreads Threads usadas na geração (<= 0 usa o número de núcleos); não altera o resultado.
+ * @throws std::runtime_error se os parâmetros forem inválidos ou o tamanho não couber em int.
+ */
+template <class Aresta>
+GrafoGerado<Aresta> gerarArestas(const ParametrosGerador& parametros, int numThreads = 0);
+
+/**
+ * @brief Verifica se o grafo descrito pode ser montado com a direção pedida.
+ * @details Sem direção, cada aresta negativa u - v forma com a sua volta o ciclo
+ * u -> v -> u de peso 2 w(u, v) < 0, então negativos=potenciais só é aceito em
+ * grafos direcionados. Chamado por quem monta o GrafoPesado a partir do gerador.
+ * @throws std::runtime_error se negativos=potenciais for usado em grafo não direcionado.
+ */
+void verificarDirecaoGerador(const ParametrosGerador& parametros, bool direcionado);
+
+/**
+ * @brief Lê uma especificação textual "modelo[:chave=valor]...".
+ * @details Modelos: rmat, gnm, grade2d, grade3d, ba. Chaves: v (vértices), m (arestas),
+ * k (B-A), a, b, c (R-MAT), rotulos=sim|nao (R-MAT), semente e, com pesos,
+ * pesos=uniforme|inteiro|log, min, max, negativos=nenhum|potenciais|aleatorios e fracao.
+ * Números inteiros aceitam notação científica (ex: "rmat:m=1e8:negativos=potenciais").
+ * @param comPesos false para grafos sem pesos: as chaves de pesos passam a ser desconhecidas.
+ * @throws std::runtime_error se a especificação for inválida.
+ */
+ParametrosGerador lerEspecificacaoGerador(const std::string& especificacao, bool comPesos);
+
+/**
+ * @brief Especificação canônica (no formato de lerEspecificacaoGerador) com os tamanhos efetivos.
+ * @details Usada como nome do grafo nos resultados dos benchmarks.
+ * @param comPesos Inclui as chaves de pesos.
+ */
+std::string descreverGerador(const ParametrosGerador& parametros, bool comPesos);
@@ -0,0 +1,155 @@
+/**
+ * @file Paralelo.cpp
+ * @brief Implementação dos utilitários de paralelismo.
+ */
+
+#include "Paralelo.h"
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#include <dirent.h>
+#endif
+
+int obterNumeroThreadsPadrao() {
+    unsigned int n = std::thread::hardware_concurrency();
+    return (n == 0) ? 1 : static_cast<int>(n);
+}
+
+void executarEmParalelo(int totalTarefas, int numThreads, const std::function<void(int indiceTarefa, int idThread)>& tarefa) {
+    if (totalTarefas <= 0) return;
+    if (numThreads <= 0) numThreads = obterNumeroThreadsPadrao();
+    numThreads = std::min(numThreads, totalTarefas);
+
+    // Caso trivial: sem overhead de criação de threads
+    if (numThreads == 1) {
+        for (int i = 0; i < totalTarefas; ++i) tarefa(i, 0);
+        return;
+    }
+
+    std::atomic<int> proximaTarefa(0);
+    std::atomic<bool> abortar(false);
+    std::exception_ptr primeiraExcecao;
+    std::mutex mutexExcecao;
+
+    auto trabalhador = [&](int idThread) {
+        try {
+            while (!abortar.load(std::memory_order_relaxed)) {
+                int i = proximaTarefa.fetch_add(1, std::memory_order_relaxed);
+                if (i >= totalTarefas) break;
+                tarefa(i, idThread);
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> trava(mutexExcecao);
+            if (!primeiraExcecao) primeiraExcecao = std::current_exception();
+            abortar = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; ++t) {
+        threads.emplace_back(trabalhador, t);
+    }
+    trabalhador(0); // A thread chamadora também processa tarefas
+    for (auto& th : threads) th.join();
+
+    if (primeiraExcecao) std::rethrow_exception(primeiraExcecao);
+}
+
+bool restringirAosProcessadores(int quantidade) {
+    const std::vector<int>& processadores = obterProcessadoresDisponiveis();
+    const size_t usados = (quantidade <= 0) ? processadores.size()
+        : std::min(processadores.size(), static_cast<size_t>(quantidade));
+#if defined(_WIN32)
+    DWORD_PTR mascara = 0;
+    for (size_t i = 0; i < usados; ++i) {
+        if (processadores[i] < static_cast<int>(8 * sizeof(DWORD_PTR))) mascara |= DWORD_PTR(1) << processadores[i];
+    }
+    return mascara != 0 && SetProcessAffinityMask(GetCurrentProcess(), mascara) != 0;
+#elif defined(__linux__)
+    cpu_set_t mascara;
+    CPU_ZERO(&mascara);
+    for (size_t i = 0; i < usados; ++i) {
+        if (processadores[i] < CPU_SETSIZE) CPU_SET(processadores[i], &mascara);
+    }
+    return sched_setaffinity(0, sizeof(mascara), &mascara) == 0;
+#else
+    (void)usados;
+    return false;
+#endif
+}
+
+const std::vector<int>& obterProcessadoresDisponiveis() {
+    static const std::vector<int> processadores = [] {
+        std::vector<int> lista;
+#if defined(_WIN32)
+        DWORD_PTR mascaraProcesso = 0, mascaraSistema = 0;
+        if (GetProcessAffinityMask(GetCurrentProcess(), &mascaraProcesso, &mascaraSistema)) {
+            for (int p = 0; p < static_cast<int>(8 * sizeof(DWORD_PTR)); ++p) {
+                if (mascaraProcesso & (DWORD_PTR(1) << p)) lista.push_back(p);
+            }
+        }
+#elif defined(__linux__)
+        cpu_set_t mascara;
+        CPU_ZERO(&mascara);
+        if (sched_getaffinity(0, sizeof(mascara), &mascara) == 0) {
+            for (int p = 0; p < CPU_SETSIZE; ++p) {
+                if (CPU_ISSET(p, &mascara)) lista.push_back(p);
+            }
+        }
+#endif
+        if (lista.empty()) {
+            for (int p = 0; p < obterNumeroThreadsPadrao(); ++p) lista.push_back(p);
+        }
+        // Preenche um nó NUMA por vez (nós desconhecidos, -1, vêm primeiro e mantêm a ordem)
+        std::vector<std::pair<int, int>> porNo; // (nó, processador)
+        for (int p : lista) porNo.emplace_back(obterNoNUMA(p), p);
+        std::sort(porNo.begin(), porNo.end());
+        for (size_t i = 0; i < porNo.size(); ++i) lista[i] = porNo[i].second;
+        return lista;
+    }();
+    return processadores;
+}
+
+int obterNoNUMA(int processador) {
+    if (processador < 0) return -1;
+#if defined(_WIN32)
+    if (processador > 255) return -1;
+    UCHAR no = 0;
+    if (!GetNumaProcessorNode(static_cast<UCHAR>(processador), &no) || no == 0xFF) return -1;
+    return static_cast<int>(no);
+#elif defined(__linux__)
+    // O sysfs expõe o nó como a entrada /sys/devices/system/cpu/cpuN/nodeK
+    const std::string caminho = "/sys/devices/system/cpu/cpu" + std::to_string(processador);
+    DIR* diretorio = opendir(caminho.c_str());
+    if (!diretorio) return -1;
+    int no = -1;
+    while (dirent* entrada = readdir(diretorio)) {
+        const char* nome = entrada->d_name;
+        if (std::strncmp(nome, "node", 4) == 0 && nome[4] >= '0' && nome[4] <= '9') {
+            no = std::atoi(nome + 4);
+            break;
+        }
+    }
+    closedir(diretorio);
+    return no;
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,75 @@
+#pragma once
+/**
+ * @file Paralelo.h
+ * @brief Utilitários simples de paralelismo usados pelos algoritmos da biblioteca.
+ * @details Centraliza a criação de threads para que os algoritmos não precisem
+ * lidar diretamente com std::thread, sincronização e propagação de exceções.
+ */
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Obtém o número de threads usado quando o chamador não especifica um valor.
+ * @return std::thread::hardware_concurrency(), ou 1 se a informação não estiver disponível.
+ */
+int obterNumeroThreadsPadrao();
+
+/**
+ * @brief Executa 'totalTarefas' tarefas independentes distribuídas entre 'numThreads' threads.
+ * @details As tarefas são retiradas de um contador atômico compartilhado, então
+ * threads que terminam cedo continuam pegando trabalho (balanceamento dinâmico).
+ * A thread chamadora também trabalha. Se alguma tarefa lançar exceção, as demais
+ * threads param de pegar tarefas novas e a primeira exceção é relançada ao final.
+ * @param totalTarefas Número de tarefas, identificadas por 0..totalTarefas-1.
+ * @param numThreads Número de threads (<= 0 usa obterNumeroThreadsPadrao()).
+ * @param tarefa Função chamada como tarefa(indiceTarefa, idThread), com idThread em [0, numThreads).
+ */
+void executarEmParalelo(int totalTarefas, int numThreads, const std::function<void(int indiceTarefa, int idThread)>& tarefa);
+
+/**
+ * @brief Restringe a thread chamadora, e as threads que ela criar depois, aos primeiros
+ * 'quantidade' processadores de obterProcessadoresDisponiveis().
+ * @details A biblioteca não fixa threads por conta própria: quem mede decide. As threads
+ * de executarEmParalelo e dos algoritmos que criam threads próprias herdam a afinidade da
+ * thread que as criou, então t threads restritas a t processadores preenchem um nó NUMA
+ * antes de passar ao próximo. No Windows a restrição vale para o processo inteiro.
+ * @param quantidade Número de processadores (<= 0, ou mais que os disponíveis, usa todos).
+ * @return true se o sistema aceitou a restrição.
+ */
+bool restringirAosProcessadores(int quantidade);
+
+/**
+ * @brief Processadores que o processo pode usar, ordenados por nó NUMA e depois por número.
+ * @details Lidos uma única vez, na primeira chamada (antes de qualquer restrição). Fora do
+ * Linux e do Windows, ou se a consulta falhar, devolve 0..obterNumeroThreadsPadrao()-1.
+ */
+const std::vector<int>& obterProcessadoresDisponiveis();
+
+/**
+ * @brief Nó NUMA de um processador (-1 se desconhecido).
+ */
+int obterNoNUMA(int processador);
+
+/**
+ * @struct ControleExecucao
+ * @brief Opções de análises longas: número de threads, progresso e cancelamento.
+ */
+struct ControleExecucao {
+    int numThreads = 0; ///< <= 0 usa obterNumeroThreadsPadrao()
+
+    /**
+     * @brief Chamado com (concluidas, total) à medida que as unidades de trabalho terminam.
+     * @details As chamadas são serializadas (nunca duas ao mesmo tempo), mas podem vir de
+     * qualquer thread. total = 0 indica que o total não é conhecido de antemão (ex: iterações
+     * até convergir). Pode ficar vazio.
+     */
+    std::function<void(long long concluidas, long long total)> progresso;
+
+    /**
+     * @brief Se não for nulo e passar a valer true, a análise para assim que possível
+     * e lança std::runtime_error.
+     */
+    const std::atomic<bool>* cancelar = nullptr;
+};